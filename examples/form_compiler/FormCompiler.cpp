@@ -0,0 +1,78 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/Loading/DataIO.hpp>
+#include <TGUI/Exception.hpp>
+#include <fstream>
+#include <iostream>
+#include <cstring>
+
+// Converts widget files between the editable text format and the binary format.
+// The conversion only works on the tree of nodes, so no widgets, textures or fonts are loaded.
+int main(int argc, char* argv[])
+{
+    const bool toText = (argc > 1) && (std::strcmp(argv[1], "--text") == 0);
+    const int firstFile = toText ? 2 : 1;
+    if ((argc - firstFile < 2) || ((argc - firstFile) % 2 != 0))
+    {
+        std::cerr << "Usage: " << argv[0] << " [--text] input.txt output.tgf [input2.txt output2.tgf ...]" << std::endl;
+        std::cerr << "With --text, binary input files are converted back to text." << std::endl;
+        return 1;
+    }
+
+    for (int i = firstFile; i < argc; i += 2)
+    {
+        try
+        {
+            std::ifstream in{argv[i], std::ios::binary};
+            if (!in.is_open())
+                throw tgui::Exception{"Failed to open '" + std::string(argv[i]) + "'."};
+
+            std::stringstream input;
+            input << in.rdbuf();
+
+            std::stringstream output;
+            const auto rootNode = tgui::DataIO::parse(input);
+            if (toText)
+                tgui::DataIO::emit(rootNode, output);
+            else
+                tgui::DataIO::emitBinary(rootNode, output);
+
+            std::ofstream out{argv[i+1], toText ? std::ios::out : std::ios::out | std::ios::binary};
+            if (!out.is_open())
+                throw tgui::Exception{"Failed to open '" + std::string(argv[i+1]) + "' for writing."};
+
+            out << output.rdbuf();
+            std::cout << "Converted " << argv[i] << " into " << argv[i+1] << std::endl;
+        }
+        catch (const tgui::Exception& e)
+        {
+            std::cerr << "Failed to convert " << argv[i] << ": " << e.what() << std::endl;
+            return 1;
+        }
+    }
+
+    return 0;
+}
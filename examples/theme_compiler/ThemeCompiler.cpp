@@ -0,0 +1,54 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/Loading/BinaryThemeLoader.hpp>
+#include <iostream>
+
+// Converts text theme files into binary theme files that can be loaded with tgui::BinaryThemeLoader.
+// Usage: theme_compiler input.txt output.tgt [input2.txt output2.tgt ...]
+int main(int argc, char* argv[])
+{
+    if ((argc < 3) || (argc % 2 == 0))
+    {
+        std::cerr << "Usage: " << argv[0] << " input.txt output.tgt [input2.txt output2.tgt ...]" << std::endl;
+        return 1;
+    }
+
+    for (int i = 1; i < argc; i += 2)
+    {
+        try
+        {
+            tgui::BinaryThemeLoader::compile(argv[i], argv[i+1]);
+            std::cout << "Compiled " << argv[i] << " into " << argv[i+1] << std::endl;
+        }
+        catch (const tgui::Exception& e)
+        {
+            std::cerr << "Failed to compile " << argv[i] << ": " << e.what() << std::endl;
+            return 1;
+        }
+    }
+
+    return 0;
+}
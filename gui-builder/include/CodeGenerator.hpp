@@ -0,0 +1,71 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_GUI_BUILDER_CODE_GENERATOR_HPP
+#define TGUI_GUI_BUILDER_CODE_GENERATOR_HPP
+
+#include "WidgetProperties/WidgetProperties.hpp"
+#include <TGUI/TGUI.hpp>
+#include <memory>
+#include <string>
+#include <set>
+#include <map>
+
+// Generates a C++ header that constructs the widgets of a form directly, without loading the form file at runtime.
+// Only properties that differ from those of a newly created widget are written to the generated code.
+class CodeGenerator
+{
+public:
+    CodeGenerator(const std::map<std::string, std::unique_ptr<WidgetProperties>>& widgetProperties);
+    std::string generate(const std::string& formFilename, const std::vector<tgui::Widget::Ptr>& widgets);
+
+private:
+
+    struct GeneratedWidget
+    {
+        std::string type;
+        std::string variableName;
+    };
+
+    void generateWidget(const tgui::Widget::Ptr& widget, const std::string& parent, std::string& code);
+    void generateProperties(const tgui::Widget::Ptr& widget, const std::string& variableName, std::string& code);
+    std::string createVariableName(const std::string& widgetName);
+
+    std::string toCode(const tgui::Widget::Ptr& widget, const std::string& property, const std::string& type, const std::string& value);
+    std::string textToCode(const sf::String& text);
+    std::string utf8ToCode(const std::string& str);
+
+    static std::string layoutToCode(const std::string& layout);
+    static std::string floatToCode(const std::string& value);
+    static std::string stringToCode(const std::string& str);
+
+private:
+    const std::map<std::string, std::unique_ptr<WidgetProperties>>& m_widgetProperties;
+    std::vector<GeneratedWidget> m_generatedWidgets;
+    std::set<std::string> m_usedVariableNames;
+    bool m_utf8HelperNeeded = false;
+};
+
+#endif // TGUI_GUI_BUILDER_CODE_GENERATOR_HPP
@@ -101,6 +101,7 @@ private:
     void menuBarCallbackLoadForm();
     void menuBarCallbackLoadRecent(const sf::String& filename);
     void menuBarCallbackSaveFile();
+    void menuBarCallbackExportCode();
     void menuBarCallbackQuit();
     void menuBarCallbackEditThemes();
     void menuBarCallbackBringWidgetToFront();
@@ -46,7 +46,7 @@ struct ButtonProperties : WidgetProperties
     {
         auto pair = WidgetProperties::initProperties(widget);
         auto button = std::dynamic_pointer_cast<tgui::Button>(widget);
-        pair.first["Text"] = {"String", button->getText()};
+        pair.first["Text"] = {"String", toUtf8(button->getText())};
         pair.first["TextSize"] = {"UInt", tgui::to_string(button->getTextSize())};
 
         const auto renderer = button->getSharedRenderer();
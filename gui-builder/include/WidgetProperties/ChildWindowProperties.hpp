@@ -64,7 +64,7 @@ struct ChildWindowProperties : WidgetProperties
         auto childWindow = std::dynamic_pointer_cast<tgui::ChildWindow>(widget);
         pair.first["TitleAlignment"] = {"Enum{Left,Center,Right}", serializeTitleAlignment(childWindow->getTitleAlignment())};
         pair.first["TitleButtons"] = {"ChildWindowTitleButtons", serializeTitleButtons(childWindow->getTitleButtons())};
-        pair.first["Title"] = {"String", childWindow->getTitle()};
+        pair.first["Title"] = {"String", toUtf8(childWindow->getTitle())};
         pair.first["KeepInParent"] = {"Bool", tgui::Serializer::serialize(childWindow->isKeptInParent())};
         pair.first["Resizable"] = {"Bool", tgui::Serializer::serialize(childWindow->isResizable())};
         pair.first["PositionLocked"] = {"Bool", tgui::Serializer::serialize(childWindow->isPositionLocked())};
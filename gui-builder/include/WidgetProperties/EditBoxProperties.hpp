@@ -62,8 +62,8 @@ struct EditBoxProperties : WidgetProperties
     {
         auto pair = WidgetProperties::initProperties(widget);
         auto editBox = std::dynamic_pointer_cast<tgui::EditBox>(widget);
-        pair.first["Text"] = {"String", editBox->getText()};
-        pair.first["DefaultText"] = {"String", editBox->getDefaultText()};
+        pair.first["Text"] = {"String", toUtf8(editBox->getText())};
+        pair.first["DefaultText"] = {"String", toUtf8(editBox->getDefaultText())};
         pair.first["TextSize"] = {"UInt", tgui::to_string(editBox->getTextSize())};
         pair.first["PasswordCharacter"] = {"Char", editBox->getPasswordCharacter() ? std::string(1, editBox->getPasswordCharacter()) : ""};
         pair.first["MaximumCharacters"] = {"UInt", tgui::to_string(editBox->getMaximumCharacters())};
@@ -71,7 +71,7 @@ struct EditBoxProperties : WidgetProperties
         pair.first["LimitTextWidth"] = {"Bool", tgui::Serializer::serialize(editBox->isTextWidthLimited())};
         pair.first["ReadOnly"] = {"Bool", tgui::Serializer::serialize(editBox->isReadOnly())};
         pair.first["InputValidator"] = {"EditBoxInputValidator", editBox->getInputValidator()};
-        pair.first["Suffix"] = {"String", editBox->getSuffix()};
+        pair.first["Suffix"] = {"String", toUtf8(editBox->getSuffix())};
 
         const auto renderer = editBox->getSharedRenderer();
         pair.second["Borders"] = {"Outline", renderer->getBorders().toString()};
@@ -57,7 +57,7 @@ struct ProgressBarProperties : WidgetProperties
         pair.first["Minimum"] = {"UInt", tgui::to_string(progressBar->getMinimum())};
         pair.first["Maximum"] = {"UInt", tgui::to_string(progressBar->getMaximum())};
         pair.first["Value"] = {"UInt", tgui::to_string(progressBar->getValue())};
-        pair.first["Text"] = {"String", progressBar->getText()};
+        pair.first["Text"] = {"String", toUtf8(progressBar->getText())};
         pair.first["TextSize"] = {"UInt", tgui::to_string(progressBar->getTextSize())};
         pair.first["FillDirection"] = {"Enum{LeftToRight,RightToLeft,TopToBottom,BottomToTop}", serializeFillDirection(progressBar->getFillDirection())};
 
@@ -51,7 +51,7 @@ struct RadioButtonProperties : WidgetProperties
         auto pair = WidgetProperties::initProperties(widget);
         auto radioButton = std::dynamic_pointer_cast<tgui::RadioButton>(widget);
         pair.first["Checked"] = {"Bool", tgui::Serializer::serialize(radioButton->isChecked())};
-        pair.first["Text"] = {"String", radioButton->getText()};
+        pair.first["Text"] = {"String", toUtf8(radioButton->getText())};
         pair.first["TextSize"] = {"UInt", tgui::to_string(radioButton->getTextSize())};
         pair.first["TextClickable"] = {"Bool", tgui::Serializer::serialize(radioButton->isTextClickable())};
 
@@ -89,6 +89,13 @@ struct WidgetProperties
     }
 
 
+    // Text properties are stored as UTF-8, so that characters outside the ASCII range aren't lost
+    static std::string toUtf8(const sf::String& str)
+    {
+        const auto utf8 = str.toUtf8();
+        return {utf8.begin(), utf8.end()};
+    }
+
     static bool parseBoolean(std::string str, bool defaultValue)
     {
         str = tgui::toLower(tgui::trim(str));
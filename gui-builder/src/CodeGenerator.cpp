@@ -0,0 +1,555 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "CodeGenerator.hpp"
+
+#include <algorithm>
+#include <cctype> // isalnum, isdigit, toupper
+#include <cstdlib> // strtof
+
+namespace
+{
+    const std::string INDENT = "        ";
+
+    // Properties that have to be set before the others (e.g. the maximum has to be known before the value can be set)
+    const std::vector<std::string> EARLY_PROPERTIES = {"Minimum", "Maximum", "ViewportSize", "MaximumItems", "Items", "Tabs"};
+
+    // Properties that are stored as two separate values in the gui builder but that are set with a single function
+    const std::map<std::string, std::pair<std::string, std::string>> VECTOR_PROPERTIES = {
+        {"MinimumWidth", {"MinimumHeight", "setMinimumSize"}},
+        {"MaximumWidth", {"MaximumHeight", "setMaximumSize"}},
+        {"ContentWidth", {"ContentHeight", "setContentSize"}}
+    };
+
+    // Properties of which the setter doesn't start with "set"
+    const std::map<std::string, std::string> SETTER_NAMES = {
+        {"LimitTextWidth", "limitTextWidth"},
+        {"IgnoreMouseEvents", "ignoreMouseEvents"}
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool isNumber(const std::string& str)
+    {
+        // Strings like "inf" are also accepted by strtof but can't be written as a literal
+        if (str.empty() || (str.find_first_not_of("0123456789.eE+-") != std::string::npos))
+            return false;
+
+        char* end;
+        std::strtof(str.c_str(), &end);
+        return (end == str.c_str() + str.length());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string escape(const std::string& str)
+    {
+        std::string result;
+        for (const char c : str)
+        {
+            if (c == '\\')
+                result += "\\\\";
+            else if (c == '"')
+                result += "\\\"";
+            else if (c == '\n')
+                result += "\\n";
+            else if (c == '\t')
+                result += "\\t";
+            else if ((static_cast<unsigned char>(c) < 0x20) || (static_cast<unsigned char>(c) >= 0x7F))
+            {
+                // Always use three octal digits, so that the next character can't be interpreted as part of the escape sequence
+                const unsigned int value = static_cast<unsigned char>(c);
+                result += "\\";
+                result += static_cast<char>('0' + ((value >> 6) & 7));
+                result += static_cast<char>('0' + ((value >> 3) & 7));
+                result += static_cast<char>('0' + (value & 7));
+            }
+            else
+                result += c;
+        }
+
+        return result;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string toIdentifier(const std::string& str)
+    {
+        std::string identifier;
+        for (const char c : str)
+        {
+            if (std::isalnum(static_cast<unsigned char>(c)) || (c == '_'))
+                identifier += c;
+            else
+                identifier += '_';
+        }
+
+        if (!identifier.empty() && std::isdigit(static_cast<unsigned char>(identifier[0])))
+            identifier = "_" + identifier;
+
+        return identifier;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string rectToCode(const sf::IntRect& rect)
+    {
+        return "sf::IntRect{" + tgui::to_string(rect.left) + ", " + tgui::to_string(rect.top) + ", "
+                              + tgui::to_string(rect.width) + ", " + tgui::to_string(rect.height) + "}";
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CodeGenerator::CodeGenerator(const std::map<std::string, std::unique_ptr<WidgetProperties>>& widgetProperties) :
+    m_widgetProperties{widgetProperties}
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::string CodeGenerator::generate(const std::string& formFilename, const std::vector<tgui::Widget::Ptr>& widgets)
+{
+    m_generatedWidgets.clear();
+    m_usedVariableNames = {"create", "parent", "gui", "fromUtf8"};
+    m_utf8HelperNeeded = false;
+
+    std::string createCode;
+    for (const auto& widget : widgets)
+        generateWidget(widget, "parent.", createCode);
+
+    // The name of the struct is based on the filename of the form (without path and extension)
+    std::string formName = formFilename;
+    const auto slashPos = formName.find_last_of("/\\");
+    if (slashPos != std::string::npos)
+        formName.erase(0, slashPos + 1);
+    const auto dotPos = formName.find_last_of('.');
+    if ((dotPos != std::string::npos) && (dotPos > 0))
+        formName.erase(dotPos);
+
+    std::string structName = toIdentifier(formName);
+    if (structName.empty() || (structName[0] == '_'))
+        structName = "Form" + structName;
+    structName[0] = static_cast<char>(std::toupper(static_cast<unsigned char>(structName[0])));
+
+    std::string includeGuard;
+    for (const char c : structName)
+        includeGuard += static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    includeGuard += "_HPP";
+
+    std::string code;
+    code += "// This file was generated by the TGUI gui builder from \"" + escape(formFilename) + "\".\n";
+    code += "// Changes made to this file will be lost when the form is exported again.\n";
+    code += "\n";
+    code += "#ifndef " + includeGuard + "\n";
+    code += "#define " + includeGuard + "\n";
+    code += "\n";
+    code += "#include <TGUI/TGUI.hpp>\n";
+    code += "#include <limits>\n";
+    code += "\n";
+    code += "struct " + structName + "\n";
+    code += "{\n";
+    for (const auto& generatedWidget : m_generatedWidgets)
+        code += "    tgui::" + generatedWidget.type + "::Ptr " + generatedWidget.variableName + ";\n";
+    if (!m_generatedWidgets.empty())
+        code += "\n";
+    if (m_utf8HelperNeeded)
+    {
+        code += "    static sf::String fromUtf8(const std::string& str)\n";
+        code += "    {\n";
+        code += "        return sf::String::fromUtf8(str.begin(), str.end());\n";
+        code += "    }\n";
+        code += "\n";
+    }
+    code += "    void create(tgui::Container& parent)\n";
+    code += "    {\n";
+    if (!createCode.empty())
+        code += createCode.substr(1); // Skip the empty line in front of the first widget
+    code += "    }\n";
+    code += "\n";
+    code += "    void create(tgui::Gui& gui)\n";
+    code += "    {\n";
+    code += "        create(*gui.getContainer());\n";
+    code += "    }\n";
+    code += "};\n";
+    code += "\n";
+    code += "#endif // " + includeGuard + "\n";
+    return code;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void CodeGenerator::generateWidget(const tgui::Widget::Ptr& widget, const std::string& parent, std::string& code)
+{
+    const std::string type = widget->getWidgetType();
+    if (m_widgetProperties.find(type) == m_widgetProperties.end())
+    {
+        std::cout << "Widget of type '" << type << "' is not supported by the code generator and will be skipped" << std::endl;
+        return;
+    }
+
+    const std::string variableName = createVariableName(widget->getWidgetName());
+    m_generatedWidgets.push_back({type, variableName});
+
+    code += "\n";
+    code += INDENT + variableName + " = tgui::" + type + "::create();\n";
+    generateProperties(widget, variableName, code);
+
+    const auto container = std::dynamic_pointer_cast<tgui::Container>(widget);
+    if (container)
+    {
+        for (const auto& childWidget : container->getWidgets())
+            generateWidget(childWidget, variableName + "->", code);
+    }
+
+    code += INDENT + parent + "add(" + variableName + ", " + stringToCode(widget->getWidgetName()) + ");\n";
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void CodeGenerator::generateProperties(const tgui::Widget::Ptr& widget, const std::string& variableName, std::string& code)
+{
+    const auto& widgetProperties = *m_widgetProperties.at(widget->getWidgetType());
+    const auto properties = widgetProperties.initProperties(widget);
+    const auto defaultProperties = widgetProperties.initProperties(tgui::WidgetFactory::getConstructFunction(widget->getWidgetType())());
+
+    const auto isDefault = [](const PropertyValueMap& values, const PropertyValueMap& defaultValues, const std::string& property){
+        const auto it = defaultValues.find(property);
+        return (it != defaultValues.end()) && (it->second.second == values.at(property).second);
+    };
+
+    const auto& values = properties.first;
+    const auto& defaultValues = defaultProperties.first;
+    if ((values.at("Left").second != "0") || (values.at("Top").second != "0"))
+    {
+        code += INDENT + variableName + "->setPosition(" + layoutToCode(values.at("Left").second)
+                                                 + ", " + layoutToCode(values.at("Top").second) + ");\n";
+    }
+
+    // Setting the size would disable the auto-size of a label
+    const auto autoSizeIt = values.find("AutoSize");
+    const bool autoSize = (autoSizeIt != values.end()) && WidgetProperties::parseBoolean(autoSizeIt->second.second, false);
+    if (!autoSize && (!isDefault(values, defaultValues, "Width") || !isDefault(values, defaultValues, "Height")))
+    {
+        code += INDENT + variableName + "->setSize(" + layoutToCode(values.at("Width").second)
+                                             + ", " + layoutToCode(values.at("Height").second) + ");\n";
+    }
+
+    std::vector<std::string> propertyOrder;
+    for (const auto& property : EARLY_PROPERTIES)
+    {
+        if (values.find(property) != values.end())
+            propertyOrder.push_back(property);
+    }
+    for (const auto& pair : values)
+    {
+        if ((pair.first != "Left") && (pair.first != "Top") && (pair.first != "Width") && (pair.first != "Height")
+         && (std::find(EARLY_PROPERTIES.begin(), EARLY_PROPERTIES.end(), pair.first) == EARLY_PROPERTIES.end()))
+        {
+            propertyOrder.push_back(pair.first);
+        }
+    }
+
+    for (const auto& property : propertyOrder)
+    {
+        const std::string& type = values.at(property).first;
+        const std::string& value = values.at(property).second;
+
+        const auto vectorPropertyIt = VECTOR_PROPERTIES.find(property);
+        if (vectorPropertyIt != VECTOR_PROPERTIES.end())
+        {
+            const std::string& secondProperty = vectorPropertyIt->second.first;
+            if (isDefault(values, defaultValues, property) && isDefault(values, defaultValues, secondProperty))
+                continue;
+
+            code += INDENT + variableName + "->" + vectorPropertyIt->second.second + "({"
+                + toCode(widget, property, type, value) + ", "
+                + toCode(widget, secondProperty, values.at(secondProperty).first, values.at(secondProperty).second) + "});\n";
+            continue;
+        }
+
+        if (isDefault(values, defaultValues, property))
+            continue;
+
+        if ((property == "MinimumHeight") || (property == "MaximumHeight") || (property == "ContentHeight"))
+            continue; // Already written together with the width
+        else if (property == "Items")
+        {
+            for (const auto& item : WidgetProperties::deserializeList(value))
+                code += INDENT + variableName + "->addItem(" + textToCode(item) + ");\n";
+        }
+        else if (property == "Tabs")
+        {
+            for (const auto& tab : WidgetProperties::deserializeList(value))
+                code += INDENT + variableName + "->add(" + textToCode(tab) + ", false);\n";
+        }
+        else if ((property == "Selected") || (property == "SelectedItemIndex"))
+        {
+            if (tgui::strToInt(value, -1) >= 0)
+                code += INDENT + variableName + "->" + ((property == "Selected") ? "select" : "setSelectedItemByIndex") + "(" + value + ");\n";
+        }
+        else if (property == "UserData")
+        {
+            if (!value.empty())
+                code += INDENT + variableName + "->setUserData(std::string(" + stringToCode(value) + "));\n";
+        }
+        else
+        {
+            const auto setterIt = SETTER_NAMES.find(property);
+            const std::string setter = (setterIt != SETTER_NAMES.end()) ? setterIt->second : "set" + property;
+            code += INDENT + variableName + "->" + setter + "(" + toCode(widget, property, type, value) + ");\n";
+        }
+    }
+
+    // The renderer properties are written as the changes compared to the default renderer
+    for (const auto& pair : properties.second)
+    {
+        if (isDefault(properties.second, defaultProperties.second, pair.first))
+            continue;
+
+        code += INDENT + variableName + "->getRenderer()->set" + pair.first + "("
+            + toCode(widget, pair.first, pair.second.first, pair.second.second) + ");\n";
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::string CodeGenerator::createVariableName(const std::string& widgetName)
+{
+    std::string baseName = toIdentifier(widgetName);
+    if (baseName.empty())
+        baseName = "widget";
+
+    std::string name = baseName;
+    unsigned int count = 1;
+    while (m_usedVariableNames.find(name) != m_usedVariableNames.end())
+        name = baseName + "_" + tgui::to_string(++count);
+
+    m_usedVariableNames.insert(name);
+    return name;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::string CodeGenerator::toCode(const tgui::Widget::Ptr& widget, const std::string& property, const std::string& type, const std::string& value)
+{
+    if (type == "Bool")
+        return WidgetProperties::parseBoolean(value, false) ? "true" : "false";
+    else if (type == "Int")
+        return tgui::to_string(tgui::strToInt(value));
+    else if (type == "UInt")
+        return tgui::to_string(tgui::strToInt(value)) + "u";
+    else if (type == "Float")
+        return floatToCode(value);
+    else if (type == "MultilineString")
+        return textToCode(tgui::Deserializer::deserialize(tgui::ObjectConverter::Type::String, value).getString());
+    else if (type == "Char")
+    {
+        if (value.empty())
+            return "'\\0'";
+        else if (value[0] == '\'')
+            return "'\\''";
+        else
+            return "'" + escape(value.substr(0, 1)) + "'";
+    }
+    else if (type == "Color")
+    {
+        if (value.empty() || (tgui::toLower(tgui::trim(value)) == "none"))
+            return "tgui::Color{}";
+
+        const tgui::Color color = tgui::Deserializer::deserialize(tgui::ObjectConverter::Type::Color, value).getColor();
+        return "tgui::Color{" + tgui::to_string(static_cast<unsigned int>(color.getRed()))
+                      + ", " + tgui::to_string(static_cast<unsigned int>(color.getGreen()))
+                      + ", " + tgui::to_string(static_cast<unsigned int>(color.getBlue()))
+                      + ", " + tgui::to_string(static_cast<unsigned int>(color.getAlpha())) + "}";
+    }
+    else if (type == "Outline")
+    {
+        std::string outline = tgui::trim(value);
+        if (!outline.empty() && (outline.front() == '('))
+            outline.erase(0, 1);
+        if (!outline.empty() && (outline.back() == ')'))
+            outline.pop_back();
+
+        std::string code = "tgui::Outline{";
+        const auto parts = tgui::Deserializer::split(outline, ',');
+        for (std::size_t i = 0; i < parts.size(); ++i)
+        {
+            if (i > 0)
+                code += ", ";
+
+            if (isNumber(parts[i]))
+                code += floatToCode(parts[i]);
+            else // Relative value (e.g. "10%")
+                code += stringToCode(parts[i]);
+        }
+
+        return code + "}";
+    }
+    else if (type == "Texture")
+    {
+        const tgui::Texture texture = tgui::Deserializer::deserialize(tgui::ObjectConverter::Type::Texture, value).getTexture();
+        if (texture.getId().isEmpty())
+            return "tgui::Texture{}";
+
+        // The part and middle rectangles are only written when they were specified, just like when serializing the texture
+        std::string partRect = "{}";
+        const auto& data = texture.getData();
+        if ((data->rect != sf::IntRect{}) && data->alphaMask
+         && (data->rect != sf::IntRect{0, 0, static_cast<int>(data->alphaMask->getSize().x), static_cast<int>(data->alphaMask->getSize().y)}))
+        {
+            partRect = rectToCode(data->rect);
+        }
+
+        std::string middleRect = "{}";
+        if (texture.getMiddleRect() != sf::IntRect{0, 0, static_cast<int>(data->texture.getSize().x), static_cast<int>(data->texture.getSize().y)})
+            middleRect = rectToCode(texture.getMiddleRect());
+
+        return "tgui::Texture{" + textToCode(texture.getId()) + ", " + partRect + ", " + middleRect
+            + ", " + (texture.isSmooth() ? "true" : "false") + "}";
+    }
+    else if (type == "TextStyle")
+    {
+        std::string styles;
+        for (const auto& style : tgui::Deserializer::split(value, '|'))
+        {
+            if (!styles.empty())
+                styles += " | ";
+            styles += "sf::Text::" + tgui::trim(style);
+        }
+
+        if (styles.empty())
+            styles = "sf::Text::Regular";
+
+        return "tgui::TextStyle(" + styles + ")";
+    }
+    else if (type == "Font")
+    {
+        if (value.empty() || (tgui::toLower(tgui::trim(value)) == "null"))
+            return "nullptr";
+
+        // The font is loaded from a file, of which the name is passed as UTF-8 bytes
+        const auto filename = tgui::Deserializer::deserialize(tgui::ObjectConverter::Type::String, value).getString().toUtf8();
+        return "tgui::Font{" + stringToCode(std::string(filename.begin(), filename.end())) + "}";
+    }
+    else if (type == "ChildWindowTitleButtons")
+    {
+        std::string titleButtons;
+        for (const auto& button : tgui::Deserializer::split(value, '|'))
+        {
+            const std::string buttonName = tgui::toLower(tgui::trim(button));
+            std::string code;
+            if (buttonName == "close")
+                code = "tgui::ChildWindow::TitleButton::Close";
+            else if (buttonName == "maximize")
+                code = "tgui::ChildWindow::TitleButton::Maximize";
+            else if (buttonName == "minimize")
+                code = "tgui::ChildWindow::TitleButton::Minimize";
+            else
+                continue;
+
+            if (!titleButtons.empty())
+                titleButtons += " | ";
+            titleButtons += code;
+        }
+
+        if (titleButtons.empty())
+            return "tgui::ChildWindow::TitleButton::None";
+        else
+            return titleButtons;
+    }
+    else if (type.substr(0, 4) == "Enum")
+    {
+        // All scrollbar policies use the same enum, other enums are defined inside the widget with the name of the property
+        const std::string suffix = "ScrollbarPolicy";
+        if ((property.length() >= suffix.length()) && (property.compare(property.length() - suffix.length(), suffix.length(), suffix) == 0))
+            return "tgui::Scrollbar::Policy::" + tgui::trim(value);
+        else
+            return "tgui::" + widget->getWidgetType() + "::" + property + "::" + tgui::trim(value);
+    }
+    else if (type == "String")
+        return utf8ToCode(value);
+    else // EditBoxInputValidator and types that have no special code
+        return stringToCode(value);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::string CodeGenerator::textToCode(const sf::String& text)
+{
+    const auto utf8 = text.toUtf8();
+    return utf8ToCode(std::string(utf8.begin(), utf8.end()));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::string CodeGenerator::utf8ToCode(const std::string& str)
+{
+    // A narrow string literal would be decoded with the locale of the user when it is converted to sf::String,
+    // so text with characters outside the ASCII range is converted from UTF-8 at runtime instead
+    if (std::all_of(str.begin(), str.end(), [](char c){ return static_cast<unsigned char>(c) < 0x80; }))
+        return stringToCode(str);
+
+    m_utf8HelperNeeded = true;
+    return "fromUtf8(" + stringToCode(str) + ")";
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::string CodeGenerator::layoutToCode(const std::string& layout)
+{
+    // Constant layouts are written as numbers, layouts that depend on the parent or other widgets are parsed at runtime
+    if (!isNumber(layout))
+        return stringToCode(layout);
+
+    if (layout.find_first_of(".eE") != std::string::npos)
+        return layout + "f";
+    else
+        return layout;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::string CodeGenerator::floatToCode(const std::string& value)
+{
+    const std::string number = tgui::trim(value);
+    if (number == "inf")
+        return "std::numeric_limits<float>::infinity()";
+    else if (number == "-inf")
+        return "-std::numeric_limits<float>::infinity()";
+    else if (number.find_first_of(".eE") != std::string::npos)
+        return number + "f";
+    else
+        return number + ".f";
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::string CodeGenerator::stringToCode(const std::string& str)
+{
+    return "\"" + escape(str) + "\"";
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -46,6 +46,7 @@
 #include "WidgetProperties/TextBoxProperties.hpp"
 #include "WidgetProperties/TreeViewProperties.hpp"
 #include "GuiBuilder.hpp"
+#include "CodeGenerator.hpp"
 
 #include <fstream>
 #include <cassert>
@@ -85,7 +86,7 @@ namespace
 #endif
     }
 
-    bool compareRenderers(std::map<std::string, tgui::ObjectConverter> themePropertyValuePairs, std::map<std::string, tgui::ObjectConverter> widgetPropertyValuePairs)
+    bool compareRenderers(tgui::PropertyValueMap themePropertyValuePairs, tgui::PropertyValueMap widgetPropertyValuePairs)
     {
         for (auto themeIt = themePropertyValuePairs.begin(); themeIt != themePropertyValuePairs.end(); ++themeIt)
         {
@@ -808,6 +809,7 @@ void GuiBuilder::loadEditingScreen(const std::string& filename)
     m_menuBar->connectMenuItem({"File", "New"}, [this]{ menuBarCallbackNewForm(); });
     m_menuBar->connectMenuItem({"File", "Load"}, [this]{ menuBarCallbackLoadForm(); });
     m_menuBar->connectMenuItem({"File", "Save"}, [this]{ menuBarCallbackSaveFile(); });
+    m_menuBar->connectMenuItem({"File", "Export C++"}, [this]{ menuBarCallbackExportCode(); });
     m_menuBar->connectMenuItem({"File", "Quit"}, [this]{ menuBarCallbackQuit(); });
     m_menuBar->connectMenuItem({"Themes", "Edit"}, [this]{ menuBarCallbackEditThemes(); });
     m_menuBar->connectMenuItem({"Widget", "Bring to front"}, [this]{ menuBarCallbackBringWidgetToFront(); });
@@ -1088,7 +1090,8 @@ void GuiBuilder::addPropertyValueWidgets(float& topPosition, const PropertyValue
     }
     else
     {
-        auto valueEditBox = addPropertyValueEditBox(property, value, onChange, topPosition, 0);
+        // Text properties are stored as UTF-8
+        auto valueEditBox = addPropertyValueEditBox(property, sf::String::fromUtf8(value.begin(), value.end()), onChange, topPosition, 0);
         if (type == "UInt")
             valueEditBox->setInputValidator(tgui::EditBox::Validator::UInt);
         else if (type == "Int")
@@ -2043,6 +2046,38 @@ void GuiBuilder::menuBarCallbackSaveFile()
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void GuiBuilder::menuBarCallbackExportCode()
+{
+    // The code is written next to the form file, with the extension replaced by ".hpp"
+    const std::string formFilename = m_selectedForm->getFilename();
+    std::string filename = formFilename;
+    const auto dotPos = filename.find_last_of('.');
+    if ((dotPos != std::string::npos) && (filename.find_first_of("/\\", dotPos) == std::string::npos))
+        filename.erase(dotPos);
+    filename += ".hpp";
+
+    try
+    {
+        CodeGenerator codeGenerator{m_widgetProperties};
+        const std::string code = codeGenerator.generate(formFilename, m_selectedForm->getRootWidgetsGroup()->getWidgets());
+
+        std::ofstream file{filename};
+        if (!file.is_open())
+        {
+            std::cout << "Failed to open '" << filename << "' for writing" << std::endl;
+            return;
+        }
+
+        file << code;
+    }
+    catch (const tgui::Exception& e)
+    {
+        std::cout << "Exception caught when exporting form: " << e.what() << std::endl;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void GuiBuilder::menuBarCallbackQuit()
 {
     saveGuiBuilderState();
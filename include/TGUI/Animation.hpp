@@ -26,17 +26,12 @@
 #ifndef TGUI_ANIMATION_HPP
 #define TGUI_ANIMATION_HPP
 
-#include <TGUI/Vector2f.hpp>
-#include <SFML/System/Time.hpp>
-#include <functional>
-#include <memory>
+#include <TGUI/Config.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
-    class Widget;
-
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Type of animation to show/hide widget
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -55,99 +50,19 @@ namespace tgui
         SlideFromBottom = SlideToTop  ///< Slide from bottom to show or to the top to hide
     };
 
-    namespace priv
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Curve that determines how fast an animated value changes during the animation
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    enum class EasingType
     {
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-        class TGUI_API Animation
-        {
-        public:
-            enum class Type
-            {
-                None = 0,
-                Move = 1,
-                Resize = 2,
-                Fade = 4
-            };
-
-            // Move constructor has to be explicitly declared since this class has a destructor
-            Animation() = default;
-            Animation(const Animation&) = default;
-            Animation(Animation&&) = default;
-            Animation& operator=(const Animation&) = default;
-            Animation& operator=(Animation&&) = default;
-            virtual ~Animation() = default;
-
-            Type getType() const;
-
-            virtual bool update(sf::Time elapsedTime) = 0;
-            virtual void finish();
-
-        protected:
-            Animation(Type type, std::shared_ptr<Widget> widget, sf::Time duration, std::function<void()> finishedCallback);
-
-        protected:
-            Type m_type = Type::None;
-            std::shared_ptr<Widget> m_widget;
-
-            sf::Time m_totalDuration;
-            sf::Time m_elapsedTime;
-
-            std::function<void()> m_finishedCallback;
-        };
-
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-        class TGUI_API MoveAnimation : public Animation
-        {
-        public:
-            MoveAnimation(std::shared_ptr<Widget> widget, Vector2f start, Vector2f end, sf::Time duration, std::function<void()> finishedCallback = nullptr);
-
-            bool update(sf::Time elapsedTime) override;
-
-            void finish() override;
-
-        private:
-            Vector2f m_startPos;
-            Vector2f m_endPos;
-        };
-
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-        class TGUI_API ResizeAnimation : public Animation
-        {
-        public:
-            ResizeAnimation(std::shared_ptr<Widget> widget, Vector2f start, Vector2f end, sf::Time duration, std::function<void()> finishedCallback = nullptr);
-
-            bool update(sf::Time elapsedTime) override;
-
-            void finish() override;
-
-        private:
-            Vector2f m_startSize;
-            Vector2f m_endSize;
-        };
-
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-        class TGUI_API FadeAnimation : public Animation
-        {
-        public:
-            FadeAnimation(std::shared_ptr<Widget> widget, float start, float end, sf::Time duration, std::function<void()> finishedCallback = nullptr);
-
-            bool update(sf::Time elapsedTime) override;
-
-            void finish() override;
-
-        private:
-            float m_startOpacity;
-            float m_endOpacity;
-        };
-
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Linear,    ///< The value changes at a constant speed
+        EaseIn,    ///< The value starts changing slowly and speeds up towards the end
+        EaseOut,   ///< The value starts changing fast and slows down towards the end
+        EaseInOut  ///< The value changes slowly at the start and at the end and fast in the middle
+    };
 
-    } // namespace priv
-} // namespace tgui
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
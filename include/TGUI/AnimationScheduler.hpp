@@ -0,0 +1,273 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_ANIMATION_SCHEDULER_HPP
+#define TGUI_ANIMATION_SCHEDULER_HPP
+
+#include <TGUI/Animation.hpp>
+#include <TGUI/Color.hpp>
+#include <TGUI/Vector2f.hpp>
+#include <SFML/System/Time.hpp>
+#include <array>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Widget;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Plays animations that gradually change properties of widgets
+    ///
+    /// The gui owns a scheduler that plays the animations of all its widgets, including the ones started by showWithEffect
+    /// and hideWithEffect. The active animations are stored next to each other and only those animations are visited when
+    /// the time is updated, so the cost of playing animations doesn't depend on the amount of widgets in the gui.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API AnimationScheduler
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Property of a widget that is changed by an animation
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        enum class Property
+        {
+            Position,     ///< Position of the widget (setPosition)
+            Size,         ///< Size of the widget (setSize)
+            Opacity,      ///< Opacity inherited from the parent (setInheritedOpacity)
+            RendererColor,///< A color property of the renderer of the widget
+            RenderOffset, ///< Offset at which the widget is drawn, without changing its position
+            RenderScale   ///< Scale around its center with which the widget is drawn, without changing its size
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Moves a widget from one position to another
+        ///
+        /// @param widget           Widget to animate
+        /// @param start            Position of the widget at the start of the animation
+        /// @param end              Position of the widget at the end of the animation
+        /// @param duration         How long the animation lasts
+        /// @param easing           Curve that determines how fast the position changes during the animation
+        /// @param finishedCallback Function to call when the animation ends
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void animatePosition(const std::shared_ptr<Widget>& widget, Vector2f start, Vector2f end, sf::Time duration,
+                             EasingType easing = EasingType::Linear, std::function<void()> finishedCallback = nullptr);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Resizes a widget from one size to another
+        ///
+        /// @param widget           Widget to animate
+        /// @param start            Size of the widget at the start of the animation
+        /// @param end              Size of the widget at the end of the animation
+        /// @param duration         How long the animation lasts
+        /// @param easing           Curve that determines how fast the size changes during the animation
+        /// @param finishedCallback Function to call when the animation ends
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void animateSize(const std::shared_ptr<Widget>& widget, Vector2f start, Vector2f end, sf::Time duration,
+                         EasingType easing = EasingType::Linear, std::function<void()> finishedCallback = nullptr);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the inherited opacity of a widget from one value to another
+        ///
+        /// @param widget           Widget to animate
+        /// @param start            Opacity of the widget at the start of the animation, between 0 and 1
+        /// @param end              Opacity of the widget at the end of the animation, between 0 and 1
+        /// @param duration         How long the animation lasts
+        /// @param easing           Curve that determines how fast the opacity changes during the animation
+        /// @param finishedCallback Function to call when the animation ends
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void animateOpacity(const std::shared_ptr<Widget>& widget, float start, float end, sf::Time duration,
+                            EasingType easing = EasingType::Linear, std::function<void()> finishedCallback = nullptr);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes a color in the renderer of a widget from one value to another
+        ///
+        /// @param widget           Widget to animate
+        /// @param property         Name of the renderer property, e.g. "BackgroundColor"
+        /// @param start            Color at the start of the animation
+        /// @param end              Color at the end of the animation
+        /// @param duration         How long the animation lasts
+        /// @param easing           Curve that determines how fast the color changes during the animation
+        /// @param finishedCallback Function to call when the animation ends
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void animateRendererColor(const std::shared_ptr<Widget>& widget, const std::string& property, Color start, Color end, sf::Time duration,
+                                  EasingType easing = EasingType::Linear, std::function<void()> finishedCallback = nullptr);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a widget at an offset from its position that changes from one value to another
+        ///
+        /// @param widget           Widget to animate
+        /// @param start            Offset at the start of the animation
+        /// @param end              Offset at the end of the animation
+        /// @param duration         How long the animation lasts
+        /// @param easing           Curve that determines how fast the offset changes during the animation
+        /// @param finishedCallback Function to call when the animation ends
+        ///
+        /// Only the place where the widget is drawn changes, its position and the layouts that depend on it remain the same.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void animateRenderOffset(const std::shared_ptr<Widget>& widget, Vector2f start, Vector2f end, sf::Time duration,
+                                 EasingType easing = EasingType::Linear, std::function<void()> finishedCallback = nullptr);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a widget scaled around its center with a scale that changes from one value to another
+        ///
+        /// @param widget           Widget to animate
+        /// @param start            Scale at the start of the animation
+        /// @param end              Scale at the end of the animation
+        /// @param duration         How long the animation lasts
+        /// @param easing           Curve that determines how fast the scale changes during the animation
+        /// @param finishedCallback Function to call when the animation ends
+        ///
+        /// Only the way the widget is drawn changes, its size and the layouts that depend on it remain the same.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void animateRenderScale(const std::shared_ptr<Widget>& widget, Vector2f start, Vector2f end, sf::Time duration,
+                                EasingType easing = EasingType::Linear, std::function<void()> finishedCallback = nullptr);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Immediately finishes the animations of a widget that change a given property
+        ///
+        /// @param widget    Widget of which the animations should be finished
+        /// @param property  Property that is being animated
+        ///
+        /// The property is set to its end value and the callback of the animation is called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void finishAnimations(const Widget* widget, Property property);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Immediately finishes all animations of a widget
+        ///
+        /// @param widget  Widget of which the animations should be finished
+        ///
+        /// The properties are set to their end values and the callbacks of the animations are called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void finishAnimations(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Immediately finishes all animations of a widget and of the widgets inside it
+        ///
+        /// @param widget  Widget of which the animations should be finished, together with those of its child widgets
+        ///
+        /// This is called when a widget is removed from its parent, so that the gui doesn't keep animating it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void finishAnimationsInside(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether an animation of the widget is still playing
+        ///
+        /// @param widget  Widget to check
+        ///
+        /// @return Is the widget being animated?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool hasAnimations(const Widget* widget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of animations that are playing
+        ///
+        /// @return Number of active animations
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getAnimationCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Progresses all active animations
+        ///
+        /// @param elapsedTime  Time passed since the last call to this function
+        ///
+        /// Animations of widgets that no longer exist are removed without calling their callback.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void update(sf::Time elapsedTime);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calculates how far an animation has progressed
+        ///
+        /// @param easing  Curve used by the animation
+        /// @param ratio   Part of the duration of the animation that has passed, between 0 and 1
+        ///
+        /// @return Part of the change in value that has to be applied, 0 at the start and 1 at the end of the animation
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static float applyEasing(EasingType easing, float ratio);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        using Values = std::array<float, 4>;
+
+        // Adds an animation at the end of the arrays
+        void addAnimation(const std::shared_ptr<Widget>& widget, Property property, const std::string& rendererProperty,
+                          const Values& start, const Values& end, sf::Time duration, EasingType easing, std::function<void()> finishedCallback);
+
+        // Changes the property of the widget to the value at the given progress of the animation
+        void applyValue(Widget& widget, std::size_t index, float progress);
+
+        // Applies the end value of the animation, marks it as finished and calls its callback
+        void finishAnimation(Widget& widget, std::size_t index);
+
+        // Removes the finished animations and the animations of destroyed widgets from the arrays
+        void removeFinishedAnimations();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Every animation is stored at the same index in each of these arrays.
+        // A finished animation has an empty widget pointer until it gets removed.
+        std::vector<std::weak_ptr<Widget>> m_widgets;
+        std::vector<Property> m_properties;
+        std::vector<Values> m_startValues;
+        std::vector<Values> m_endValues;
+        std::vector<float> m_elapsedTimes;
+        std::vector<float> m_durations;
+        std::vector<EasingType> m_easings;
+        std::vector<std::string> m_rendererProperties;
+        std::vector<std::function<void()>> m_finishedCallbacks;
+
+        // Animations are only marked as finished while updating, they are removed from the arrays once the update is done
+        bool m_updating = false;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_ANIMATION_SCHEDULER_HPP
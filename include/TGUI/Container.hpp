@@ -28,6 +28,7 @@
 
 
 #include <list>
+#include <unordered_map>
 
 #include <TGUI/Widget.hpp>
 
@@ -101,6 +102,27 @@ namespace tgui
         ///
         /// @return Vector of all widget pointers
         ///
+        /// When the container was loaded while hidden and lazy loading is enabled (see setLazyLoadingOfHiddenContainers),
+        /// the child widgets are created by this call.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<Widget::Ptr>& getWidgets()
+        {
+            if (!m_pendingWidgetNodes.empty())
+                loadPendingWidgets();
+
+            return m_widgets;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a list of all the widgets in this container
+        ///
+        /// @return Vector of all widget pointers
+        ///
+        /// A const container can't create its child widgets, so when it was loaded while hidden with lazy loading enabled
+        /// (see setLazyLoadingOfHiddenContainers), the widgets that haven't been created yet aren't part of the list.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         const std::vector<Widget::Ptr>& getWidgets() const
         {
@@ -145,8 +167,31 @@ namespace tgui
         /// The container will first search for widgets that are direct children of it, but when none of the child widgets match
         /// the given name, a recursive search will be performed.
         ///
+        /// The container keeps track of the names of all widgets below it, so the search only descends into child containers
+        /// that contain the name and an unknown name is rejected immediately. The result is cached until a widget with the same
+        /// name is added, removed or renamed or the order of widgets changes.
+        ///
         /// @return Pointer to the earlier added widget
         ///
+        /// When the widget belongs to a hidden container that was loaded with lazy loading enabled (see
+        /// setLazyLoadingOfHiddenContainers), the widgets of that container are created by this call.
+        ///
+        /// @warning This function will return nullptr when an unknown widget name was passed
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr get(const sf::String& widgetName);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a pointer to a widget that was added earlier
+        ///
+        /// @param widgetName The name that was given to the widget when it was added to the container
+        ///
+        /// @return Pointer to the earlier added widget
+        ///
+        /// Unlike the non-const version, this function won't find the widgets of this container that haven't been created yet
+        /// because the container was loaded while hidden with lazy loading enabled (see setLazyLoadingOfHiddenContainers).
+        ///
         /// @warning This function will return nullptr when an unknown widget name was passed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -168,6 +213,27 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         template <class T>
+        typename T::Ptr get(const sf::String& widgetName)
+        {
+            return std::dynamic_pointer_cast<T>(get(widgetName));
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a pointer to a widget that was added earlier
+        ///
+        /// @param widgetName The name that was given to the widget when it was added to the container
+        ///
+        /// @return Pointer to the earlier added widget.
+        ///         The pointer will already be casted to the desired type
+        ///
+        /// Unlike the non-const version, this function won't find the widgets of this container that haven't been created yet
+        /// because the container was loaded while hidden with lazy loading enabled (see setLazyLoadingOfHiddenContainers).
+        ///
+        /// @warning This function will return nullptr when an unknown widget name was passed
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <class T>
         typename T::Ptr get(const sf::String& widgetName) const
         {
             return std::dynamic_pointer_cast<T>(get(widgetName));
@@ -252,7 +318,18 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Loads the child widgets from a text file
+        /// @brief Shows or hides the container
+        ///
+        /// @param visible  Is the container visible?
+        ///
+        /// Child widgets whose creation was delayed because of setLazyLoadingOfHiddenContainers are created when the container
+        /// becomes visible.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVisible(bool visible) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the child widgets from a text or binary file
         ///
         /// @param filename  Filename of the widget file
         /// @param replaceExisting  Remove existing widgets first if there are any
@@ -263,11 +340,12 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Saves the child widgets to a text file
+        /// @brief Saves the child widgets to a file
         /// @param filename  Filename of the widget file
+        /// @param binary    Save the widgets in the binary format instead of as text
         /// @throw Exception when file could not be opened for writing
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void saveWidgetsToFile(const std::string& filename);
+        void saveWidgetsToFile(const std::string& filename, bool binary = false);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -289,11 +367,12 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Saves the child widgets to a text file
+        /// @brief Saves the child widgets to a stream
         ///
         /// @param stream  stringstream to which the widget file will be added
+        /// @param binary  Save the widgets in the binary format instead of as text
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void saveWidgetsToStream(std::stringstream& stream) const;
+        void saveWidgetsToStream(std::stringstream& stream, bool binary = false) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -314,6 +393,33 @@ namespace tgui
         void moveWidgetToBack(const Widget::Ptr& widget);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether a spatial index is used to find the widget below the mouse
+        ///
+        /// @param enabled  Should the child widgets be stored in a grid based on their bounds?
+        ///
+        /// Without the index, every mouse event checks the child widgets one by one, from the front to the back.
+        /// With the index, only the widgets that overlap with the grid cell below the mouse are checked. This helps with
+        /// containers that hold many widgets, e.g. a panel filled with thousands of tiles. For a container with only a few
+        /// widgets the bookkeeping costs more than what it saves.
+        ///
+        /// The grid is updated when the position or size of a child widget changes. A widget is stored in the index based on
+        /// its full size. Children that react to the mouse outside that area (see Widget::canBeHitOutsideBounds) are always
+        /// checked.
+        ///
+        /// The index is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSpatialIndexEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a spatial index is used to find the widget below the mouse
+        ///
+        /// @return Are the child widgets stored in a grid based on their bounds?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isSpatialIndexEnabled() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Focuses the next widget in this container
         /// @return Whether a new widget was focused
@@ -346,6 +452,32 @@ namespace tgui
         void childWidgetFocused(const Widget::Ptr& child);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called when one of the child widgets of this container is given a different name.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childWidgetNameChanged(Widget* child, const std::string& oldName, const std::string& newName);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Finds the child widget with the given name, without taking the case of the widget names into account.
+        /// This is used to find the widgets that are referred to in layout strings.
+        ///
+        /// @param lowercaseName  Name of the widget, which has to be converted to lowercase already
+        ///
+        /// @return First child widget with the name, or nullptr when no child has this name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget* getChildByLowercaseName(const std::string& lowercaseName);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called when the position, size or another property that may affect the bounds of a child widget changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void childWidgetBoundsChanged(const Widget* child);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -463,6 +595,12 @@ namespace tgui
         virtual void drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states = sf::RenderStates::Default) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws a single child widget, applying the offset and scale of a running transform-only show or hide animation.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawChildWidget(sf::RenderTarget& target, sf::RenderStates states, const Widget& widget) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Find out what the index of the focused widget is. Returns 0 when no widget is focused and index+1 otherwise.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -475,6 +613,90 @@ namespace tgui
         bool tryFocusWidget(const tgui::Widget::Ptr &widget, bool reverseWidgetOrder);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the child widgets from the nodes of a widget file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadChildWidgets(const std::vector<std::unique_ptr<DataIO::Node>>& nodes, const LoadingRenderersMap& renderers);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the widgets from the root node of a parsed widget file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadWidgetsFromNodeTree(const std::unique_ptr<DataIO::Node>& rootNode, bool replaceExisting);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the child widgets of which the creation was delayed while loading the container while it was hidden
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadPendingWidgets();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Takes a copy of the nodes of child widgets of which the creation is delayed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setPendingWidgetNodes(const std::vector<std::unique_ptr<DataIO::Node>>& nodes, const LoadingRenderersMap& renderers);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Has to be called when the order of the widgets in m_widgets is changed without adding or removing widgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void widgetOrderChanged();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Asks the gui to call updateChildLayout during its next layout pass, so that containers that position their children
+        // only have to do so once per frame. Returns false when layout updates aren't deferred (see Gui::setDeferredLayoutUpdatesEnabled),
+        // in which case the caller has to position the child widgets immediately.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool scheduleChildLayoutUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Positions the child widgets, called by the gui during its layout pass after scheduleChildLayoutUpdate returned true
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void updateChildLayout();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes how many widgets with the given name are found below this container and its parents
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void changeWidgetNameCount(const std::string& name, int change);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds or subtracts the name of the widget and the names of all widgets inside it to the name counts
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void changeWidgetNameCounts(const Widget& widget, int change);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calls leftMouseButtonNoLongerDown on the child widget that the left mouse button went down on and on all child
+        // widgets that want to be notified of every mouse release
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void notifyChildrenLeftMouseButtonNoLongerDown();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calls rightMouseButtonNoLongerDown on the child widget that the right mouse button went down on
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void notifyChildrenRightMouseButtonNoLongerDown();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds or removes a child widget that needs leftMouseButtonNoLongerDown to be called on every mouse release.
+        // The parents are informed when this container starts or stops needing the notification itself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addMouseReleaseListener(Widget* child);
+        void removeMouseReleaseListener(Widget* child);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tells the child widgets on which a mouse button went down that the button is no longer down. This is used when the
+        // container is hidden, as the mouse release would otherwise never reach them.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void releaseMouseDownWidgets();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -483,6 +705,18 @@ namespace tgui
         Widget::Ptr m_widgetBelowMouse;
         Widget::Ptr m_focusedWidget;
 
+        // Child widgets on which the left and right mouse buttons went down, they receive mouse moves and releases directly
+        Widget::Ptr m_leftMouseDownWidget;
+        Widget::Ptr m_rightMouseDownWidget;
+
+        // Child widgets that need to know about every left mouse release, or containers that have such widgets inside them
+        std::vector<Widget*> m_mouseReleaseListeners;
+
+        // Widget that owns this container without being its parent (the SubwidgetContainer that contains it). It is registered
+        // as mouse release listener in its own parent when this container has listeners, and the updates that widgets inside
+        // this container schedule are scheduled for it instead.
+        Widget* m_ownerWidget = nullptr;
+
         Vector2f m_prevInnerSize;
 
         // Did we enter handleEvent directly or because we got a MouseReleased event?
@@ -491,8 +725,29 @@ namespace tgui
         // Does focusing the next widget always keep a widget from this container focused (e.g. in a ChildWindow)?
         bool m_isolatedFocus = false;
 
+        // Nodes of child widgets that haven't been created yet because the container was hidden when it was loaded
+        std::vector<std::unique_ptr<DataIO::Node>> m_pendingWidgetNodes;
+        LoadingRenderersMap m_pendingWidgetRenderers;
+
+        // Number of widgets with each name below this container (including pending widgets) and the results of earlier searches
+        std::unordered_map<std::string, unsigned int> m_widgetNameCounts;
+        mutable std::unordered_map<std::string, Widget::Ptr> m_widgetNameCache;
+
+        // First child widget with each lowercase name, rebuilt when needed after a child was removed or the order changed
+        mutable std::unordered_map<std::string, Widget*> m_lowercaseChildNames;
+        mutable bool m_lowercaseChildNamesValid = false;
+
+        // Grid of child widgets used to find the widget below the mouse, only exists when enabled
+        struct SpatialIndex;
+        std::unique_ptr<SpatialIndex> m_spatialIndex;
+
+        // Does updateChildLayout still have to be called in the next layout pass of the gui?
+        bool m_childLayoutUpdatePending = false;
+
 
         friend class SubwidgetContainer; // Needs access to save and load functions
+        friend class Widget; // Widget forwards scheduled updates to m_ownerWidget
+        friend class GuiContainer; // Calls updateChildLayout during the deferred layout pass
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -516,6 +771,12 @@ namespace tgui
         GuiContainer();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~GuiContainer();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Doesn't has any effect
         ///
@@ -548,10 +809,77 @@ namespace tgui
         bool mouseOnWidget(Vector2f pos) const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Marks the layouts of the widget and of all widgets that depend on it to be recalculated in the next layout pass.
+        ///
+        /// @return False when layout updates aren't deferred or the widget isn't part of this gui, the layout that changed
+        ///         has to be recalculated immediately in that case.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool scheduleLayoutUpdate(Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Recalculates the layouts of all widgets that were marked by scheduleLayoutUpdate.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateLayouts();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns the scheduler that plays the animations of all widgets inside this gui.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        AnimationScheduler& getAnimationScheduler();
+        const AnimationScheduler& getAnimationScheduler() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Makes sure that update is called on the widget once the given time has passed.
+        /// When the widget already requested an earlier update then this function has no effect.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void scheduleUpdate(Widget* widget, sf::Time delay);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Schedules an update for the widget and its children if they requested one before they were added to this gui.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void scheduleRequestedUpdates(Widget& widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Advances the time of the gui and calls update on the widgets of which the scheduled time has passed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateScheduledWidgets(sf::Time elapsedTime);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns false when no updates are scheduled, otherwise stores the time until the next widget has to be updated.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool getTimeUntilScheduledUpdate(sf::Time& timeUntilUpdate) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns the total time that has been passed to updateScheduledWidgets.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getCurrentTime() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the layouts of the widget after those of the widgets on which they depend
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateWidgetLayouts(Widget& widget);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function does nothing.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -570,6 +898,27 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        // Are changes to layouts only applied in updateLayouts instead of being applied immediately?
+        bool m_deferLayoutUpdates = false;
+
+        // Widgets of which the layouts still have to be recalculated in the next layout pass
+        std::vector<std::weak_ptr<Widget>> m_pendingLayoutWidgets;
+
+        // Animations of the widgets in the gui, which are progressed by the gui instead of by the widgets themselves
+        AnimationScheduler m_animationScheduler;
+
+        // Widgets that requested to be updated, stored as a binary heap with the earliest update time at the front.
+        // An entry is outdated when the widget requested another update time in the meantime.
+        struct ScheduledUpdate
+        {
+            sf::Time time;
+            std::weak_ptr<Widget> widget;
+        };
+        std::vector<ScheduledUpdate> m_scheduledUpdates;
+
+        // Total time that has been passed to updateScheduledWidgets
+        sf::Time m_currentTime;
+
         friend class Gui; // Required to let Gui access protected members from container and Widget
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
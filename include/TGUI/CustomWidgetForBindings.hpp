@@ -45,6 +45,12 @@ namespace tgui
         typedef std::shared_ptr<const CustomWidgetForBindings> ConstPtr; ///< Shared constant widget pointer
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CustomWidgetForBindings();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Creates a new widget
         /// @return The new widget
@@ -167,7 +173,8 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// This function is called every frame with the time passed since the last frame.
+        /// This function is called once after the widget is added to a gui and afterwards whenever implUpdateFunction asked for
+        /// it by calling scheduleUpdate.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void update(sf::Time elapsedTime) override;
 
@@ -178,6 +185,12 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool mouseOnWidget(Vector2f pos) const override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// The mouseOnWidget function is provided by the bindings, so it may return true anywhere.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool canBeHitOutsideBounds() const override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
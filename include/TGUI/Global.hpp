@@ -88,6 +88,48 @@ namespace tgui
     TGUI_API unsigned int getDoubleClickTime();
 
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Changes whether hidden containers delay creating their child widgets when loading widgets from a file
+    ///
+    /// @param lazy  Should the children of invisible containers only be created when they are needed?
+    ///
+    /// When enabled, a container (e.g. a ChildWindow or Panel) that is invisible in the widget file keeps the part of the file
+    /// that describes its children. The child widgets are only created when the container is made visible, when one of them
+    /// is searched with get or when the list of widgets is requested with getWidgets.
+    ///
+    /// This is disabled by default.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API void setLazyLoadingOfHiddenContainers(bool lazy);
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Returns whether hidden containers delay creating their child widgets when loading widgets from a file
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API bool getLazyLoadingOfHiddenContainers();
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Changes whether showWithEffect and hideWithEffect only change how the widget is drawn
+    ///
+    /// @param transformOnly  Should the scale and slide animations move and scale the widget only while drawing it?
+    ///
+    /// By default, the scale and slide animations call setPosition and setSize on every frame of the animation, which causes
+    /// layouts that depend on the widget to be recalculated and e.g. the text of a label to be rewrapped each time.
+    /// When enabled, these animations instead apply a transformation when drawing the widget. The position and size of the
+    /// widget remain the same during the whole animation, which also means that the mouse interacts with the widget as if it
+    /// were already at its final place.
+    ///
+    /// This is disabled by default.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API void setTransformOnlyShowAnimations(bool transformOnly);
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Returns whether showWithEffect and hideWithEffect only change how the widget is drawn
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API bool getTransformOnlyShowAnimations();
+
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Sets a new resource path
     ///
@@ -116,6 +158,12 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     TGUI_API bool compareFloats(float x, float y);
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @internal
+    // Reads the entire file into a single buffer. Returns false when the file couldn't be opened.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API bool readFileToString(const std::string& filename, std::string& contents);
+
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @internal
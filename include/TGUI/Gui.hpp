@@ -29,6 +29,8 @@
 
 #include <TGUI/Container.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <future>
 #include <queue>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -170,6 +172,54 @@ namespace tgui
         bool isTabKeyUsageEnabled() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether layouts are only recalculated once per frame instead of immediately
+        ///
+        /// @param enabled  Should the layouts that depend on other widgets be updated in a single layout pass?
+        ///
+        /// By default, when a widget moves or is resized, the layouts of all widgets that depend on it are recalculated
+        /// immediately. A widget that depends on several other widgets may thus be moved or resized several times.
+        ///
+        /// When deferred layout updates are enabled, the widgets whose layouts depend on a changed widget are only marked.
+        /// Their layouts are recalculated when updateLayouts is called, which happens automatically in the draw and handleEvent
+        /// functions. Widgets are then updated after the widgets they depend on, so that each widget only changes once.
+        /// Until then, getPosition and getSize of these widgets still return the old values.
+        ///
+        /// Disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDeferredLayoutUpdatesEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether layouts are only recalculated once per frame instead of immediately
+        ///
+        /// @return Are the layouts that depend on other widgets updated in a single layout pass?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDeferredLayoutUpdatesEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Recalculates the layouts of widgets that depend on widgets that were moved or resized
+        ///
+        /// This function only has to be called manually when deferred layout updates are enabled and you need to know the
+        /// new position or size of a widget before the gui is drawn.
+        ///
+        /// @see setDeferredLayoutUpdatesEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateLayouts();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the scheduler that plays the animations of the widgets in the gui
+        ///
+        /// The scheduler can be used to animate properties of widgets (e.g. their position or a color of their renderer).
+        /// Animations that were added to it are progressed when the time is updated, which happens automatically in draw.
+        ///
+        /// @return Animation scheduler of the gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        AnimationScheduler& getAnimationScheduler();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draws all the widgets that were added to the gui
         ///
@@ -370,7 +420,7 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Loads the child widgets from a text file
+        /// @brief Loads the child widgets from a text or binary file
         ///
         /// @param filename  Filename of the widget file
         /// @param replaceExisting  Remove existing widgets first if there are any
@@ -379,12 +429,39 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Saves the child widgets to a text file
+        /// @brief Loads the child widgets from a text or binary file without blocking the gui
+        ///
+        /// @param filename  Filename of the widget file
+        /// @param replaceExisting  Remove existing widgets first if there are any
+        ///
+        /// Reading and parsing the file and decoding the images that it refers to happens on a worker thread. The widgets are
+        /// created and the textures are uploaded on the thread that calls the draw function, during the first draw call after
+        /// the worker finished. The existing widgets remain untouched until then, so e.g. a loading screen can keep animating.
+        /// The image loader that was set with Texture::setImageLoader is called from the worker thread.
+        ///
+        /// @return Future that becomes ready once the widgets were added to the gui. Calling get on it rethrows the exception
+        ///         when the file could not be opened or parsing failed.
+        ///
+        /// @code
+        /// auto loading = gui.loadWidgetsFromFileAsync("form.txt");
+        /// while (loading.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        /// {
+        ///     // Handle events and draw the gui as usual
+        /// }
+        /// loading.get();
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::future<void> loadWidgetsFromFileAsync(const std::string& filename, bool replaceExisting = true);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Saves the child widgets to a file
         ///
         /// @param filename  Filename of the widget file
+        /// @param binary    Save the widgets in the binary format instead of as text
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void saveWidgetsToFile(const std::string& filename);
+        void saveWidgetsToFile(const std::string& filename, bool binary = false);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -406,12 +483,26 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Saves this the child widgets to a text file
+        /// @brief Saves this the child widgets to a stream
         ///
         /// @param stream  stringstream to which the widget file will be added
+        /// @param binary  Save the widgets in the binary format instead of as text
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void saveWidgetsToStream(std::stringstream& stream) const;
+        void saveWidgetsToStream(std::stringstream& stream, bool binary = false) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how long it takes before the gui has to be updated and drawn again when no events occur
+        ///
+        /// @param timeUntilUpdate  Set to the time until the next caret blink, double click timeout, tool tip or other timed
+        ///                         change in the gui. This is zero while animations are playing.
+        ///
+        /// @return False when nothing will change until the next event, in which case timeUntilUpdate isn't changed
+        ///
+        /// This can be used in an event-driven main loop to wait for events with a timeout instead of drawing every frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool getTimeUntilNextUpdate(sf::Time& timeUntilUpdate) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -431,6 +522,36 @@ namespace tgui
         void init();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the widgets of the files that were loaded asynchronously and of which the worker thread has finished
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void finishAsyncLoads();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Widget file that was read and parsed on a worker thread, together with the images that were already decoded
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct ParsedWidgetFile
+        {
+            std::unique_ptr<DataIO::Node> rootNode;
+            std::map<sf::String, std::unique_ptr<sf::Image>> images;
+        };
+
+        struct AsyncLoad
+        {
+            std::future<std::shared_ptr<ParsedWidgetFile>> parsedFile;
+            std::promise<void> finished;
+            bool replaceExisting;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Reads and parses the widget file and decodes its images. This function is executed on a worker thread.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<ParsedWidgetFile> parseWidgetFile(const std::string& filename, const std::string& resourcePath,
+                                                                 const Texture::ImageLoaderFunc& imageLoader);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
@@ -458,6 +579,8 @@ namespace tgui
 
         bool m_TabKeyUsageEnabled = true;
 
+        std::vector<AsyncLoad> m_asyncLoads;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -29,9 +29,11 @@
 #include <TGUI/Config.hpp>
 #include <TGUI/Vector2f.hpp>
 #include <type_traits>
+#include <array>
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -120,7 +122,7 @@ namespace tgui
         /// @internal
         /// @brief Constructs the layout with a mathematical operation between two other layouts
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        explicit Layout(Operation operation, std::unique_ptr<Layout> leftOperand, std::unique_ptr<Layout> rightOperand);
+        explicit Layout(Operation operation, const Layout& leftOperand, const Layout& rightOperand);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -167,7 +169,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool isConstant() const
         {
-            return m_operation == Operation::Value;
+            return m_program == nullptr;
         }
 
 
@@ -194,57 +196,165 @@ namespace tgui
         /// @internal
         /// @brief If the layout has bound a widget and the widget gets destroyed, this function is called
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void unbindWidget();
+        void unbindWidget(Widget* widget);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// @brief Recalculate the value of the layout based on the operation it contains and tell the parent layout to
-        ///        do the same when the value of the layout has changed.
+        /// @brief Recalculate the value of the layout and tell the connected widget about it when the value has changed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateValue();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Recalculate the value of the layout without informing the connected widget about the new value
+        ///
+        /// This is used when layout updates are deferred, the widget applies the new value itself afterwards.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateValue();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the widget to which the layout was connected, or nullptr if the layout isn't used by a widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget* getConnectedWidget() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Adds the widgets on which the value of this layout depends to the list
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void getBoundWidgets(std::vector<Widget*>& boundWidgets) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
+        // Single step of the compiled expression. The instructions are stored in postfix order.
+        struct Instruction
+        {
+            Operation operation; // Value, a mathematical operation or BindingString to push the value of a binding
+            float value; // The constant when the operation is Value
+            unsigned int bindingIndex; // Index of the binding when the operation is BindingString
+        };
+
+        // Compiled expression. It is never changed after creation, so copies of the layout share it.
+        struct Program
+        {
+            std::vector<Instruction> instructions;
+            std::vector<std::string> bindingStrings; // String referring to a widget for each binding, empty for bind functions
+            unsigned int maxStackSize = 0;
+        };
+
+        // Widget on which the layout depends
+        struct Binding
+        {
+            Operation operation = Operation::BindingString; // Which value of the widget to use, BindingString while no widget was found yet
+            Widget* widget = nullptr;
+            float value = 0; // Last value of the binding, kept while the binding doesn't refer to a widget
+        };
+
+        // Result of parsing a string, which is reused when the same string is parsed again
+        struct ParsedExpression
+        {
+            std::shared_ptr<const Program> program;
+            float value;
+        };
+
+        // Part of the expression converted back to a string
+        struct SubExpressionString
+        {
+            std::string str;
+            bool needsBrackets;
+            bool isValue;
+            float value;
+        };
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // If a widget is bound, inform it that the layout no longer binds it
+        // Parses the string to determine the value of the layout
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void unbindLayout();
+        void parseExpression(std::string expression);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Resets the parent pointers of the left and right operands if they exist and tell the bound widget that this layout
-        // requires information about changes to its position or size when the operation requires a widget to be bound.
+        // Creates a program that consists of a single binding, which refers to a widget by the given string when not empty
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void resetPointers();
+        static std::shared_ptr<const Program> createBindingProgram(std::string boundString);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Check whether sublayouts contain a string that refers to a widget which should be bound.
+        // Returns the number of widgets on which the layout depends
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void parseBindingStringRecursive(Widget* widget, bool xAxis);
+        std::size_t getBindingCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns a binding, the first ones are stored inside the layout and the others in m_extraBindings
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Binding& getBinding(std::size_t index);
+        const Binding& getBinding(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Executes the program to find the value of the layout
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float calculateValue();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stores the current position or size of the bound widget in the binding
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void updateBindingValue(Binding& binding);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Converts the instructions that end at the given index back to a string, index is set to the first instruction of them
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        SubExpressionString subExpressionToString(std::size_t& index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Disconnects the bindings that were found with a string, the same name may apply to a different widget now
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resetStringBindings();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Takes the program and bindings from another layout, which becomes a constant
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void stealProgram(Layout& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // If widgets are bound, inform them that the layout no longer binds them
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void unbindLayout();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tell the bound widgets that this layout requires information about changes to their position or size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resetPointers();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Find the widget corresponding to the given name and bind it if found
+        // Find the widget corresponding to the given name and store it in the binding if found
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void parseBindingString(const std::string& expression, Widget* widget, bool xAxis);
+        static bool parseBindingString(const std::string& expression, Widget* widget, bool xAxis, Binding& binding);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
         float m_value = 0;
-        Layout* m_parent = nullptr;
-        Operation m_operation = Operation::Value;
-        std::unique_ptr<Layout> m_leftOperand = nullptr; // The left operand of the operation in case the operation is a math operation
-        std::unique_ptr<Layout> m_rightOperand = nullptr; // The left operand of the operation in case the operation is a math operation
-        Widget* m_boundWidget = nullptr; // The widget on which this layout depends in case the operation is a binding
-        std::string m_boundString; // String referring to a widget on which this layout depends in case the layout was created from a string and contains a binding operation
-        std::function<void()> m_connectedWidgetCallback = nullptr; // Function to call when the value of the layout changes in case the layout and sublayouts are not all constants
+        std::shared_ptr<const Program> m_program = nullptr; // Compiled expression, nullptr when the layout is a constant
+        std::array<Binding, 2> m_bindings; // Most layouts bind at most two widgets, so these are stored without allocating memory
+        std::vector<Binding> m_extraBindings; // Bindings that didn't fit in m_bindings
+        std::function<void()> m_connectedWidgetCallback = nullptr; // Function to call when the value of the layout changes in case the layout is not a constant
+        Widget* m_connectedWidget = nullptr; // Widget that uses this layout for its position or size
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
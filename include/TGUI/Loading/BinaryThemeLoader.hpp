@@ -0,0 +1,145 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_BINARY_THEME_LOADER_HPP
+#define TGUI_BINARY_THEME_LOADER_HPP
+
+
+#include <TGUI/Loading/ThemeLoader.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Theme loader for precompiled binary theme files
+    ///
+    /// A binary theme is created from a text theme file with the compile function (or the theme-compiler tool that calls it).
+    /// Colors, numbers, outlines, texture references and nested sections are stored in an already decoded form, so that
+    /// loading a renderer from the binary file doesn't require any text parsing. Other values are stored as the text that
+    /// was found in the theme file.
+    ///
+    /// The file is memory-mapped when it is preloaded and stays mapped until the cache is flushed.
+    /// Filenames of textures and fonts are stored relative to the theme file, just like in the text theme.
+    ///
+    /// Usage:
+    /// @code
+    /// tgui::BinaryThemeLoader::compile("themes/Black.txt", "themes/Black.tgt");  // Done once, e.g. as a build step
+    ///
+    /// tgui::Theme::setThemeLoader(std::make_shared<tgui::BinaryThemeLoader>());
+    /// tgui::Theme theme{"themes/Black.tgt"};
+    /// @endcode
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API BinaryThemeLoader : public BaseThemeLoader
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Converts a text theme file into a binary theme file
+        ///
+        /// @param themeFilename   Filename of the text theme to convert
+        /// @param binaryFilename  Filename of the binary theme to create
+        ///
+        /// The textures in the theme are loaded while compiling, both to decode them and to verify that they exist.
+        /// Values that can't be decoded are stored as text and will be decoded when a widget uses them.
+        ///
+        /// @exception Exception when the text theme couldn't be loaded or the binary file couldn't be written
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void compile(const std::string& themeFilename, const std::string& binaryFilename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Maps the binary theme file in memory
+        ///
+        /// @param filename  Filename of the binary theme file to load
+        ///
+        /// @exception Exception when the file couldn't be opened or isn't a valid binary theme
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void preload(const std::string& filename) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the property-value pairs from the binary theme as strings
+        ///
+        /// @param filename   Filename of the binary theme file
+        /// @param section    Name of the section inside the theme file
+        ///
+        /// This function only exists to implement the BaseThemeLoader interface, the decoded values are converted back to
+        /// strings. Theme uses loadProperties instead, which doesn't need to convert anything.
+        ///
+        /// @return Map of property-value pairs
+        ///
+        /// @exception Exception when the file couldn't be loaded or did not contain the requested section
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::map<sf::String, sf::String>& load(const std::string& filename, const std::string& section) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Check if the requested section is available in the binary theme
+        ///
+        /// @param filename   Filename of the binary theme file
+        /// @param section    Name of the section inside the theme file
+        ///
+        /// @return Whether the file was preloaded and contains the section
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool canLoad(const std::string& filename, const std::string& section) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the decoded property-value pairs from the binary theme
+        ///
+        /// @param filename   Filename of the binary theme file
+        /// @param section    Name of the section inside the theme file
+        ///
+        /// @return Property-value pairs to store in the renderer
+        ///
+        /// @exception Exception when the file couldn't be loaded or did not contain the requested section
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PropertyValueMap loadProperties(const std::string& filename, const std::string& section) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Unmaps the files and force them to be reloaded.
+        ///
+        /// @param filename  File to remove from cache.
+        ///                  If no filename is given, the entire cache is cleared.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void flushCache(const std::string& filename = "");
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct MappedTheme;
+
+        static std::map<std::string, std::shared_ptr<MappedTheme>> m_cache;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_BINARY_THEME_LOADER_HPP
@@ -50,6 +50,30 @@ namespace tgui
     public:
         struct ValueNode;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Value that was stored in its decoded form in a binary widget file
+        ///
+        /// The string of the value is still available in the value node, this only allows skipping the parsing.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct DecodedValue
+        {
+            enum class Type
+            {
+                Number,  ///< numbers[0] contains the number
+                Bool,    ///< numbers[0] is 1 or 0
+                Color,   ///< numbers contains the red, green, blue and alpha components
+                Outline, ///< numbers contains the left, top, right and bottom values
+                Texture, ///< strings[0] is the filename, rects contains the part rect followed by the middle rect
+                Layout   ///< strings contains the x and y layout expressions
+            };
+
+            Type type = Type::Number;
+            float numbers[4] = {};
+            int rects[8] = {};
+            bool smooth = false;
+            std::string strings[2];
+        };
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Widget file node
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -72,6 +96,7 @@ namespace tgui
             std::string value;
             bool listNode = false;
             std::vector<std::string> valueList;
+            std::shared_ptr<const DecodedValue> decoded; ///< Only set for some values read from a binary widget file
         };
 
 
@@ -80,12 +105,30 @@ namespace tgui
         ///
         /// @param stream  Stream containing the widget file
         ///
+        /// Both the text format and the binary format created by emitBinary are accepted.
+        /// The contents of the stream are copied before parsing, use the overload that takes a buffer to avoid the copy.
+        ///
         /// @return Root node of the tree of nodes
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static std::unique_ptr<Node> parse(std::stringstream& stream);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses a widget file that is stored in a contiguous buffer
+        ///
+        /// @param data  Pointer to the contents of the widget file, e.g. a memory-mapped file
+        /// @param size  Amount of bytes in the buffer
+        ///
+        /// The buffer is parsed in place, it isn't copied into a stream first.
+        /// Both the text format and the binary format created by emitBinary are accepted.
+        ///
+        /// @return Root node of the tree of nodes
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::unique_ptr<Node> parse(const char* data, std::size_t size);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Emits the widget file
         ///
@@ -94,6 +137,35 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static void emit(const std::unique_ptr<Node>& rootNode, std::stringstream& stream);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Emits the widget file in the binary format
+        ///
+        /// @param rootNode Root node of the tree of nodes that is to be converted
+        /// @param stream   Stream to which the binary data will be added
+        ///
+        /// The binary file contains a table with the widget types, a table with the shared renderers at the root of the file
+        /// and a deduplicated string table. Values of which the type can be recognized (numbers, booleans, colors, outlines,
+        /// textures, layouts and references to renderers) are stored in decoded form next to their text. The parse functions
+        /// rebuild the same tree of nodes without tokenizing any text and attach the decoded values to the value nodes, so
+        /// that loading the widgets doesn't have to parse them again. Calling emit on the parsed tree returns the original text.
+        /// The file can only be loaded on machines with the same byte order.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void emitBinary(const std::unique_ptr<Node>& rootNode, std::stringstream& stream);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether a buffer contains a widget file in the binary format
+        ///
+        /// @param data  Pointer to the contents of the widget file
+        /// @param size  Amount of bytes in the buffer
+        ///
+        /// The parse functions already call this function themselves to decide which format the input has.
+        ///
+        /// @return Whether the buffer starts with the signature of a binary widget file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isBinary(const char* data, std::size_t size);
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,6 +28,7 @@
 
 
 #include <TGUI/ObjectConverter.hpp>
+#include <TGUI/Loading/DataIO.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -44,12 +45,33 @@ namespace tgui
 
         static ObjectConverter deserialize(ObjectConverter::Type type, const std::string& serializedString);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Deserializes the value of a node from a widget file
+        ///
+        /// When the node was read from a binary widget file and its value was stored decoded as the requested type, the
+        /// decoded value is returned without parsing the string. Otherwise this is the same as deserializing node.value.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static ObjectConverter deserialize(ObjectConverter::Type type, const DataIO::ValueNode& node);
+
         static void setFunction(ObjectConverter::Type type, const DeserializeFunc& deserializer);
         static const DeserializeFunc& getFunction(ObjectConverter::Type type);
 
     public:
         static std::vector<std::string> split(const std::string& str, char delim);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reads the filename and the optional Part, Middle and Smooth parameters of a texture without loading it
+        ///
+        /// @param value       Texture as written in a file, starting with the quoted filename
+        /// @param filename    Filename between the quotes
+        /// @param partRect    Part rectangle, or an empty rectangle when none was specified
+        /// @param middleRect  Middle rectangle, or an empty rectangle when none was specified
+        /// @param smooth      Whether the texture is smoothed
+        ///
+        /// @exception Exception when the value isn't a valid texture
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void readTexture(const std::string& value, std::string& filename, sf::IntRect& partRect, sf::IntRect& middleRect, bool& smooth);
+
     private:
         static std::map<ObjectConverter::Type, DeserializeFunc> m_deserializers;
     };
@@ -28,6 +28,7 @@
 
 
 #include <TGUI/Config.hpp>
+#include <TGUI/PropertyValueMap.hpp>
 #include <SFML/System/String.hpp>
 #include <memory>
 #include <string>
@@ -85,6 +86,35 @@ namespace tgui
         virtual bool canLoad(const std::string& primary, const std::string& secondary) = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the property-value pairs from the theme as values that can be stored in a renderer
+        ///
+        /// @param primary    Primary parameter of the loader
+        /// @param secondary  Secondary parameter of the loader
+        ///
+        /// The default implementation calls load and passes each value to decodeValue. Loaders that have access to values
+        /// that were already decoded can override this function to skip parsing the strings.
+        ///
+        /// @return Property-value pairs to store in the renderer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual PropertyValueMap loadProperties(const std::string& primary, const std::string& secondary);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Decodes a value from a theme when its type can be recognized without knowing the property it belongs to
+        ///
+        /// @param value  Value as written in the theme file
+        ///
+        /// Nested sections, colors starting with '#' or "rgb(", outlines between brackets and image filenames (quoted or not)
+        /// are decoded. Other values, such as numbers which could be used both as a number and as borders, are returned as
+        /// a string which will be decoded by the first widget that reads them. Values that fail to decode are also kept as
+        /// strings, so that the error is only reported when a widget uses them.
+        ///
+        /// @return Decoded value, or the original string
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static ObjectConverter decodeValue(const sf::String& value);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
@@ -152,10 +182,10 @@ namespace tgui
         /// @brief Reads and return the contents of the entire file
         ///
         /// @param filename  Filename of the file to read
-        /// @param contents  Reference to a stringstream that should be filled with the contents of the file by this function
+        /// @param contents  Reference to a string that should be filled with the contents of the file by this function
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        virtual void readFile(const std::string& filename, std::stringstream& contents) const;
+        virtual void readFile(const std::string& filename, std::string& contents) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -163,6 +193,7 @@ namespace tgui
         static std::map<std::string, std::map<std::string, std::map<sf::String, sf::String>>> m_propertiesCache;
 
         friend struct DefaultThemeLoaderTest; // Used for testing m_propertiesCache
+        friend class BinaryThemeLoader; // Used for compiling the cached sections into a binary theme
     };
 
 
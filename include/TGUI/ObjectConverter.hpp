@@ -43,6 +43,9 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Implicit converter for settable properties
     ///
+    /// A string that is stored in the object is decoded the first time that it is retrieved as a different type. The decoded
+    /// value replaces the string, so the object only keeps a single representation of its value. The string representation
+    /// of a value that wasn't a string is only created (and then kept in a separate allocation) when getString is called.
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API ObjectConverter
     {
@@ -100,10 +103,8 @@ namespace tgui
         /// @param string  String to store
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         ObjectConverter(const sf::String& string) :
-            m_type      {Type::String},
-            m_value     {string},
-            m_serialized{true},
-            m_string    {string}
+            m_type {Type::String},
+            m_value{string}
         {
         }
 
@@ -360,14 +361,21 @@ namespace tgui
         bool operator!=(const ObjectConverter& right) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Replaces the stored string by the value decoded as the requested type
+        void decode(Type type);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
         Type m_type = Type::None;
 
         Variant<sf::String, Font, Color, Outline, bool, float, Texture, TextStyle, std::shared_ptr<RendererData>> m_value;
 
-        bool m_serialized = false;
-        sf::String m_string;
+        // Serialized representation of a value that isn't a string, only created when getString is called
+        std::shared_ptr<const sf::String> m_serializedString;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
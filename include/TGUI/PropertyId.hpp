@@ -0,0 +1,303 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_PROPERTY_ID_HPP
+#define TGUI_PROPERTY_ID_HPP
+
+#include <TGUI/Config.hpp>
+#include <initializer_list>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Lightweight identifier of a renderer property
+    ///
+    /// The identifier consists of a view on the property name together with a case-insensitive hash of that name.
+    /// Property ids never own their name, the string that was used to construct them has to outlive the id.
+    ///
+    /// Ids for the properties that are known at compile time are created with the TGUI_PROPERTY_ID macro, which interns the
+    /// lowercase name and its hash in a constant so that looking up a renderer property doesn't require any allocation.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class PropertyId
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructs the id from a name of which the hash was already calculated
+        ///
+        /// @param name    Pointer to the characters of the name
+        /// @param length  Amount of characters in the name
+        /// @param hash    Result of calling hash(name, length)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        constexpr PropertyId(const char* name, std::size_t length, std::uint32_t hash) :
+            m_name  {name},
+            m_length{length},
+            m_hash  {hash}
+        {
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructs the id from a string, the hash is calculated at runtime
+        ///
+        /// @param name  Name of the property, which has to outlive the id
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit PropertyId(const std::string& name) :
+            PropertyId{name.c_str(), name.length(), hash(name.c_str(), name.length())}
+        {
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the name of the property (not null-terminated)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        constexpr const char* getName() const
+        {
+            return m_name;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of characters in the name of the property
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        constexpr std::size_t getLength() const
+        {
+            return m_length;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the case-insensitive hash of the property name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        constexpr std::uint32_t getHash() const
+        {
+            return m_hash;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether the id refers to the given property name, ignoring the case of the characters
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool matches(const std::string& name) const
+        {
+            if (name.length() != m_length)
+                return false;
+
+            for (std::size_t i = 0; i < m_length; ++i)
+            {
+                if (toLowerChar(name[i]) != toLowerChar(m_name[i]))
+                    return false;
+            }
+
+            return true;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a lowercase copy of the name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::string toLowerString() const
+        {
+            std::string str(m_name, m_length);
+            for (auto& c : str)
+                c = toLowerChar(c);
+
+            return str;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Converts an ASCII character to lowercase
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static constexpr char toLowerChar(char c)
+        {
+            return ((c >= 'A') && (c <= 'Z')) ? static_cast<char>(c - 'A' + 'a') : c;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calculates the case-insensitive 32-bit FNV-1a hash of a property name
+        ///
+        /// @param name    Pointer to the characters of the name
+        /// @param length  Amount of characters in the name
+        /// @param seed    Hash of the characters in front of the name (only used in the recursion)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static constexpr std::uint32_t hash(const char* name, std::size_t length, std::uint32_t seed = 2166136261u)
+        {
+            return (length == 0) ? seed
+                                 : hash(name + 1, length - 1, (seed ^ static_cast<unsigned char>(toLowerChar(*name))) * 16777619u);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+        const char* m_name;
+        std::size_t m_length;
+        std::uint32_t m_hash;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @internal
+    /// @brief Interned property name of which the lowercase characters and hash are calculated at compile time
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <std::size_t N>
+    class PropertyName
+    {
+    public:
+
+        constexpr PropertyName(const char (&name)[N]) :
+            PropertyName{name, std::make_index_sequence<N-1>{}}
+        {
+        }
+
+        constexpr operator PropertyId() const
+        {
+            return {m_name, N-1, m_hash};
+        }
+
+    private:
+
+        template <std::size_t... Indices>
+        constexpr PropertyName(const char (&name)[N], std::index_sequence<Indices...>) :
+            m_name{PropertyId::toLowerChar(name[Indices])..., '\0'},
+            m_hash{PropertyId::hash(name, N-1)}
+        {
+        }
+
+    private:
+        char m_name[N];
+        std::uint32_t m_hash;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Calculates the hash of a property name at compile time
+    ///
+    /// This allows dispatching on a property name with a switch statement:
+    /// @code
+    /// switch (propertyHash(property))
+    /// {
+    ///     case propertyHash("borders"):
+    ///         ...
+    /// }
+    /// @endcode
+    ///
+    /// Duplicate case labels are a compile error, so the names that are handled within one switch can never collide.
+    /// An unknown name could still have the same hash as a known one, so each case has to check the name with
+    /// isPropertyName before applying it. The TGUI_PROPERTY_CASE macro writes both the case labels and that check.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <std::size_t N>
+    constexpr std::uint32_t propertyHash(const char (&name)[N])
+    {
+        return PropertyId::hash(name, N-1);
+    }
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Calculates the hash of a property name at runtime
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    inline std::uint32_t propertyHash(const std::string& name)
+    {
+        return PropertyId::hash(name.c_str(), name.length());
+    }
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Checks whether a property name equals one of the given lowercase names, ignoring the case of the characters
+    ///
+    /// This is used after a case label of a switch on propertyHash matched, to reject unknown names that merely share the
+    /// hash of a known property. The TGUI_PROPERTY_CASE macro calls it with the same names as its case labels.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    inline bool isPropertyName(const std::string& property, std::initializer_list<const char*> names)
+    {
+        for (const char* name : names)
+        {
+            std::size_t i = 0;
+            while ((i < property.length()) && (name[i] != '\0') && (PropertyId::toLowerChar(property[i]) == name[i]))
+                ++i;
+
+            if ((i == property.length()) && (name[i] == '\0'))
+                return true;
+        }
+
+        return false;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief Declares a local constant 'ID' holding the interned id of the property called NAME
+#define TGUI_PROPERTY_ID(ID, NAME) \
+    static constexpr tgui::PropertyName<sizeof(#NAME)> ID{#NAME}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief Case labels in a switch on propertyHash(PROPERTY) for one or more lowercase property names (up to 12)
+///
+/// The code after the labels is only executed when PROPERTY has one of the names, an unknown name that merely shares the
+/// hash of one of them breaks out of the switch. Each name is thus only written once:
+/// @code
+/// switch (propertyHash(property))
+/// {
+///     TGUI_PROPERTY_CASE(property, "opacity", "opacitydisabled")
+///     {
+///         ...
+///         return;
+///     }
+/// }
+/// @endcode
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define TGUI_PROPERTY_CASE(PROPERTY, ...) \
+    TGUI_PROPERTY_EXPAND(TGUI_PROPERTY_CONCAT(TGUI_PROPERTY_CASE_LABELS_, TGUI_PROPERTY_COUNT(__VA_ARGS__))(__VA_ARGS__)) \
+    if (!tgui::isPropertyName(PROPERTY, {__VA_ARGS__})) \
+        break;
+
+// Helpers for TGUI_PROPERTY_CASE, the extra expansions are needed for the preprocessor of Visual Studio
+#define TGUI_PROPERTY_EXPAND(X) X
+#define TGUI_PROPERTY_CONCAT_IMPL(A, B) A##B
+#define TGUI_PROPERTY_CONCAT(A, B) TGUI_PROPERTY_CONCAT_IMPL(A, B)
+#define TGUI_PROPERTY_COUNT(...) TGUI_PROPERTY_EXPAND(TGUI_PROPERTY_COUNT_IMPL(__VA_ARGS__, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+#define TGUI_PROPERTY_COUNT_IMPL(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, N, ...) N
+#define TGUI_PROPERTY_CASE_LABELS_1(NAME) case tgui::propertyHash(NAME):
+#define TGUI_PROPERTY_CASE_LABELS_2(NAME, ...) case tgui::propertyHash(NAME): TGUI_PROPERTY_EXPAND(TGUI_PROPERTY_CASE_LABELS_1(__VA_ARGS__))
+#define TGUI_PROPERTY_CASE_LABELS_3(NAME, ...) case tgui::propertyHash(NAME): TGUI_PROPERTY_EXPAND(TGUI_PROPERTY_CASE_LABELS_2(__VA_ARGS__))
+#define TGUI_PROPERTY_CASE_LABELS_4(NAME, ...) case tgui::propertyHash(NAME): TGUI_PROPERTY_EXPAND(TGUI_PROPERTY_CASE_LABELS_3(__VA_ARGS__))
+#define TGUI_PROPERTY_CASE_LABELS_5(NAME, ...) case tgui::propertyHash(NAME): TGUI_PROPERTY_EXPAND(TGUI_PROPERTY_CASE_LABELS_4(__VA_ARGS__))
+#define TGUI_PROPERTY_CASE_LABELS_6(NAME, ...) case tgui::propertyHash(NAME): TGUI_PROPERTY_EXPAND(TGUI_PROPERTY_CASE_LABELS_5(__VA_ARGS__))
+#define TGUI_PROPERTY_CASE_LABELS_7(NAME, ...) case tgui::propertyHash(NAME): TGUI_PROPERTY_EXPAND(TGUI_PROPERTY_CASE_LABELS_6(__VA_ARGS__))
+#define TGUI_PROPERTY_CASE_LABELS_8(NAME, ...) case tgui::propertyHash(NAME): TGUI_PROPERTY_EXPAND(TGUI_PROPERTY_CASE_LABELS_7(__VA_ARGS__))
+#define TGUI_PROPERTY_CASE_LABELS_9(NAME, ...) case tgui::propertyHash(NAME): TGUI_PROPERTY_EXPAND(TGUI_PROPERTY_CASE_LABELS_8(__VA_ARGS__))
+#define TGUI_PROPERTY_CASE_LABELS_10(NAME, ...) case tgui::propertyHash(NAME): TGUI_PROPERTY_EXPAND(TGUI_PROPERTY_CASE_LABELS_9(__VA_ARGS__))
+#define TGUI_PROPERTY_CASE_LABELS_11(NAME, ...) case tgui::propertyHash(NAME): TGUI_PROPERTY_EXPAND(TGUI_PROPERTY_CASE_LABELS_10(__VA_ARGS__))
+#define TGUI_PROPERTY_CASE_LABELS_12(NAME, ...) case tgui::propertyHash(NAME): TGUI_PROPERTY_EXPAND(TGUI_PROPERTY_CASE_LABELS_11(__VA_ARGS__))
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_PROPERTY_ID_HPP
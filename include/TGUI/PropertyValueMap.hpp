@@ -0,0 +1,169 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_PROPERTY_VALUE_MAP_HPP
+#define TGUI_PROPERTY_VALUE_MAP_HPP
+
+#include <TGUI/PropertyId.hpp>
+#include <TGUI/ObjectConverter.hpp>
+#include <initializer_list>
+#include <vector>
+#include <deque>
+#include <map>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Hash map from property names to their values, as stored in renderers
+    ///
+    /// Lookups hash the property name case-insensitively and probe a flat open-addressing table, so using a PropertyId that
+    /// was created with TGUI_PROPERTY_ID doesn't allocate anything. The entries are iterated in the order in which they were
+    /// inserted. References and iterators to values remain valid when other properties are added, but erasing a property
+    /// invalidates all references and iterators into the map.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API PropertyValueMap
+    {
+    public:
+
+        using value_type = std::pair<std::string, ObjectConverter>;
+        using iterator = std::deque<value_type>::iterator;
+        using const_iterator = std::deque<value_type>::const_iterator;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PropertyValueMap() = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructs the map from a list of property-value pairs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PropertyValueMap(std::initializer_list<value_type> init);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructs the map from property-value pairs stored in an std::map
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PropertyValueMap(const std::map<std::string, ObjectConverter>& properties);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds the value of a property
+        ///
+        /// @param property  Id of the property to search
+        ///
+        /// @return Iterator to the property-value pair or end() when the property doesn't exist
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        iterator find(PropertyId property);
+        const_iterator find(PropertyId property) const;
+        iterator find(const std::string& property);
+        const_iterator find(const std::string& property) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the value of a property, inserting an empty value if the property didn't exist yet
+        ///
+        /// @param property  Id of the property
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ObjectConverter& operator[](PropertyId property);
+        ObjectConverter& operator[](const std::string& property);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns 1 when the property exists and 0 when it doesn't
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t count(PropertyId property) const;
+        std::size_t count(const std::string& property) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes a property
+        ///
+        /// @return Amount of removed properties, which is either 0 or 1
+        ///
+        /// @warning References and iterators to all other properties in the map become invalid when a property is removed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t erase(PropertyId property);
+        std::size_t erase(const std::string& property);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all properties
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of properties in the map
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t size() const
+        {
+            return m_entries.size();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the map contains no properties
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool empty() const
+        {
+            return m_entries.empty();
+        }
+
+
+        iterator begin() { return m_entries.begin(); }
+        iterator end() { return m_entries.end(); }
+        const_iterator begin() const { return m_entries.begin(); }
+        const_iterator end() const { return m_entries.end(); }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Returns the index of the entry or m_entries.size() when the property isn't in the map
+        std::size_t findIndex(PropertyId property) const;
+
+        // Adds a new entry without checking whether it already existed
+        ObjectConverter& insert(std::string&& name, std::uint32_t hash);
+
+        // Resizes the bucket table and reinserts all entries into it
+        void rebuildBuckets(std::size_t bucketCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::deque<value_type> m_entries;
+        std::vector<std::uint32_t> m_entryHashes;
+        std::vector<std::uint32_t> m_buckets; // Index of the entry + 1, 0 marks an empty slot
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_PROPERTY_VALUE_MAP_HPP
@@ -29,7 +29,9 @@
 
 #include <TGUI/Config.hpp>
 #include <TGUI/ObjectConverter.hpp>
+#include <TGUI/PropertyValueMap.hpp>
 #include <TGUI/Loading/DataIO.hpp>
+#include <TGUI/Loading/Deserializer.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -42,7 +44,7 @@ namespace tgui
     {
         RendererData() = default;
 
-        static std::shared_ptr<RendererData> create(const std::map<std::string, ObjectConverter>& init = {})
+        static std::shared_ptr<RendererData> create(const PropertyValueMap& init = {})
         {
             auto data = std::make_shared<RendererData>();
             data->propertyValuePairs = init;
@@ -56,7 +58,7 @@ namespace tgui
             rendererData->shared = false;
 
             for (const auto& pair : rendererNode->propertyValuePairs)
-                rendererData->propertyValuePairs[pair.first] = ObjectConverter(pair.second->value); // Did not compile with VS2015 Update 2 when using braces
+                rendererData->propertyValuePairs[pair.first] = decodeDataIOValue(*pair.second);
 
             for (const auto& nestedProperty : rendererNode->children)
             {
@@ -68,7 +70,37 @@ namespace tgui
             return rendererData;
         };
 
-        std::map<std::string, ObjectConverter> propertyValuePairs;
+        /// @internal
+        /// Values that were stored decoded in a binary widget file are only converted to the types that renderer properties
+        /// can't be confused with. Other values remain strings that are decoded by the widget that uses them.
+        static ObjectConverter decodeDataIOValue(const DataIO::ValueNode& valueNode)
+        {
+            if (valueNode.decoded)
+            {
+                try
+                {
+                    switch (valueNode.decoded->type)
+                    {
+                        case DataIO::DecodedValue::Type::Color:
+                            return Deserializer::deserialize(ObjectConverter::Type::Color, valueNode);
+                        case DataIO::DecodedValue::Type::Outline:
+                            return Deserializer::deserialize(ObjectConverter::Type::Outline, valueNode);
+                        case DataIO::DecodedValue::Type::Texture:
+                            return Deserializer::deserialize(ObjectConverter::Type::Texture, valueNode);
+                        default:
+                            break;
+                    }
+                }
+                catch (const Exception&)
+                {
+                    // Keep the string, the exception will be thrown again when the widget uses the value
+                }
+            }
+
+            return ObjectConverter(valueNode.value); // Did not compile with VS2015 Update 2 when using braces
+        }
+
+        PropertyValueMap propertyValuePairs;
         std::map<const void*, std::function<void(const std::string& property)>> observers;
         bool shared = true;
     };
@@ -197,6 +229,17 @@ namespace tgui
         void setProperty(const std::string& property, ObjectConverter&& value);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes a property of the renderer
+        ///
+        /// @param property  Id of the property that you would like to change
+        /// @param value     The new value that you like to assign to the property.
+        ///
+        /// This overload avoids allocating the lowercase name when the id was created with TGUI_PROPERTY_ID.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setProperty(PropertyId property, ObjectConverter&& value);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Retrieves the value of a certain property
         ///
@@ -215,7 +258,7 @@ namespace tgui
         /// @return Property-value pairs of the renderer
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        const std::map<std::string, ObjectConverter>& getPropertyValuePairs() const;
+        const PropertyValueMap& getPropertyValuePairs() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
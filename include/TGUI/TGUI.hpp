@@ -29,11 +29,13 @@
 
 #include <TGUI/Clipboard.hpp>
 #include <TGUI/Animation.hpp>
+#include <TGUI/AnimationScheduler.hpp>
 #include <TGUI/Widget.hpp>
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/Gui.hpp>
 
+#include <TGUI/Loading/BinaryThemeLoader.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Loading/Serializer.hpp>
 #include <TGUI/Loading/Theme.hpp>
@@ -70,8 +72,10 @@
 #include <TGUI/Widgets/SpinButton.hpp>
 #include <TGUI/Widgets/Tabs.hpp>
 #include <TGUI/Widgets/TextBox.hpp>
+#include <TGUI/Widgets/TiledPicture.hpp>
 #include <TGUI/Widgets/TreeView.hpp>
 #include <TGUI/Widgets/VerticalLayout.hpp>
+#include <TGUI/Widgets/VirtualListPanel.hpp>
 
 #include <TGUI/SignalImpl.hpp>
 #include <TGUI/SignalManagerImpl.hpp>
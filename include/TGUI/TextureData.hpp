@@ -35,8 +35,10 @@
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/Shader.hpp>
 
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -44,10 +46,34 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    // Bitmap with one bit per pixel that is set when the pixel isn't fully transparent.
+    // It replaces the copy of the image in memory, as it is all that is needed to check for transparent pixels.
+    class TGUI_API AlphaMask
+    {
+    public:
+
+        // Creates the mask from the alpha channel of the image
+        AlphaMask(const sf::Image& image);
+
+        // Returns the size of the image from which the mask was created
+        sf::Vector2u getSize() const;
+
+        // Returns whether the pixel has an alpha value of 0. The pixel has to lie inside the image.
+        bool isTransparentPixel(unsigned int x, unsigned int y) const;
+
+    private:
+
+        sf::Vector2u m_size;
+        std::size_t m_wordsPerRow = 0;
+        std::vector<std::uint64_t> m_bits; // Every row starts at a new word
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     // Used by the Texture class
     struct TGUI_API TextureData
     {
-        std::shared_ptr<sf::Image> image;
+        std::shared_ptr<AlphaMask> alphaMask; // Shared between the parts of the same image
         std::unique_ptr<SvgImage> svgImage;
         sf::Texture texture;
         sf::IntRect rect;
@@ -44,6 +44,23 @@ namespace tgui
     class TGUI_API TextureManager
     {
     public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Keeps the image that was decoded last in memory for as long as the object exists
+        ///
+        /// Loading several parts of the same image, which themes do, then only decodes the file once. The pixels of the image
+        /// are released when the last batch is destroyed. Outside a batch, getTexture releases them before returning.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API LoadBatch
+        {
+        public:
+            LoadBatch();
+            ~LoadBatch();
+            LoadBatch(const LoadBatch&) = delete;
+            LoadBatch& operator=(const LoadBatch&) = delete;
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Loads a texture
         ///
@@ -79,10 +96,23 @@ namespace tgui
         static void removeTexture(std::shared_ptr<TextureData> textureDataToRemove);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Frees the pixels of the image that was decoded last
+        ///
+        /// Textures only keep a small alpha mask of their image in memory, the pixels are only kept on the GPU. The last image
+        /// that was decoded is only kept around while a LoadBatch exists, this function releases it earlier. It is called when
+        /// the image loader of Texture is changed, as the image might not have been decoded the same way otherwise.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void releaseDecodedImage();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         static std::map<sf::String, std::list<TextureDataHolder>> m_imageMap;
+        static sf::String m_decodedImageFilename;
+        static std::shared_ptr<sf::Image> m_decodedImage;
+        static unsigned int m_loadBatchCount;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
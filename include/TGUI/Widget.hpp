@@ -34,6 +34,7 @@
 #include <TGUI/Layout.hpp>
 #include <TGUI/String.hpp>
 #include <TGUI/Vector2f.hpp>
+#include <TGUI/AnimationScheduler.hpp>
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Loading/DataIO.hpp>
 #include <TGUI/Loading/Serializer.hpp>
@@ -60,12 +61,6 @@ namespace tgui
 {
     class Container;
 
-    enum class ShowAnimationType;
-    namespace priv
-    {
-        class Animation;
-    }
-
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief The parent class for every widget
@@ -303,6 +298,30 @@ namespace tgui
 #endif
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Moves the widget from its current position to a new position with an animation
+        ///
+        /// @param position  Position of the widget at the end of the animation
+        /// @param duration  Duration of the animation
+        /// @param easing    Curve that determines how fast the widget moves during the animation
+        ///
+        /// If the widget was already being moved by an animation then that animation is finished first.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void moveWithAnimation(Vector2f position, sf::Time duration, EasingType easing = EasingType::Linear);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Resizes the widget from its current size to a new size with an animation
+        ///
+        /// @param size      Size of the widget at the end of the animation
+        /// @param duration  Duration of the animation
+        /// @param easing    Curve that determines how fast the size changes during the animation
+        ///
+        /// If the widget was already being resized by an animation then that animation is finished first.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resizeWithAnimation(Vector2f size, sf::Time duration, EasingType easing = EasingType::Linear);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Shows or hides a widget
         /// @param visible  Is the widget visible?
@@ -393,9 +412,9 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Returns whether there is an active animation (started with showWithEffect or hideWithEffect)
+        /// @brief Returns whether there is an active animation (e.g. started with showWithEffect or hideWithEffect)
         ///
-        /// @return Is an animation that shows or hides the widget playing?
+        /// @return Is an animation of the widget playing?
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool isAnimationPlaying() const;
 
@@ -585,17 +604,44 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// This function is called every frame with the time passed since the last frame.
+        /// This function is called with the time passed since the last time it was called.
+        /// Inside a gui, it is only called after the widget requested it with scheduleUpdate.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void update(sf::Time elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Asks the gui to call the update function of the widget once the given time has passed
+        ///
+        /// @param delay  Time until update has to be called, use sf::Time::Zero to have it called during the next frame
+        ///
+        /// The gui only calls update on the widgets that requested it. A custom widget that overrides update has to call
+        /// this function to keep receiving the time, e.g. by calling scheduleUpdate(sf::Time::Zero) from its update function
+        /// to be updated every frame like before.
+        ///
+        /// When an earlier update was already requested then this function has no effect. When the widget isn't part of a
+        /// gui yet, the request is remembered and update will be called as soon as the widget is added to a gui.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void scheduleUpdate(sf::Time delay);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         /// @return Is the mouse on top of the widget?
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual bool mouseOnWidget(Vector2f pos) const = 0;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns whether mouseOnWidget can return true for a position outside the bounds of the widget
+        ///
+        /// @return Can the widget be hit outside the area given by its position, widget offset and full size?
+        ///
+        /// Containers with a spatial index only check a widget when the mouse is inside its bounds, unless this function
+        /// returns true. A custom widget that reacts to the mouse outside its bounds (e.g. an open popup) has to override it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool canBeHitOutsideBounds() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -838,6 +884,32 @@ namespace tgui
                          Color color) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tells the layouts that depend on the position or size of this widget to recalculate their value. When the gui defers
+        // layout updates, the widgets that use these layouts are only marked to be updated in the next layout pass.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void recalculateBoundLayouts(const std::unordered_set<Layout*>& layouts);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the scheduler of the gui that the widget is part of, or the own scheduler of the widget when it has no gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        AnimationScheduler& getAnimationScheduler();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Slides the widget between two positions for a show or hide animation. With transform-only show animations, only the
+        // place where the widget is drawn changes and its position is left untouched.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void animateSlide(AnimationScheduler& scheduler, Vector2f start, Vector2f end, sf::Time duration, std::function<void()> finishedCallback);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Resets m_animationTimeElapsed and asks the gui to call update once the given time has passed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void restartAnimationTime(sf::Time nextUpdate);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -878,6 +950,9 @@ namespace tgui
         std::unordered_set<Layout*> m_boundPositionLayouts;
         std::unordered_set<Layout*> m_boundSizeLayouts;
 
+        // Is the widget waiting for the gui to recalculate its layouts because a widget on which they depend changed?
+        bool m_layoutUpdatePending = false;
+
         // When a widget is disabled, it will no longer receive events
         bool m_enabled = true;
 
@@ -900,20 +975,36 @@ namespace tgui
         // Keep track of the elapsed time.
         sf::Time m_animationTimeElapsed;
 
+        // Time of the gui at which update was last called by the gui and at which the widget requested the next call
+        sf::Time m_lastUpdateTime;
+        sf::Time m_scheduledUpdateTime;
+        bool m_updateScheduled = false;
+
+        // Did the widget call scheduleUpdate while it wasn't part of a gui?
+        bool m_updateRequestedWithoutGui = false;
+
         // This is set to true for widgets that have something to be dragged around (e.g. sliders and scrollbars)
         bool m_draggableWidget = false;
 
         // This is set to true for widgets that store other widgets inside them
         bool m_containerWidget = false;
 
+        // This is set to true for widgets that need leftMouseButtonNoLongerDown to be called even when the mouse went down
+        // on another widget (e.g. a menu bar that closes its open menu when clicking elsewhere)
+        bool m_notifiedOfAllMouseReleases = false;
+
         // The tool tip connected to the widget
         Widget::Ptr m_toolTip = nullptr;
 
         // Renderer of the widget
         aurora::CopiedPtr<WidgetRenderer> m_renderer = aurora::makeCopied<WidgetRenderer>();
 
-        // Show animations
-        std::vector<std::shared_ptr<priv::Animation>> m_showAnimations;
+        // Plays the animations of the widget while it isn't part of a gui (the gui plays them otherwise)
+        std::unique_ptr<AnimationScheduler> m_animationScheduler;
+
+        // Transformation applied when drawing the widget, which is changed by animations that shouldn't affect the layout
+        Vector2f m_renderOffset;
+        Vector2f m_renderScale = {1, 1};
 
         // Renderer properties that can be passed from containers to their children
         Font m_inheritedFont;
@@ -935,7 +1026,9 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        friend class Container; // Container accesses m_mouseDown, m_draggableWidget, save and load
+        friend class Container; // Container accesses m_mouseDown, m_draggableWidget, m_notifiedOfAllMouseReleases, the render transform, save and load
+        friend class GuiContainer; // GuiContainer accesses the layouts and the scheduled update time of the widget
+        friend class AnimationScheduler; // AnimationScheduler changes the render offset and scale of the widget
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -100,6 +100,32 @@ namespace tgui
         virtual void insert(std::size_t index, const Widget::Ptr& widget, const sf::String& widgetName = "");
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds multiple widgets at the end of the layout
+        ///
+        /// @param widgets  The widgets to add
+        ///
+        /// The widgets are only repositioned once after all of them were added, instead of after every widget.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addWidgets(const std::vector<Widget::Ptr>& widgets);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Inserts multiple widgets to the layout
+        ///
+        /// @param index    Index in the layout where the first widget will be placed
+        /// @param widgets  The widgets to insert
+        ///
+        /// If the index is too high, the widgets will simply be added at the end of the list.
+        /// The widgets are only repositioned once after all of them were inserted, instead of after every widget.
+        /// Widgets that are already part of the layout are moved, the index refers to the position of the first widget after
+        /// they were taken out of their old place.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void insertWidgets(std::size_t index, const std::vector<Widget::Ptr>& widgets);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Removes a single widget that was added to the container
         ///
@@ -131,6 +157,22 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr get(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the widget at the given index in the layout
+        ///
+        /// @param index  Index of the widget in the layout
+        ///
+        /// @return Widget of given index, or nullptr if index was too high
+        ///
+        /// This overload exists so that an integer index isn't ambiguous with the non-const Container::get(const sf::String&).
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr get(std::size_t index)
+        {
+            return static_cast<const BoxLayout&>(*this).get(index);
+        }
         using Container::get;
 
 
@@ -147,16 +189,39 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // @brief Repositions and resize the widgets
+        // Removes the widgets that are about to be inserted again from the layout. Returns the insertion index, which is lowered
+        // when widgets in front of it were removed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t removeWidgetsBeforeInsert(std::size_t index, const std::vector<Widget::Ptr>& widgets);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Repositions and resizes the widgets, starting from the widget at index m_firstChangedWidget when the layout supports it
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void updateWidgets() = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calls updateWidgets now or during the next layout pass of the gui when layout updates are deferred.
+        // Only the widgets starting from the given index have to be repositioned, unless the layout depends on all widgets.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateLayout(std::size_t firstChangedWidget = 0);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Positions the widgets after the gui delayed the update
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateChildLayout() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         float m_spaceBetweenWidgetsCached = 0;
 
+        // Index of the first widget that has to be repositioned by updateWidgets
+        std::size_t m_firstChangedWidget = 0;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
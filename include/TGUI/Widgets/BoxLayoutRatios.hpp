@@ -101,6 +101,17 @@ namespace tgui
         void insert(std::size_t index, const Widget::Ptr& widget, float ratio, const sf::String& widgetName = "");
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Inserts multiple widgets to the layout, each with ratio 1
+        ///
+        /// @param index    Index in the layout where the first widget will be placed
+        /// @param widgets  The widgets to insert
+        ///
+        /// If the index is too high, the widgets will simply be added at the end of the list.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insertWidgets(std::size_t index, const std::vector<Widget::Ptr>& widgets) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Removes a single widget that was added to the container
         ///
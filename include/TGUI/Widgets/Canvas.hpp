@@ -30,6 +30,8 @@
 #include <TGUI/Widgets/ClickableWidget.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -45,6 +47,21 @@ namespace tgui
         typedef std::shared_ptr<const Canvas> ConstPtr; ///< Shared constant widget pointer
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Determines what the canvas shows
+        ///
+        /// In pixel buffer mode, the canvas shows a texture that receives the pixels passed to updatePixels directly, instead
+        /// of the render texture that is used by the draw functions.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        enum class PixelBufferMode
+        {
+            None,   ///< The canvas shows what was drawn on the render texture
+            Single, ///< The canvas shows the pixels uploaded with updatePixels
+            Double  ///< Like Single, but the canvas also holds two pixel buffers that can be filled and swapped
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Default constructor
         ///
@@ -209,6 +226,64 @@ namespace tgui
         void display();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the canvas shows the render texture or pixels that are uploaded to it
+        ///
+        /// @param mode  PixelBufferMode::None to show what is drawn with the draw functions (default), or Single or Double to
+        ///              show the pixels uploaded with updatePixels or swapPixelBuffers
+        ///
+        /// Generating an image on the CPU and uploading only the changed rows or tiles with updatePixels avoids copying the
+        /// pixels into a separate texture and drawing that texture on the canvas every frame.
+        /// The pixels are lost when the mode or the size of the canvas is changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setPixelBufferMode(PixelBufferMode mode);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the canvas shows the render texture or pixels that are uploaded to it
+        ///
+        /// @return Pixel buffer mode of the canvas
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PixelBufferMode getPixelBufferMode() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copies pixels into a part of the canvas
+        ///
+        /// @param pixels        RGBA pixels (4 bytes per pixel) of the top left corner of the region
+        /// @param rect          Region of the canvas to update, parts outside the canvas are ignored
+        /// @param pixelsPerRow  Distance between the start of two rows in the pixel array, 0 when the rows have the width of
+        ///                      the region. This allows uploading a tile from a larger image.
+        ///
+        /// This function does nothing when the pixel buffer mode is None.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updatePixels(const sf::Uint8* pixels, const sf::IntRect& rect, unsigned int pixelsPerRow = 0);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the pixel buffer that can be filled while the canvas shows the other one
+        ///
+        /// @return RGBA pixels with the size of the canvas, or a nullptr when the pixel buffer mode isn't Double
+        ///
+        /// The buffer may be filled from another thread, as long as it isn't being written to while swapPixelBuffers is called.
+        /// The buffers trade places when swapping, so this function has to be called again after each swap. The buffer that it
+        /// then returns contains the pixels that were shown before the swap.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Uint8* getBackPixelBuffer();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Shows the pixels of the back buffer, which becomes the front buffer
+        ///
+        /// @param changedRect  Part of the buffer that differs from the front buffer and has to be uploaded, the entire canvas
+        ///                     is uploaded when the rectangle is empty
+        ///
+        /// This function does nothing when the pixel buffer mode isn't Double.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void swapPixelBuffers(const sf::IntRect& changedRect = {});
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draw the widget to a render target
         ///
@@ -262,11 +337,29 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recreates the texture and buffers that hold the pixels when the canvas is in pixel buffer mode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updatePixelBufferSize();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Uploads a region that lies inside the pixel texture, rows in the source are pixelsPerRow pixels apart
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void uploadPixels(const sf::Uint8* pixels, const sf::IntRect& rect, unsigned int pixelsPerRow);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         sf::RenderTexture m_renderTexture;
         sf::Sprite        m_sprite;
+
+        PixelBufferMode        m_pixelBufferMode = PixelBufferMode::None;
+        sf::Texture            m_pixelTexture;
+        std::vector<sf::Uint8> m_frontPixelBuffer;
+        std::vector<sf::Uint8> m_backPixelBuffer;
+        std::vector<sf::Uint8> m_uploadBuffer; // Reused to copy tiles whose rows aren't stored contiguously
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -156,6 +156,9 @@ namespace tgui
         ///
         /// @param widget  Pointer to the widget to remove
         ///
+        /// The widgets behind the removed widget in the same row move one column to the left. When no widgets remain in the
+        /// row, the row is removed and the rows below it move up.
+        ///
         /// @see remove(sf::String)
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -352,11 +355,72 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Updates the position and size of the widget
+        // Recalculates the rows and columns that changed, updates the size of the grid and repositions the affected widgets
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateWidgets();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Repositions the widgets in the rows, columns and cells that changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void positionWidgets();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calls updateWidgets now or during the next layout pass of the gui when layout updates are deferred
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateLayout();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Positions the widgets after the gui delayed the update
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateChildLayout() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called when one of the widgets in the grid changed size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void widgetSizeChanged(Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Has to be called when the widget, padding or size of the widget in a cell changed.
+        // A row or column that becomes larger is updated immediately, one that might become smaller is recalculated later.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void cellChanged(std::size_t row, std::size_t column);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes sure that the grid contains the given cell by adding rows and columns when needed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void createCell(std::size_t row, std::size_t column);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Takes the widget out of its cell, the widget remains a child of the grid
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeWidgetFromCell(Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes an empty cell by moving the cells behind it in the row to the left, the row is removed when it became empty
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeCell(std::size_t row, std::size_t col);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes empty rows and columns from the end of the grid
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeEmptyRowsAndColumns();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Disconnects all widgets and removes all cells from the grid
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clearCells();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -369,16 +433,48 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        struct GridCell
+        {
+            Widget::Ptr widget;
+            Padding padding;
+            Alignment alignment = Alignment::Center;
+        };
+
+        struct CellLocation
+        {
+            std::size_t row;
+            std::size_t column;
+            unsigned int callbackId; // Id of the SizeChanged connection
+        };
+
         bool m_autoSize = true;
 
-        std::vector<std::vector<Widget::Ptr>> m_gridWidgets;
-        std::vector<std::vector<Padding>>     m_objPadding;
-        std::vector<std::vector<Alignment>>   m_objAlignment;
+        // Cells stored row by row, each row contains as many cells as there are columns
+        std::vector<GridCell> m_cells;
 
         std::vector<float> m_rowHeight;
         std::vector<float> m_columnWidth;
 
-        std::map<Widget::Ptr, unsigned int> m_connectedCallbacks;
+        // Location of each widget that was placed in a cell
+        std::unordered_map<Widget*, CellLocation> m_widgetLocations;
+
+        // Rows and columns that may have become smaller and thus have to be recalculated by updateWidgets
+        std::vector<bool> m_rowHeightOutdated;
+        std::vector<bool> m_columnWidthOutdated;
+
+        // Widgets in rows and columns starting from these indices have to be repositioned by updateWidgets, as well as those in
+        // the changed cells
+        std::size_t m_firstChangedRow = 0;
+        std::size_t m_firstChangedColumn = 0;
+        std::vector<std::pair<std::size_t, std::size_t>> m_changedCells;
+
+        // Position of the first cell and space between cells that were used when the widgets were last positioned
+        Vector2f m_prevStartPosition;
+        Vector2f m_prevExtraOffset;
+
+        // Rows of widgets returned by getGridWidgets, only created when that function is called
+        mutable std::vector<std::vector<Widget::Ptr>> m_gridWidgets;
+        mutable bool m_gridWidgetsValid = false;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
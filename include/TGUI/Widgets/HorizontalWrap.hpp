@@ -69,11 +69,62 @@ namespace tgui
         static Ptr copy(ConstPtr layout);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Inserts a widget to the layout
+        ///
+        /// @param widget      Pointer to the widget you would like to add
+        /// @param index       Index of the widget in the container
+        /// @param widgetName  An identifier to access to the widget later
+        ///
+        /// If the index is too high, the widget will simply be added at the end of the list.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insert(std::size_t index, const Widget::Ptr& widget, const sf::String& widgetName = "") override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Inserts multiple widgets to the layout
+        ///
+        /// @param index    Index in the layout where the first widget will be placed
+        /// @param widgets  The widgets to insert
+        ///
+        /// If the index is too high, the widgets will simply be added at the end of the list.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insertWidgets(std::size_t index, const std::vector<Widget::Ptr>& widgets) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes a single widget that was added to the container
+        ///
+        /// @param index  Index in the layout of the widget to remove
+        ///
+        /// @return False if the index was too high
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool remove(std::size_t index) override;
+        using BoxLayout::remove;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all widgets that were added to the container
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeAllWidgets() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // @brief Repositions and resize the widgets
+        // Makes room for the positions of widgets that are about to be inserted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void widgetsInserted(std::size_t index, std::size_t count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Repositions the widgets, starting from the widget at index m_firstChangedWidget.
+        // The reflow stops as soon as a widget starts a line at the same place as during the previous update.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateWidgets() override;
 
@@ -87,6 +138,27 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Where each widget was placed during the last update, needed to continue the reflow from the middle of the layout
+        struct WrapState
+        {
+            Vector2f position;
+            Vector2f size;
+            float lineHeight = 0; // Height of the line up to and including the widget
+            bool lineStart = false;
+            bool valid = false;
+        };
+
+        std::vector<WrapState> m_wrapStates;
+        float m_wrapContentWidth = 0;
+        float m_wrapSpaceBetweenWidgets = 0;
+
+        // The reflow may only stop early at or after this index, as the widgets before it were inserted or removed
+        std::size_t m_firstUnchangedWidget = 0;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
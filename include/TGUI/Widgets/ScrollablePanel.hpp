@@ -30,6 +30,7 @@
 #include <TGUI/Widgets/Panel.hpp>
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/ScrollablePanelRenderer.hpp>
+#include <unordered_map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -341,6 +342,13 @@ namespace tgui
         Widget::Ptr askToolTip(Vector2f mousePos) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called when the position or size of one of the child widgets of this container changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childWidgetBoundsChanged(const Widget* child) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draw the widget to a render target
         ///
@@ -374,6 +382,12 @@ namespace tgui
         void load(const std::unique_ptr<DataIO::Node>& node, const LoadingRenderersMap& renderers) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the scrollbars after the gui delayed the update
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateChildLayout() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -399,15 +413,17 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Connect the position and size events to recalculate the bottom right position when a widget is updated
+        // Stores the bottom right position of a child and extends the content bounds when needed.
+        // Returns true when the child used to define the content bounds and no longer does, in which case all children have
+        // to be checked again to find the new bounds.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void connectPositionAndSize(Widget::Ptr widget);
+        bool updateChildBottomRightPosition(const Widget* widget, Vector2f bottomRight);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Disconnect the position and size events that were connected to keep track of widget changes
+        // Updates the scrollbars now or during the next layout pass of the gui when layout updates are deferred
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void disconnectAllChildWidgets();
+        void contentBoundsChanged();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -424,7 +440,9 @@ namespace tgui
         unsigned int m_verticalScrollAmount = 0;
         unsigned int m_horizontalScrollAmount = 0;
 
-        std::map<Widget::Ptr, unsigned int> m_connectedCallbacks;
+        // Bottom right position of each child widget, to find out whether a child that changed was the one defining the bounds
+        std::unordered_map<const Widget*, Vector2f> m_childBottomRightPositions;
+        bool m_mostBottomRightPositionOutdated = false;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -0,0 +1,298 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_TILED_PICTURE_HPP
+#define TGUI_TILED_PICTURE_HPP
+
+
+#include <TGUI/Widgets/ClickableWidget.hpp>
+#include <TGUI/FloatRect.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <unordered_map>
+#include <functional>
+#include <cstdint>
+#include <list>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Picture that shows an image which is split in tiles, for images that are too large for a single texture
+    ///
+    /// The image is stored as a pyramid of levels: level 0 has the full resolution and every next level halves the width and
+    /// height of the previous one. Every level is cut in square tiles. Only the tiles that intersect the visible part of
+    /// the image are loaded, at the level that best matches the size on the screen. Loaded tiles are kept in a cache which
+    /// forgets the least recently used tiles once its memory budget is exceeded.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API TiledPicture : public ClickableWidget
+    {
+    public:
+
+        typedef std::shared_ptr<TiledPicture> Ptr; ///< Shared widget pointer
+        typedef std::shared_ptr<const TiledPicture> ConstPtr; ///< Shared constant widget pointer
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Function that loads a single tile
+        ///
+        /// The parameters are the level, the column and the row of the tile and the image to load the tile in. The function
+        /// returns false when the tile could not be loaded. Tiles at the right and bottom side of a level may be smaller than
+        /// the tile size.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        using TileLoader = std::function<bool(unsigned int level, unsigned int column, unsigned int row, sf::Image& tile)>;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TiledPicture();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copy constructor
+        ///
+        /// The tiles are not copied, the new picture loads its own tiles.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TiledPicture(const TiledPicture& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default move constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TiledPicture(TiledPicture&& other) = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Overload of copy assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TiledPicture& operator= (const TiledPicture& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default move assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TiledPicture& operator= (TiledPicture&& other) = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new tiled picture widget
+        ///
+        /// @return The new tiled picture
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static TiledPicture::Ptr create();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Makes a copy of another tiled picture
+        ///
+        /// @param picture  The other tiled picture
+        ///
+        /// @return The new tiled picture
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static TiledPicture::Ptr copy(TiledPicture::ConstPtr picture);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the image that is shown, with a function that provides the tiles
+        ///
+        /// @param imageSize   Size of the full resolution image
+        /// @param tileSize    Width and height of the tiles, which may not exceed sf::Texture::getMaximumSize()
+        /// @param levelCount  Amount of levels, including the full resolution level 0
+        /// @param loader      Function that loads a tile
+        ///
+        /// The loader can read the tiles from any source, e.g. a file that is mapped in memory or a tile server.
+        /// The visible rectangle is reset to the entire image and the cached tiles are removed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSource(sf::Vector2u imageSize, unsigned int tileSize, unsigned int levelCount, TileLoader loader);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the image that is shown, with the tiles stored in separate image files
+        ///
+        /// @param filenamePattern  Filename of the tiles, where "{level}", "{column}" and "{row}" are replaced by the level,
+        ///                         column and row of the tile, e.g. "map/{level}/{column}_{row}.png"
+        /// @param imageSize        Size of the full resolution image
+        /// @param tileSize         Width and height of the tiles, which may not exceed sf::Texture::getMaximumSize()
+        /// @param levelCount       Amount of levels, including the full resolution level 0
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSource(const std::string& filenamePattern, sf::Vector2u imageSize, unsigned int tileSize, unsigned int levelCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the full resolution image
+        /// @return Image size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Vector2u getImageSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the width and height of the tiles
+        /// @return Tile size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getTileSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of levels in which the image is stored
+        /// @return Level count
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getLevelCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the part of the image that is shown in the widget
+        ///
+        /// @param rect  Visible part of the image, in pixels of the full resolution image
+        ///
+        /// The visible part is stretched to the size of the widget.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVisibleRect(const FloatRect& rect);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the part of the image that is shown in the widget
+        /// @return Visible part of the image, in pixels of the full resolution image
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FloatRect getVisibleRect() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the level from which the tiles are currently shown
+        /// @return Level of the visible tiles
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getVisibleLevel() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the amount of memory that the cached tiles may use
+        ///
+        /// @param bytes  Memory budget of the tile cache, 128 MiB by default
+        ///
+        /// The tiles that are visible are always kept, even when they need more memory than the budget allows.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setCacheBudget(std::size_t bytes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of memory that the cached tiles may use
+        /// @return Memory budget of the tile cache
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getCacheBudget() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of memory that the cached tiles are using
+        /// @return Memory used by the texture data of the cached tiles
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getCacheMemoryUsage() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of tiles that are currently cached
+        /// @return Number of cached tiles
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getCachedTileCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the size of the widget
+        ///
+        /// @param size  The new size of the widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSize(const Layout2d& size) override;
+        using Widget::setSize;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draw the widget to a render target
+        ///
+        /// @param target Render target to draw to
+        /// @param states Current render states
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes a copy of the widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr clone() const override
+        {
+            return std::make_shared<TiledPicture>(*this);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Loads the tiles that intersect the visible rectangle and removes the least recently used tiles that exceed the budget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleTiles();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes all cached tiles
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clearTiles();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        struct Tile
+        {
+            std::uint64_t key = 0;
+            unsigned int level = 0;
+            unsigned int column = 0;
+            unsigned int row = 0;
+            std::size_t memory = 0;
+            bool loaded = false; // Failed tiles are cached too, so that they aren't loaded again each time
+            bool visible = false;
+            sf::Texture texture;
+        };
+
+        TileLoader   m_tileLoader;
+        sf::Vector2u m_imageSize;
+        unsigned int m_tileSize = 256;
+        unsigned int m_levelCount = 1;
+        FloatRect    m_visibleRect;
+        unsigned int m_visibleLevel = 0;
+
+        // Most recently used tiles are in front of the list, the map finds the tiles by their key
+        std::list<Tile> m_tiles;
+        std::unordered_map<std::uint64_t, std::list<Tile>::iterator> m_tileLookup;
+        std::vector<std::list<Tile>::iterator> m_visibleTiles;
+        std::size_t m_cacheBudget = 128 * 1024 * 1024;
+        std::size_t m_cacheMemoryUsage = 0;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TILED_PICTURE_HPP
@@ -0,0 +1,370 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_VIRTUAL_LIST_PANEL_HPP
+#define TGUI_VIRTUAL_LIST_PANEL_HPP
+
+#include <TGUI/Widgets/ScrollablePanel.hpp>
+#include <functional>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Scrollable panel that shows a long list of items while only keeping widgets for the visible items
+    ///
+    /// Instead of adding a widget for every item, you tell the panel how many items there are and provide a function to create
+    /// an item widget and a function to fill an item widget with the contents of a given item. Only the items that are visible,
+    /// together with a few items above and below them, have a widget. When scrolling, the widgets of items that are no longer
+    /// visible are reused for the items that become visible.
+    ///
+    /// You should not add widgets to this panel yourself, the child widgets are managed by the panel.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API VirtualListPanel : public ScrollablePanel
+    {
+    public:
+
+        typedef std::shared_ptr<VirtualListPanel> Ptr; ///< Shared widget pointer
+        typedef std::shared_ptr<const VirtualListPanel> ConstPtr; ///< Shared constant widget pointer
+
+        using CreateItemFunc = std::function<Widget::Ptr()>; ///< Function that creates a new item widget
+        using BindItemFunc = std::function<void(const Widget::Ptr& widget, std::size_t index)>; ///< Function that shows an item in a widget
+        using ItemHeightFunc = std::function<float(std::size_t index)>; ///< Function that returns the height of an item
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        ///
+        /// @param size  Size of the panel
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        VirtualListPanel(const Layout2d& size = {"100%", "100%"});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copy constructor
+        ///
+        /// The item widgets are not copied, the copy creates its own item widgets with the same functions.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        VirtualListPanel(const VirtualListPanel& copy);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Move constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        VirtualListPanel(VirtualListPanel&& copy) = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Overload of assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        VirtualListPanel& operator= (const VirtualListPanel& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Overload of move assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        VirtualListPanel& operator= (VirtualListPanel&& other) = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new virtual list panel widget
+        ///
+        /// @param size  Size of the panel
+        ///
+        /// @return The new virtual list panel
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static VirtualListPanel::Ptr create(Layout2d size = {"100%", "100%"});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Makes a copy of another virtual list panel
+        ///
+        /// @param panel  The other virtual list panel
+        ///
+        /// @return The new virtual list panel
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static VirtualListPanel::Ptr copy(VirtualListPanel::ConstPtr panel);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the size of the panel
+        ///
+        /// @param size  The new size of the panel
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSize(const Layout2d& size) override;
+        using Widget::setSize;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the function that is called to create a new item widget
+        ///
+        /// @param func  Function that returns a new widget that can display an item
+        ///
+        /// Widgets are only created when there aren't enough unused widgets to show all visible items.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setItemCreator(const CreateItemFunc& func);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the function that is called to show an item in a widget
+        ///
+        /// @param func  Function that gets the widget and the index of the item that it has to show
+        ///
+        /// The function is called when an item becomes visible and when the items are refreshed. The widget has already been
+        /// given the width of the panel and the height of the item before the function is called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setItemBinder(const BindItemFunc& func);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the amount of items in the list
+        ///
+        /// @param itemCount  Number of items
+        ///
+        /// The item binder is called again for all items that have a widget.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setItemCount(std::size_t itemCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of items in the list
+        ///
+        /// @return Number of items
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getItemCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gives all items the same height
+        ///
+        /// @param itemHeight  Height of every item
+        ///
+        /// This removes the function set with setItemHeightFunction.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setItemHeight(float itemHeight);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the height of the items when they all have the same height
+        ///
+        /// @return Height of every item
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getItemHeight() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gives each item its own height
+        ///
+        /// @param func  Function that returns the height of the item with the given index
+        ///
+        /// The function is called for every item when it is set and when the item count changes, the heights are cached.
+        /// Call it again when the heights of the items changed. Passing an empty function makes all items have the height
+        /// that was set with setItemHeight again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setItemHeightFunction(const ItemHeightFunc& func);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how many items above and below the visible area also get a widget
+        ///
+        /// @param itemCount  Number of extra items on each side of the visible area
+        ///
+        /// Having a few extra items avoids creating or binding widgets on every small scroll movement. The default is 2.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setBufferItemCount(std::size_t itemCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many items above and below the visible area also get a widget
+        ///
+        /// @return Number of extra items on each side of the visible area
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getBufferItemCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calls the item binder again for all items that currently have a widget
+        ///
+        /// Call this function when the contents of the items changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void refreshItems();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calls the item binder again for a single item if it currently has a widget
+        ///
+        /// @param index  Index of the item that changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void refreshItem(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the widget that currently shows the given item
+        ///
+        /// @param index  Index of the item
+        ///
+        /// @return Widget of the item, or nullptr when the item is too far from the visible area to have a widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr getItemWidget(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Scrolls the panel so that the given item is at the top of the visible area
+        ///
+        /// @param index  Index of the item
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void scrollToItem(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the thumb position of the vertical scrollbar and updates the widgets of the visible items
+        ///
+        /// @param value  New value of the vertical scrollbar
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVerticalScrollbarValue(unsigned int value);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void leftMousePressed(Vector2f pos) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void mouseMoved(Vector2f pos) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool mouseWheelScrolled(float delta, Vector2f pos) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Makes sure the visible items have a widget, in case the scrollbar was changed without going through this class.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void update(sf::Time elapsedTime) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Saves the widget as a tree node in order to save it to a file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::unique_ptr<DataIO::Node> save(SavingRenderersMap& renderers) const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the widget from a tree of nodes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void load(const std::unique_ptr<DataIO::Node>& node, const LoadingRenderersMap& renderers) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes a copy of the widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr clone() const override
+        {
+            return std::make_shared<VirtualListPanel>(*this);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the top position and height of an item
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getItemTop(std::size_t index) const;
+        float getItemHeightAt(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the item at the given vertical position
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getItemAtPosition(float y) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the positions of the items when they have different heights and updates the content size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateItemPositions();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Gives a widget to every item near the visible area, reusing the widgets of items that are no longer visible.
+        // Nothing happens when the same items are still visible, unless the items were invalidated.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleItems();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes all item widgets, other child widgets that were added to the panel are kept
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeItemWidgets();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the copies of the item widgets of the other panel, they aren't linked to items in this panel
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeCopiedItemWidgets(const VirtualListPanel& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the indices in m_widgets of the widgets that are used by items
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<std::size_t> getItemWidgetIndices() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        CreateItemFunc m_createItemFunc;
+        BindItemFunc m_bindItemFunc;
+        ItemHeightFunc m_itemHeightFunc;
+
+        std::size_t m_itemCount = 0;
+        float m_itemHeight = 20;
+        std::vector<float> m_itemPositions; // Top of every item followed by the total height, only used with m_itemHeightFunc
+        std::size_t m_bufferItemCount = 2;
+
+        std::size_t m_firstItemWithWidget = 0;
+        std::vector<Widget::Ptr> m_itemWidgets; // Widgets of the items starting from m_firstItemWithWidget
+        std::vector<Widget::Ptr> m_unusedWidgets; // Widgets that were removed from the panel and can be reused
+        float m_itemWidth = 0;
+        bool m_itemsOutdated = true;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_VIRTUAL_LIST_PANEL_HPP
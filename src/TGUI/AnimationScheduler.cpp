@@ -0,0 +1,339 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/AnimationScheduler.hpp>
+#include <TGUI/Container.hpp>
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationScheduler::animatePosition(const std::shared_ptr<Widget>& widget, Vector2f start, Vector2f end, sf::Time duration,
+                                             EasingType easing, std::function<void()> finishedCallback)
+    {
+        addAnimation(widget, Property::Position, "", {{start.x, start.y, 0, 0}}, {{end.x, end.y, 0, 0}}, duration, easing, std::move(finishedCallback));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationScheduler::animateSize(const std::shared_ptr<Widget>& widget, Vector2f start, Vector2f end, sf::Time duration,
+                                         EasingType easing, std::function<void()> finishedCallback)
+    {
+        addAnimation(widget, Property::Size, "", {{start.x, start.y, 0, 0}}, {{end.x, end.y, 0, 0}}, duration, easing, std::move(finishedCallback));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationScheduler::animateOpacity(const std::shared_ptr<Widget>& widget, float start, float end, sf::Time duration,
+                                            EasingType easing, std::function<void()> finishedCallback)
+    {
+        start = std::max(0.f, std::min(1.f, start));
+        end = std::max(0.f, std::min(1.f, end));
+        addAnimation(widget, Property::Opacity, "", {{start, 0, 0, 0}}, {{end, 0, 0, 0}}, duration, easing, std::move(finishedCallback));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationScheduler::animateRendererColor(const std::shared_ptr<Widget>& widget, const std::string& property, Color start, Color end,
+                                                  sf::Time duration, EasingType easing, std::function<void()> finishedCallback)
+    {
+        addAnimation(widget, Property::RendererColor, property,
+                     {{static_cast<float>(start.getRed()), static_cast<float>(start.getGreen()), static_cast<float>(start.getBlue()), static_cast<float>(start.getAlpha())}},
+                     {{static_cast<float>(end.getRed()), static_cast<float>(end.getGreen()), static_cast<float>(end.getBlue()), static_cast<float>(end.getAlpha())}},
+                     duration, easing, std::move(finishedCallback));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationScheduler::animateRenderOffset(const std::shared_ptr<Widget>& widget, Vector2f start, Vector2f end, sf::Time duration,
+                                                 EasingType easing, std::function<void()> finishedCallback)
+    {
+        addAnimation(widget, Property::RenderOffset, "", {{start.x, start.y, 0, 0}}, {{end.x, end.y, 0, 0}}, duration, easing, std::move(finishedCallback));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationScheduler::animateRenderScale(const std::shared_ptr<Widget>& widget, Vector2f start, Vector2f end, sf::Time duration,
+                                                EasingType easing, std::function<void()> finishedCallback)
+    {
+        addAnimation(widget, Property::RenderScale, "", {{start.x, start.y, 0, 0}}, {{end.x, end.y, 0, 0}}, duration, easing, std::move(finishedCallback));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationScheduler::finishAnimations(const Widget* widget, Property property)
+    {
+        // Callbacks could start or finish other animations, so the arrays are only compacted by the outermost call.
+        // Animations that are started by the callbacks aren't finished by this call.
+        const bool alreadyUpdating = m_updating;
+        m_updating = true;
+
+        const std::size_t animationCount = m_widgets.size();
+        for (std::size_t i = 0; i < animationCount; ++i)
+        {
+            if (m_properties[i] != property)
+                continue;
+
+            const auto animatedWidget = m_widgets[i].lock();
+            if (animatedWidget && (animatedWidget.get() == widget))
+                finishAnimation(*animatedWidget, i);
+        }
+
+        m_updating = alreadyUpdating;
+        if (!m_updating)
+            removeFinishedAnimations();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationScheduler::finishAnimations(const Widget* widget)
+    {
+        const bool alreadyUpdating = m_updating;
+        m_updating = true;
+
+        const std::size_t animationCount = m_widgets.size();
+        for (std::size_t i = 0; i < animationCount; ++i)
+        {
+            const auto animatedWidget = m_widgets[i].lock();
+            if (animatedWidget && (animatedWidget.get() == widget))
+                finishAnimation(*animatedWidget, i);
+        }
+
+        m_updating = alreadyUpdating;
+        if (!m_updating)
+            removeFinishedAnimations();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationScheduler::finishAnimationsInside(const Widget* widget)
+    {
+        const bool alreadyUpdating = m_updating;
+        m_updating = true;
+
+        const std::size_t animationCount = m_widgets.size();
+        for (std::size_t i = 0; i < animationCount; ++i)
+        {
+            const auto animatedWidget = m_widgets[i].lock();
+            if (!animatedWidget)
+                continue;
+
+            const Widget* ancestor = animatedWidget.get();
+            while (ancestor && (ancestor != widget))
+                ancestor = ancestor->getParent();
+
+            if (ancestor)
+                finishAnimation(*animatedWidget, i);
+        }
+
+        m_updating = alreadyUpdating;
+        if (!m_updating)
+            removeFinishedAnimations();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool AnimationScheduler::hasAnimations(const Widget* widget) const
+    {
+        return std::any_of(m_widgets.begin(), m_widgets.end(), [widget](const std::weak_ptr<Widget>& animatedWidget){
+            const auto lockedWidget = animatedWidget.lock();
+            return lockedWidget && (lockedWidget.get() == widget);
+        });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t AnimationScheduler::getAnimationCount() const
+    {
+        return static_cast<std::size_t>(std::count_if(m_widgets.begin(), m_widgets.end(),
+            [](const std::weak_ptr<Widget>& animatedWidget){ return !animatedWidget.expired(); }));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationScheduler::update(sf::Time elapsedTime)
+    {
+        if (m_widgets.empty())
+            return;
+
+        const bool alreadyUpdating = m_updating;
+        m_updating = true;
+
+        // Animations that are added by callbacks during the update only start progressing in the next update
+        const float elapsedSeconds = elapsedTime.asSeconds();
+        const std::size_t animationCount = m_widgets.size();
+        for (std::size_t i = 0; i < animationCount; ++i)
+        {
+            const auto widget = m_widgets[i].lock();
+            if (!widget)
+                continue;
+
+            m_elapsedTimes[i] += elapsedSeconds;
+            if (m_elapsedTimes[i] >= m_durations[i])
+                finishAnimation(*widget, i);
+            else
+                applyValue(*widget, i, applyEasing(m_easings[i], m_elapsedTimes[i] / m_durations[i]));
+        }
+
+        m_updating = alreadyUpdating;
+        if (!m_updating)
+            removeFinishedAnimations();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float AnimationScheduler::applyEasing(EasingType easing, float ratio)
+    {
+        ratio = std::max(0.f, std::min(1.f, ratio));
+        switch (easing)
+        {
+            case EasingType::Linear:
+                return ratio;
+            case EasingType::EaseIn:
+                return ratio * ratio;
+            case EasingType::EaseOut:
+                return ratio * (2 - ratio);
+            case EasingType::EaseInOut:
+                if (ratio < 0.5f)
+                    return 2 * ratio * ratio;
+                else
+                    return 1 - (2 * (1 - ratio) * (1 - ratio));
+        }
+
+        return ratio;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationScheduler::addAnimation(const std::shared_ptr<Widget>& widget, Property property, const std::string& rendererProperty,
+                                          const Values& start, const Values& end, sf::Time duration, EasingType easing, std::function<void()> finishedCallback)
+    {
+        m_widgets.push_back(widget);
+        m_properties.push_back(property);
+        m_startValues.push_back(start);
+        m_endValues.push_back(end);
+        m_elapsedTimes.push_back(0);
+        m_durations.push_back(duration.asSeconds());
+        m_easings.push_back(easing);
+        m_rendererProperties.push_back(rendererProperty);
+        m_finishedCallbacks.push_back(std::move(finishedCallback));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationScheduler::applyValue(Widget& widget, std::size_t index, float progress)
+    {
+        // The value is calculated before calling the setter, as the setter could add animations and thus reallocate the arrays
+        Values value;
+        for (std::size_t i = 0; i < value.size(); ++i)
+            value[i] = m_startValues[index][i] + (progress * (m_endValues[index][i] - m_startValues[index][i]));
+
+        switch (m_properties[index])
+        {
+            case Property::Position:
+                widget.setPosition({value[0], value[1]});
+                break;
+            case Property::Size:
+                widget.setSize({value[0], value[1]});
+                break;
+            case Property::Opacity:
+                widget.setInheritedOpacity(value[0]);
+                break;
+            case Property::RendererColor:
+            {
+                const std::string rendererProperty = m_rendererProperties[index];
+                widget.getRenderer()->setProperty(rendererProperty, Color{static_cast<std::uint8_t>(value[0] + 0.5f),
+                                                                          static_cast<std::uint8_t>(value[1] + 0.5f),
+                                                                          static_cast<std::uint8_t>(value[2] + 0.5f),
+                                                                          static_cast<std::uint8_t>(value[3] + 0.5f)});
+                break;
+            }
+            case Property::RenderOffset:
+                widget.m_renderOffset = {value[0], value[1]};
+                break;
+            case Property::RenderScale:
+                widget.m_renderScale = {value[0], value[1]};
+                break;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationScheduler::finishAnimation(Widget& widget, std::size_t index)
+    {
+        m_widgets[index].reset();
+        applyValue(widget, index, 1);
+
+        const auto finishedCallback = std::move(m_finishedCallbacks[index]);
+        m_finishedCallbacks[index] = nullptr;
+        if (finishedCallback)
+            finishedCallback();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationScheduler::removeFinishedAnimations()
+    {
+        std::size_t newSize = 0;
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        {
+            if (m_widgets[i].expired())
+                continue;
+
+            if (i != newSize)
+            {
+                m_widgets[newSize] = std::move(m_widgets[i]);
+                m_properties[newSize] = m_properties[i];
+                m_startValues[newSize] = m_startValues[i];
+                m_endValues[newSize] = m_endValues[i];
+                m_elapsedTimes[newSize] = m_elapsedTimes[i];
+                m_durations[newSize] = m_durations[i];
+                m_easings[newSize] = m_easings[i];
+                m_rendererProperties[newSize] = std::move(m_rendererProperties[i]);
+                m_finishedCallbacks[newSize] = std::move(m_finishedCallbacks[i]);
+            }
+
+            ++newSize;
+        }
+
+        m_widgets.resize(newSize);
+        m_properties.resize(newSize);
+        m_startValues.resize(newSize);
+        m_endValues.resize(newSize);
+        m_elapsedTimes.resize(newSize);
+        m_durations.resize(newSize);
+        m_easings.resize(newSize);
+        m_rendererProperties.resize(newSize);
+        m_finishedCallbacks.resize(newSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
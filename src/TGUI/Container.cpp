@@ -25,10 +25,14 @@
 
 #include <TGUI/Container.hpp>
 #include <TGUI/ToolTip.hpp>
+#include <TGUI/TextureManager.hpp>
 #include <TGUI/Widgets/RadioButton.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <cstdint>
 #include <fstream>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -66,8 +70,8 @@ namespace tgui
             {
                 if (pair.second.getType() == ObjectConverter::Type::RendererData)
                 {
-                    std::stringstream ss{ObjectConverter{pair.second}.getString()};
-                    auto rendererRootNode = DataIO::parse(ss);
+                    const std::string rendererString = ObjectConverter{pair.second}.getString();
+                    auto rendererRootNode = DataIO::parse(rendererString.data(), rendererString.size());
 
                     // If there are braces around the renderer string, then the child node is the one we need
                     if (rendererRootNode->propertyValuePairs.empty() && (rendererRootNode->children.size() == 1))
@@ -96,10 +100,334 @@ namespace tgui
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Checks whether a widget with the given name is described somewhere in the nodes, without creating any widgets.
+        // Renderer and tool tip sections might be searched as well, finding a name in them would only load widgets too early.
+        bool nodesContainWidgetName(const std::vector<std::unique_ptr<DataIO::Node>>& nodes, const sf::String& widgetName)
+        {
+            for (const auto& node : nodes)
+            {
+                const auto nameSeparator = node->name.find('.');
+                if ((nameSeparator != std::string::npos)
+                 && (Deserializer::deserialize(ObjectConverter::Type::String, node->name.substr(nameSeparator + 1)).getString() == widgetName))
+                    return true;
+
+                if (nodesContainWidgetName(node->children, widgetName))
+                    return true;
+            }
+
+            return false;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Collects the names in the same way as nodesContainWidgetName searches them, so that pending widgets can be counted
+        void getWidgetNamesFromNodes(const std::vector<std::unique_ptr<DataIO::Node>>& nodes, std::vector<std::string>& widgetNames)
+        {
+            for (const auto& node : nodes)
+            {
+                const auto nameSeparator = node->name.find('.');
+                if (nameSeparator != std::string::npos)
+                    widgetNames.push_back(Deserializer::deserialize(ObjectConverter::Type::String, node->name.substr(nameSeparator + 1)).getString());
+
+                getWidgetNamesFromNodes(node->children, widgetNames);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Makes a deep copy of a node, the values that were already decoded are shared with the original node
+        std::unique_ptr<DataIO::Node> copyNode(const DataIO::Node& node, DataIO::Node* parent)
+        {
+            auto copy = std::make_unique<DataIO::Node>();
+            copy->parent = parent;
+            copy->name = node.name;
+
+            for (const auto& pair : node.propertyValuePairs)
+            {
+                if (pair.second)
+                    copy->propertyValuePairs[pair.first] = std::make_unique<DataIO::ValueNode>(*pair.second);
+            }
+
+            for (const auto& child : node.children)
+                copy->children.push_back(copyNode(*child, copy.get()));
+
+            return copy;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Adds the nodes of widgets that haven't been created yet to a node that is being saved. References to renderers of the
+        // loaded file are replaced by the renderers themselves, as the saved file won't contain the shared renderer sections.
+        void savePendingWidgetNodes(DataIO::Node& parentNode, const std::vector<std::unique_ptr<DataIO::Node>>& pendingNodes,
+                                    const std::map<std::string, std::shared_ptr<RendererData>>& renderers)
+        {
+            std::vector<DataIO::Node*> nodesToCheck;
+            for (const auto& pendingNode : pendingNodes)
+            {
+                parentNode.children.push_back(copyNode(*pendingNode, &parentNode));
+                nodesToCheck.push_back(parentNode.children.back().get());
+            }
+
+            while (!nodesToCheck.empty())
+            {
+                DataIO::Node* node = nodesToCheck.back();
+                nodesToCheck.pop_back();
+
+                const auto rendererIt = node->propertyValuePairs.find("renderer");
+                if ((rendererIt != node->propertyValuePairs.end()) && !rendererIt->second->value.empty()
+                 && (rendererIt->second->value[0] == '&'))
+                {
+                    const auto it = renderers.find(toLower(rendererIt->second->value.substr(1)));
+                    if (it != renderers.end())
+                    {
+                        node->propertyValuePairs.erase(rendererIt);
+                        node->children.push_back(saveRenderer(it->second.get(), "Renderer"));
+                        node->children.back()->parent = node;
+                    }
+                }
+
+                for (const auto& child : node->children)
+                    nodesToCheck.push_back(child.get());
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns the scheduler that plays the animations of the widgets inside the gui that contains the container,
+        // or a nullptr when the container isn't part of a gui
+        AnimationScheduler* findGuiAnimationScheduler(Container& container)
+        {
+            Widget* root = &container;
+            while (root->getParent())
+                root = root->getParent();
+
+            auto* guiContainer = dynamic_cast<GuiContainer*>(root);
+            if (!guiContainer || (guiContainer->getAnimationScheduler().getAnimationCount() == 0))
+                return nullptr;
+
+            return &guiContainer->getAnimationScheduler();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    // Uniform grid in which each child widget is stored in all cells that overlap with its bounds.
+    // Widgets that would cover too many cells are kept in a separate list that is checked on every search. Widgets of which the
+    // bounds aren't just their position and size (e.g. a child window with its title bar and resize borders) are kept in that
+    // list as well, as properties other than the position and size can change their bounds and their mouseOnWidget function.
+    // The same goes for widgets that can be hit outside their bounds (e.g. a menu bar with an open menu below it).
+    struct Container::SpatialIndex
+    {
+        struct Entry
+        {
+            std::size_t zIndex;
+            int left = 0;
+            int top = 0;
+            int right = -1;
+            int bottom = -1;
+            bool unindexed = false;
+            bool boundsChanged = false;
+        };
+
+        static constexpr int MaxCellsPerWidget = 256;
+        static constexpr float MaxCellCoordinate = 1e9f;
+
+        float cellSize = 1;
+        bool rebuildRequired = true;
+        std::unordered_map<std::uint64_t, std::vector<Widget*>> cells;
+        std::vector<Widget*> unindexedWidgets;
+        std::unordered_map<const Widget*, Entry> entries;
+        std::vector<Widget*> changedWidgets;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        static std::uint64_t getCellKey(int x, int y)
+        {
+            return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void insert(Widget* widget, Entry& entry)
+        {
+            const Vector2f offset = widget->getWidgetOffset();
+            const Vector2f position = widget->getPosition() + offset;
+            const Vector2f size = widget->getFullSize();
+            if ((offset != Vector2f{}) || (size != widget->getSize()) || widget->canBeHitOutsideBounds())
+            {
+                entry.unindexed = true;
+                unindexedWidgets.push_back(widget);
+                return;
+            }
+
+            const float left = std::floor(position.x / cellSize);
+            const float top = std::floor(position.y / cellSize);
+            const float right = std::floor((position.x + std::max(size.x, 0.f)) / cellSize);
+            const float bottom = std::floor((position.y + std::max(size.y, 0.f)) / cellSize);
+
+            // The cell count is calculated with floats so that huge or infinite bounds can't overflow
+            if (!((right - left + 1) * (bottom - top + 1) <= MaxCellsPerWidget)
+             || !(std::abs(left) < MaxCellCoordinate) || !(std::abs(top) < MaxCellCoordinate))
+            {
+                entry.unindexed = true;
+                unindexedWidgets.push_back(widget);
+                return;
+            }
+
+            entry.unindexed = false;
+            entry.left = static_cast<int>(left);
+            entry.top = static_cast<int>(top);
+            entry.right = static_cast<int>(right);
+            entry.bottom = static_cast<int>(bottom);
+            for (int x = entry.left; x <= entry.right; ++x)
+            {
+                for (int y = entry.top; y <= entry.bottom; ++y)
+                    cells[getCellKey(x, y)].push_back(widget);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void erase(Widget* widget, const Entry& entry)
+        {
+            if (entry.unindexed)
+            {
+                const auto it = std::find(unindexedWidgets.begin(), unindexedWidgets.end(), widget);
+                assert(it != unindexedWidgets.end());
+                if (it != unindexedWidgets.end())
+                    unindexedWidgets.erase(it);
+                return;
+            }
+
+            for (int x = entry.left; x <= entry.right; ++x)
+            {
+                for (int y = entry.top; y <= entry.bottom; ++y)
+                {
+                    const auto cellIt = cells.find(getCellKey(x, y));
+                    assert(cellIt != cells.end());
+                    if (cellIt == cells.end())
+                        continue;
+
+                    auto& cell = cellIt->second;
+                    const auto it = std::find(cell.begin(), cell.end(), widget);
+                    assert(it != cell.end());
+                    if (it != cell.end())
+                        cell.erase(it);
+                    if (cell.empty())
+                        cells.erase(cellIt);
+                }
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void add(Widget* widget, std::size_t zIndex)
+        {
+            if (rebuildRequired)
+                return;
+
+            auto& entry = entries[widget];
+            entry.zIndex = zIndex;
+            insert(widget, entry);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void boundsChanged(const Widget* widget)
+        {
+            if (rebuildRequired)
+                return;
+
+            // The widget is only moved inside the grid when searching, the full size of the widget may still change after
+            // the position or size was set (e.g. when the text of a radio button is updated in its setSize function).
+            auto it = entries.find(widget);
+            if ((it != entries.end()) && !it->second.boundsChanged)
+            {
+                it->second.boundsChanged = true;
+                changedWidgets.push_back(const_cast<Widget*>(widget));
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void update(const std::vector<Widget::Ptr>& widgets)
+        {
+            if (rebuildRequired)
+            {
+                cells.clear();
+                unindexedWidgets.clear();
+                entries.clear();
+                changedWidgets.clear();
+
+                // The cells are given the average size of the widgets, so that a widget typically overlaps with a few cells
+                float totalSize = 0;
+                for (const auto& widget : widgets)
+                {
+                    const Vector2f size = widget->getFullSize();
+                    if (std::isfinite(size.x) && std::isfinite(size.y))
+                        totalSize += std::max(size.x, size.y);
+                }
+                cellSize = widgets.empty() ? 1 : std::max(1.f, totalSize / widgets.size());
+
+                rebuildRequired = false;
+                for (std::size_t i = 0; i < widgets.size(); ++i)
+                    add(widgets[i].get(), i);
+            }
+            else
+            {
+                for (auto* widget : changedWidgets)
+                {
+                    auto& entry = entries[widget];
+                    erase(widget, entry);
+                    insert(widget, entry);
+                    entry.boundsChanged = false;
+                }
+
+                changedWidgets.clear();
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns the widget with the highest z-index that is visible and contains the position, or nullptr if there is none
+        Widget::Ptr findWidget(const std::vector<Widget::Ptr>& widgets, Vector2f pos)
+        {
+            update(widgets);
+
+            std::size_t foundIndex = widgets.size();
+            const auto checkWidget = [&](Widget* widget){
+                const std::size_t zIndex = entries[widget].zIndex;
+                if (((foundIndex == widgets.size()) || (zIndex > foundIndex)) && widget->isVisible() && widget->mouseOnWidget(pos))
+                    foundIndex = zIndex;
+            };
+
+            const float cellX = std::floor(pos.x / cellSize);
+            const float cellY = std::floor(pos.y / cellSize);
+            if ((std::abs(cellX) < MaxCellCoordinate) && (std::abs(cellY) < MaxCellCoordinate))
+            {
+                const auto cellIt = cells.find(getCellKey(static_cast<int>(cellX), static_cast<int>(cellY)));
+                if (cellIt != cells.end())
+                {
+                    for (auto* widget : cellIt->second)
+                        checkWidget(widget);
+                }
+            }
+
+            for (auto* widget : unindexedWidgets)
+                checkWidget(widget);
+
+            if (foundIndex < widgets.size())
+                return widgets[foundIndex];
+            else
+                return nullptr;
+        }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Container::Container()
     {
         m_containerWidget = true;
@@ -110,9 +438,17 @@ namespace tgui
     Container::Container(const Container& other) :
         Widget{other}
     {
+        if (other.m_spatialIndex)
+            m_spatialIndex = std::make_unique<SpatialIndex>();
+
         // Copy all the widgets
-        for (std::size_t i = 0; i < other.m_widgets.size(); ++i)
-            add(other.m_widgets[i]->clone(), other.m_widgets[i]->getWidgetName());
+        const auto& widgets = other.m_widgets;
+        for (std::size_t i = 0; i < widgets.size(); ++i)
+            add(widgets[i]->clone(), widgets[i]->getWidgetName());
+
+        // Widgets that haven't been created yet are also copied without creating them
+        if (!other.m_pendingWidgetNodes.empty())
+            setPendingWidgetNodes(other.m_pendingWidgetNodes, other.m_pendingWidgetRenderers);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -122,12 +458,27 @@ namespace tgui
         m_widgets             {std::move(other.m_widgets)},
         m_widgetBelowMouse    {std::move(other.m_widgetBelowMouse)},
         m_focusedWidget       {std::move(other.m_focusedWidget)},
-        m_handingMouseReleased{std::move(other.m_handingMouseReleased)}
+        m_leftMouseDownWidget {std::move(other.m_leftMouseDownWidget)},
+        m_rightMouseDownWidget{std::move(other.m_rightMouseDownWidget)},
+        m_mouseReleaseListeners{std::move(other.m_mouseReleaseListeners)},
+        m_handingMouseReleased{std::move(other.m_handingMouseReleased)},
+        m_pendingWidgetNodes  {std::move(other.m_pendingWidgetNodes)},
+        m_pendingWidgetRenderers{std::move(other.m_pendingWidgetRenderers)},
+        m_widgetNameCounts    {std::move(other.m_widgetNameCounts)},
+        m_widgetNameCache     {std::move(other.m_widgetNameCache)},
+        m_lowercaseChildNames {std::move(other.m_lowercaseChildNames)},
+        m_lowercaseChildNamesValid{other.m_lowercaseChildNamesValid},
+        m_spatialIndex        {std::move(other.m_spatialIndex)}
     {
         for (auto& widget : m_widgets)
             widget->setParent(this);
 
         other.m_widgets = {};
+        other.m_mouseReleaseListeners.clear();
+        other.m_widgetNameCounts.clear();
+        other.m_widgetNameCache.clear();
+        other.m_lowercaseChildNames.clear();
+        other.m_lowercaseChildNamesValid = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -156,12 +507,21 @@ namespace tgui
             // Remove all the old widgets
             Container::removeAllWidgets();
 
+            if (right.m_spatialIndex)
+                m_spatialIndex = std::make_unique<SpatialIndex>();
+            else
+                m_spatialIndex = nullptr;
+
             // Copy all the widgets
-            for (std::size_t i = 0; i < right.m_widgets.size(); ++i)
+            const auto& widgets = right.m_widgets;
+            for (std::size_t i = 0; i < widgets.size(); ++i)
             {
                 // Don't allow the 'add' function of a derived class to be called, since its members are not copied yet
-                Container::add(right.m_widgets[i]->clone(), right.m_widgets[i]->getWidgetName());
+                Container::add(widgets[i]->clone(), widgets[i]->getWidgetName());
             }
+
+            if (!right.m_pendingWidgetNodes.empty())
+                setPendingWidgetNodes(right.m_pendingWidgetNodes, right.m_pendingWidgetRenderers);
         }
 
         return *this;
@@ -178,12 +538,27 @@ namespace tgui
             m_widgets              = std::move(right.m_widgets);
             m_widgetBelowMouse     = std::move(right.m_widgetBelowMouse);
             m_focusedWidget        = std::move(right.m_focusedWidget);
+            m_leftMouseDownWidget  = std::move(right.m_leftMouseDownWidget);
+            m_rightMouseDownWidget = std::move(right.m_rightMouseDownWidget);
+            m_mouseReleaseListeners = std::move(right.m_mouseReleaseListeners);
             m_handingMouseReleased = std::move(right.m_handingMouseReleased);
+            m_pendingWidgetNodes   = std::move(right.m_pendingWidgetNodes);
+            m_pendingWidgetRenderers = std::move(right.m_pendingWidgetRenderers);
+            m_widgetNameCounts     = std::move(right.m_widgetNameCounts);
+            m_widgetNameCache      = std::move(right.m_widgetNameCache);
+            m_lowercaseChildNames  = std::move(right.m_lowercaseChildNames);
+            m_lowercaseChildNamesValid = right.m_lowercaseChildNamesValid;
+            m_spatialIndex         = std::move(right.m_spatialIndex);
 
             for (auto& widget : m_widgets)
                 widget->setParent(this);
 
             right.m_widgets = {};
+            right.m_mouseReleaseListeners.clear();
+            right.m_widgetNameCounts.clear();
+            right.m_widgetNameCache.clear();
+            right.m_lowercaseChildNames.clear();
+            right.m_lowercaseChildNamesValid = false;
         }
 
         return *this;
@@ -204,8 +579,7 @@ namespace tgui
             if (getInnerSize() != m_prevInnerSize)
             {
                 m_prevInnerSize = getInnerSize();
-                for (auto& layout : m_boundSizeLayouts)
-                    layout->recalculateValue();
+                recalculateBoundLayouts(m_boundSizeLayouts);
             }
         }
     }
@@ -216,11 +590,23 @@ namespace tgui
     {
         assert(widgetPtr != nullptr);
 
+        // Create the delayed widgets first so that the new widget ends up behind them
+        if (!m_pendingWidgetNodes.empty())
+            loadPendingWidgets();
+
         if (widgetPtr->getParent())
             widgetPtr->getParent()->remove(widgetPtr);
 
         widgetPtr->setParent(this);
         m_widgets.push_back(widgetPtr);
+        changeWidgetNameCounts(*widgetPtr, 1);
+        if (m_lowercaseChildNamesValid && !widgetPtr->getWidgetName().empty())
+            m_lowercaseChildNames.emplace(toLower(widgetPtr->getWidgetName()), widgetPtr.get());
+        if (m_spatialIndex)
+            m_spatialIndex->add(widgetPtr.get(), m_widgets.size() - 1);
+        if (widgetPtr->m_notifiedOfAllMouseReleases
+         || (widgetPtr->isContainer() && !static_cast<const Container&>(*widgetPtr).m_mouseReleaseListeners.empty()))
+            addMouseReleaseListener(widgetPtr.get());
         widgetPtr->setWidgetName(widgetName);
 
         if (m_fontCached != getGlobalFont())
@@ -235,21 +621,52 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Widget::Ptr Container::get(const sf::String& widgetName)
+    {
+        if (!m_pendingWidgetNodes.empty() && (m_widgetNameCounts.find(widgetName) != m_widgetNameCounts.end())
+         && nodesContainWidgetName(m_pendingWidgetNodes, widgetName))
+            loadPendingWidgets();
+
+        return static_cast<const Container&>(*this).get(widgetName);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Widget::Ptr Container::get(const sf::String& widgetName) const
     {
+        const std::string name = widgetName;
+
+        // There is no need to search when there is no widget with this name anywhere below this container
+        if (m_widgetNameCounts.find(name) == m_widgetNameCounts.end())
+            return nullptr;
+
+        const auto cacheIt = m_widgetNameCache.find(name);
+        if (cacheIt != m_widgetNameCache.end())
+            return cacheIt->second;
+
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
         {
-            if (m_widgets[i]->getWidgetName() == widgetName)
+            if (m_widgets[i]->getWidgetName() == name)
+            {
+                m_widgetNameCache[name] = m_widgets[i];
                 return m_widgets[i];
+            }
         }
 
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
         {
             if (m_widgets[i]->isContainer())
             {
-                Widget::Ptr widget = std::static_pointer_cast<Container>(m_widgets[i])->get(widgetName);
+                const auto container = std::static_pointer_cast<Container>(m_widgets[i]);
+                if (container->m_widgetNameCounts.find(name) == container->m_widgetNameCounts.end())
+                    continue;
+
+                Widget::Ptr widget = container->get(widgetName);
                 if (widget != nullptr)
+                {
+                    m_widgetNameCache[name] = widget;
                     return widget;
+                }
             }
         }
 
@@ -278,9 +695,44 @@ namespace tgui
                     widget->setFocused(false);
                 }
 
+                // The widget won't receive the mouse release anymore, so it must not keep thinking that the mouse is down
+                if (widget == m_leftMouseDownWidget)
+                {
+                    m_leftMouseDownWidget = nullptr;
+                    widget->leftMouseButtonNoLongerDown();
+                }
+                if (widget == m_rightMouseDownWidget)
+                {
+                    m_rightMouseDownWidget = nullptr;
+                    widget->rightMouseButtonNoLongerDown();
+                }
+
+                removeMouseReleaseListener(widget.get());
+
+                // The gui would otherwise keep animating the widget after it was removed. The animations are only finished
+                // once the widget is gone, because their callbacks might try to remove the widget themselves.
+                AnimationScheduler* animationScheduler = findGuiAnimationScheduler(*this);
+
                 // Remove the widget
+                changeWidgetNameCounts(*widget, -1);
+                if (m_lowercaseChildNamesValid && !widget->getWidgetName().empty())
+                {
+                    // Another child with the same name may have to be found instead of the removed one
+                    const auto it = m_lowercaseChildNames.find(toLower(widget->getWidgetName()));
+                    if ((it != m_lowercaseChildNames.end()) && (it->second == widget.get()))
+                        m_lowercaseChildNamesValid = false;
+                }
+
                 widget->setParent(nullptr);
                 m_widgets.erase(m_widgets.begin() + i);
+
+                // The z-index of all widgets behind the removed one changes
+                if (m_spatialIndex)
+                    m_spatialIndex->rebuildRequired = true;
+
+                if (animationScheduler)
+                    animationScheduler->finishAnimationsInside(widget.get());
+
                 return true;
             }
         }
@@ -292,13 +744,42 @@ namespace tgui
 
     void Container::removeAllWidgets()
     {
+        releaseMouseDownWidgets();
+
+        // The animations that the gui plays on the removed widgets are finished once the widgets are gone
+        AnimationScheduler* animationScheduler = findGuiAnimationScheduler(*this);
+        std::vector<Widget::Ptr> removedWidgets;
+        if (animationScheduler)
+            removedWidgets = m_widgets;
+
         for (const auto& widget : m_widgets)
             widget->setParent(nullptr);
 
+        // All names below this container disappear, so the parents have to forget about them as well
+        if (m_parent)
+        {
+            for (const auto& pair : m_widgetNameCounts)
+                m_parent->changeWidgetNameCount(pair.first, -static_cast<int>(pair.second));
+        }
+
         m_widgets.clear();
+        m_pendingWidgetNodes.clear();
+        m_pendingWidgetRenderers.clear();
+        m_widgetNameCounts.clear();
+        m_widgetNameCache.clear();
+        m_lowercaseChildNames.clear();
+        m_lowercaseChildNamesValid = false;
+        if (m_spatialIndex)
+            m_spatialIndex->rebuildRequired = true;
+
+        while (!m_mouseReleaseListeners.empty())
+            removeMouseReleaseListener(m_mouseReleaseListeners.back());
 
         m_widgetBelowMouse = nullptr;
         m_focusedWidget = nullptr;
+
+        for (const auto& widget : removedWidgets)
+            animationScheduler->finishAnimationsInside(widget.get());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -364,25 +845,38 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::setVisible(bool visible)
+    {
+        if (visible && !m_pendingWidgetNodes.empty())
+            loadPendingWidgets();
+
+        if (!visible)
+            releaseMouseDownWidgets();
+
+        Widget::setVisible(visible);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::loadWidgetsFromFile(const std::string& filename, bool replaceExisting)
     {
-        std::ifstream in{filename};
-        if (!in.is_open())
+        // The file is read in binary mode as it may contain a binary widget file, the text parser ignores carriage returns.
+        // The buffer is parsed directly, without copying it into a stream first.
+        std::string contents;
+        if (!readFileToString(filename, contents))
             throw Exception{"Failed to open '" + filename + "' to load the widgets from it."};
 
-        std::stringstream stream;
-        stream << in.rdbuf();
-        loadWidgetsFromStream(stream, replaceExisting);
+        loadWidgetsFromNodeTree(DataIO::parse(contents.data(), contents.size()), replaceExisting);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::saveWidgetsToFile(const std::string& filename)
+    void Container::saveWidgetsToFile(const std::string& filename, bool binary)
     {
         std::stringstream stream;
-        saveWidgetsToStream(stream);
+        saveWidgetsToStream(stream, binary);
 
-        std::ofstream out{filename};
+        std::ofstream out{filename, binary ? std::ios::out | std::ios::binary : std::ios::out};
         if (!out.is_open())
             throw Exception{"Failed to open '" + filename + "' for saving the widgets to it."};
 
@@ -393,7 +887,15 @@ namespace tgui
 
     void Container::loadWidgetsFromStream(std::stringstream& stream, bool replaceExisting)
     {
-        auto rootNode = DataIO::parse(stream);
+        loadWidgetsFromNodeTree(DataIO::parse(stream), replaceExisting);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::loadWidgetsFromNodeTree(const std::unique_ptr<DataIO::Node>& rootNode, bool replaceExisting)
+    {
+        // Widgets often use different parts of the same image, which is then only decoded once
+        const TextureManager::LoadBatch batch;
 
         // Replace the existing widgets by the ones that will be loaded if requested
         if (replaceExisting)
@@ -441,7 +943,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::saveWidgetsToStream(std::stringstream& stream) const
+    void Container::saveWidgetsToStream(std::stringstream& stream, bool binary) const
     {
         auto node = std::make_unique<DataIO::Node>();
 
@@ -467,10 +969,16 @@ namespace tgui
                 renderersMap[child] = std::make_pair(nullptr, idStr); // Did not compile with VS2015 Update 2 when using braces
         }
 
-        for (const auto& child : getWidgets())
+        for (const auto& child : m_widgets)
             node->children.emplace_back(child->save(renderersMap));
 
-        DataIO::emit(node, stream);
+        if (!m_pendingWidgetNodes.empty())
+            savePendingWidgetNodes(*node, m_pendingWidgetNodes, m_pendingWidgetRenderers);
+
+        if (binary)
+            DataIO::emitBinary(node, stream);
+        else
+            DataIO::emit(node, stream);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -488,6 +996,7 @@ namespace tgui
 
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + i);
+            widgetOrderChanged();
             break;
         }
     }
@@ -508,12 +1017,30 @@ namespace tgui
 
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + i + 1);
+            widgetOrderChanged();
             break;
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::setSpatialIndexEnabled(bool enabled)
+    {
+        if (enabled && !m_spatialIndex)
+            m_spatialIndex = std::make_unique<SpatialIndex>();
+        else if (!enabled)
+            m_spatialIndex = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isSpatialIndexEnabled() const
+    {
+        return m_spatialIndex != nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::focusNextWidget()
     {
         // If the focused widget is a container then try to focus the next widget inside it
@@ -624,6 +1151,71 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::childWidgetBoundsChanged(const Widget* child)
+    {
+        if (m_spatialIndex)
+            m_spatialIndex->boundsChanged(child);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::childWidgetNameChanged(Widget* child, const std::string& oldName, const std::string& newName)
+    {
+        changeWidgetNameCount(oldName, -1);
+        changeWidgetNameCount(newName, 1);
+
+        if (!m_lowercaseChildNamesValid)
+            return;
+
+        if (!oldName.empty())
+        {
+            const auto it = m_lowercaseChildNames.find(toLower(oldName));
+            if ((it != m_lowercaseChildNames.end()) && (it->second == child))
+            {
+                m_lowercaseChildNamesValid = false;
+                return;
+            }
+        }
+
+        if (!newName.empty())
+        {
+            // The child can only be added directly if it is the first one with this name, which is always the case for the last child
+            const auto it = m_lowercaseChildNames.find(toLower(newName));
+            if (it == m_lowercaseChildNames.end())
+                m_lowercaseChildNames.emplace(toLower(newName), child);
+            else if (m_widgets.empty() || (m_widgets.back().get() != child))
+                m_lowercaseChildNamesValid = false;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget* Container::getChildByLowercaseName(const std::string& lowercaseName)
+    {
+        if (!m_pendingWidgetNodes.empty())
+            loadPendingWidgets();
+
+        if (!m_lowercaseChildNamesValid)
+        {
+            m_lowercaseChildNames.clear();
+            for (const auto& widget : m_widgets)
+            {
+                if (!widget->getWidgetName().empty())
+                    m_lowercaseChildNames.emplace(toLower(widget->getWidgetName()), widget.get());
+            }
+
+            m_lowercaseChildNamesValid = true;
+        }
+
+        const auto it = m_lowercaseChildNames.find(lowercaseName);
+        if (it != m_lowercaseChildNames.end())
+            return it->second;
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::leftMousePressed(Vector2f pos)
     {
         sf::Event event;
@@ -755,9 +1347,7 @@ namespace tgui
     void Container::leftMouseButtonNoLongerDown()
     {
         Widget::leftMouseButtonNoLongerDown();
-
-        for (auto& widget : m_widgets)
-            widget->leftMouseButtonNoLongerDown();
+        notifyChildrenLeftMouseButtonNoLongerDown();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -765,9 +1355,7 @@ namespace tgui
     void Container::rightMouseButtonNoLongerDown()
     {
         Widget::rightMouseButtonNoLongerDown();
-
-        for (auto& widget : m_widgets)
-            widget->rightMouseButtonNoLongerDown();
+        notifyChildrenRightMouseButtonNoLongerDown();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -801,17 +1389,23 @@ namespace tgui
     {
         Widget::rendererChanged(property);
 
-        if ((property == "opacity") || (property == "opacitydisabled"))
+        switch (propertyHash(property))
         {
-            for (std::size_t i = 0; i < m_widgets.size(); ++i)
-                m_widgets[i]->setInheritedOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            for (const auto& widget : m_widgets)
+            TGUI_PROPERTY_CASE(property, "opacity", "opacitydisabled")
             {
-                if (m_fontCached != getGlobalFont())
-                    widget->setInheritedFont(m_fontCached);
+                for (std::size_t i = 0; i < m_widgets.size(); ++i)
+                    m_widgets[i]->setInheritedOpacity(m_opacityCached);
+                break;
+            }
+
+            TGUI_PROPERTY_CASE(property, "font")
+            {
+                for (const auto& widget : m_widgets)
+                {
+                    if (m_fontCached != getGlobalFont())
+                        widget->setInheritedFont(m_fontCached);
+                }
+                break;
             }
         }
     }
@@ -822,9 +1416,12 @@ namespace tgui
     {
         auto node = Widget::save(renderers);
 
-        for (const auto& child : getWidgets())
+        for (const auto& child : m_widgets)
             node->children.emplace_back(child->save(renderers));
 
+        if (!m_pendingWidgetNodes.empty())
+            savePendingWidgetNodes(*node, m_pendingWidgetNodes, m_pendingWidgetRenderers);
+
         return node;
     }
 
@@ -834,7 +1431,21 @@ namespace tgui
     {
         Widget::load(node, renderers);
 
-        for (const auto& childNode : node->children)
+        // The children of a hidden container can be kept as nodes until they are needed
+        if (getLazyLoadingOfHiddenContainers() && !isVisible() && !node->children.empty())
+        {
+            setPendingWidgetNodes(node->children, renderers);
+            return;
+        }
+
+        loadChildWidgets(node->children, renderers);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::loadChildWidgets(const std::vector<std::unique_ptr<DataIO::Node>>& nodes, const LoadingRenderersMap& renderers)
+    {
+        for (const auto& childNode : nodes)
         {
             const auto nameSeparator = childNode->name.find('.');
             const auto widgetType = childNode->name.substr(0, nameSeparator);
@@ -857,10 +1468,204 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::loadPendingWidgets()
+    {
+        // The nodes are moved out first, adding the widgets would otherwise try to load them again
+        auto nodes = std::move(m_pendingWidgetNodes);
+        auto renderers = std::move(m_pendingWidgetRenderers);
+        m_pendingWidgetNodes.clear();
+        m_pendingWidgetRenderers.clear();
+
+        // The names will be counted again when the widgets are added
+        std::vector<std::string> widgetNames;
+        getWidgetNamesFromNodes(nodes, widgetNames);
+        for (const auto& widgetName : widgetNames)
+            changeWidgetNameCount(widgetName, -1);
+
+        loadChildWidgets(nodes, renderers);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::setPendingWidgetNodes(const std::vector<std::unique_ptr<DataIO::Node>>& nodes, const LoadingRenderersMap& renderers)
+    {
+        // The nodes are copied as the caller still owns the tree that is being loaded
+        for (const auto& node : nodes)
+            m_pendingWidgetNodes.push_back(copyNode(*node, nullptr));
+
+        for (const auto& pair : renderers)
+            m_pendingWidgetRenderers[pair.first] = pair.second;
+
+        // The names are counted already so that searching for them from a parent will find the pending widgets
+        std::vector<std::string> widgetNames;
+        getWidgetNamesFromNodes(nodes, widgetNames);
+        for (const auto& widgetName : widgetNames)
+            changeWidgetNameCount(widgetName, 1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::widgetOrderChanged()
+    {
+        if (m_spatialIndex)
+            m_spatialIndex->rebuildRequired = true;
+
+        m_lowercaseChildNamesValid = false;
+
+        // A different widget might be found first, so the cached results can't be used anymore
+        for (Container* container = this; container != nullptr; container = container->getParent())
+        {
+            if (!container->m_widgetNameCache.empty())
+                container->m_widgetNameCache.clear();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::scheduleChildLayoutUpdate()
+    {
+        Widget* root = this;
+        while (root->getParent())
+            root = root->getParent();
+
+        auto* guiContainer = dynamic_cast<GuiContainer*>(root);
+        if (!guiContainer || !guiContainer->scheduleLayoutUpdate(this))
+            return false;
+
+        m_childLayoutUpdatePending = true;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::updateChildLayout()
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::changeWidgetNameCount(const std::string& name, int change)
+    {
+        for (Container* container = this; container != nullptr; container = container->getParent())
+        {
+            container->m_widgetNameCache.erase(name);
+
+            auto& count = container->m_widgetNameCounts[name];
+            assert(static_cast<int>(count) + change >= 0);
+            count = static_cast<unsigned int>(static_cast<int>(count) + change);
+            if (count == 0)
+                container->m_widgetNameCounts.erase(name);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::changeWidgetNameCounts(const Widget& widget, int change)
+    {
+        changeWidgetNameCount(widget.getWidgetName(), change);
+
+        if (widget.isContainer())
+        {
+            for (const auto& pair : static_cast<const Container&>(widget).m_widgetNameCounts)
+                changeWidgetNameCount(pair.first, change * static_cast<int>(pair.second));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::notifyChildrenLeftMouseButtonNoLongerDown()
+    {
+        const Widget::Ptr widget = m_leftMouseDownWidget;
+        m_leftMouseDownWidget = nullptr;
+
+        if (widget)
+            widget->leftMouseButtonNoLongerDown();
+
+        for (std::size_t i = 0; i < m_mouseReleaseListeners.size(); ++i)
+        {
+            if (m_mouseReleaseListeners[i] != widget.get())
+                m_mouseReleaseListeners[i]->leftMouseButtonNoLongerDown();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::notifyChildrenRightMouseButtonNoLongerDown()
+    {
+        const Widget::Ptr widget = m_rightMouseDownWidget;
+        m_rightMouseDownWidget = nullptr;
+
+        if (widget)
+            widget->rightMouseButtonNoLongerDown();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::addMouseReleaseListener(Widget* child)
+    {
+        if (std::find(m_mouseReleaseListeners.begin(), m_mouseReleaseListeners.end(), child) != m_mouseReleaseListeners.end())
+            return;
+
+        m_mouseReleaseListeners.push_back(child);
+        if ((m_mouseReleaseListeners.size() == 1) && !m_notifiedOfAllMouseReleases)
+        {
+            if (m_parent)
+                m_parent->addMouseReleaseListener(this);
+            else if (m_ownerWidget && m_ownerWidget->getParent()
+                  && !m_ownerWidget->m_notifiedOfAllMouseReleases)
+                m_ownerWidget->getParent()->addMouseReleaseListener(m_ownerWidget);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::removeMouseReleaseListener(Widget* child)
+    {
+        const auto it = std::find(m_mouseReleaseListeners.begin(), m_mouseReleaseListeners.end(), child);
+        if (it == m_mouseReleaseListeners.end())
+            return;
+
+        m_mouseReleaseListeners.erase(it);
+        if (m_mouseReleaseListeners.empty() && !m_notifiedOfAllMouseReleases)
+        {
+            if (m_parent)
+                m_parent->removeMouseReleaseListener(this);
+            else if (m_ownerWidget && m_ownerWidget->getParent()
+                  && !m_ownerWidget->m_notifiedOfAllMouseReleases)
+                m_ownerWidget->getParent()->removeMouseReleaseListener(m_ownerWidget);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::releaseMouseDownWidgets()
+    {
+        const Widget::Ptr widget = m_leftMouseDownWidget;
+        m_leftMouseDownWidget = nullptr;
+
+        if (widget)
+            widget->leftMouseButtonNoLongerDown();
+
+        notifyChildrenRightMouseButtonNoLongerDown();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::update(sf::Time elapsedTime)
     {
         Widget::update(elapsedTime);
 
+        // Inside a gui, the widgets are only updated by the gui when they asked for it
+        const Widget* root = this;
+        while (root->getParent())
+            root = root->getParent();
+
+        if (dynamic_cast<const GuiContainer*>(root))
+        {
+            m_animationTimeElapsed = {};
+            return;
+        }
+
         // Loop through all widgets
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
         {
@@ -885,19 +1690,12 @@ namespace tgui
             else
                 mousePos = {static_cast<float>(event.touch.x), static_cast<float>(event.touch.y)};
 
-            // Loop through all widgets
-            for (auto& widget : m_widgets)
+            // Some widgets should always receive mouse move events while dragging them, even if the mouse is no longer on top of them.
+            if (m_leftMouseDownWidget && m_leftMouseDownWidget->m_mouseDown
+             && (m_leftMouseDownWidget->m_draggableWidget || m_leftMouseDownWidget->isContainer()))
             {
-                // Check if the mouse went down on the widget
-                if (widget->m_mouseDown)
-                {
-                    // Some widgets should always receive mouse move events while dragging them, even if the mouse is no longer on top of them.
-                    if (widget->m_draggableWidget || widget->isContainer())
-                    {
-                        widget->mouseMoved(mousePos);
-                        return true;
-                    }
-                }
+                m_leftMouseDownWidget->mouseMoved(mousePos);
+                return true;
             }
 
             // Check if the mouse is on top of a widget
@@ -923,6 +1721,13 @@ namespace tgui
 
             // Check if the mouse is on top of a widget
             Widget::Ptr widget = mouseOnWhichWidget(mousePos);
+
+            // Remember on which widget the mouse went down, so that moves and releases can be sent to it directly
+            if ((event.type == sf::Event::TouchBegan) || (event.mouseButton.button == sf::Mouse::Left))
+                m_leftMouseDownWidget = widget;
+            else if (event.mouseButton.button == sf::Mouse::Right)
+                m_rightMouseDownWidget = widget;
+
             if (widget)
             {
                 // Unfocus the previously focused widget
@@ -975,24 +1780,16 @@ namespace tgui
             if (((event.type == sf::Event::MouseButtonReleased) && (event.mouseButton.button == sf::Mouse::Left))
               || ((event.type == sf::Event::TouchEnded) && (event.touch.finger == 0)))
             {
-                // Tell all widgets that the mouse has gone up
+                // Tell the widget on which the mouse went down that the mouse has gone up
                 // But don't do this when leftMouseReleased was called on this container because
                 // it will happen afterwards when leftMouseButtonNoLongerDown is called on it
                 if (!m_handingMouseReleased)
-                {
-                    // TODO: Only call leftMouseButtonNoLongerDown on the widget that last got the left mouse down event
-                    for (auto& widget : m_widgets)
-                        widget->leftMouseButtonNoLongerDown();
-                }
+                    notifyChildrenLeftMouseButtonNoLongerDown();
             }
             else if ((event.type == sf::Event::MouseButtonReleased) && (event.mouseButton.button == sf::Mouse::Right))
             {
-                // TODO: Same remark as above for leftMouseButtonNoLongerDown
                 if (!m_handingMouseReleased)
-                {
-                    for (auto& widget : m_widgets)
-                        widget->rightMouseButtonNoLongerDown();
-                }
+                    notifyChildrenRightMouseButtonNoLongerDown();
             }
 
             if (widgetBelowMouse != nullptr)
@@ -1061,16 +1858,25 @@ namespace tgui
     Widget::Ptr Container::mouseOnWhichWidget(Vector2f mousePos)
     {
         Widget::Ptr widget = nullptr;
-        for (auto it = m_widgets.rbegin(); it != m_widgets.rend(); ++it)
+        if (m_spatialIndex)
         {
-            if ((*it)->isVisible())
+            widget = m_spatialIndex->findWidget(m_widgets, mousePos);
+            if (widget && !widget->isEnabled())
+                widget = nullptr;
+        }
+        else
+        {
+            for (auto it = m_widgets.rbegin(); it != m_widgets.rend(); ++it)
             {
-                if ((*it)->mouseOnWidget(mousePos))
+                if ((*it)->isVisible())
                 {
-                    if ((*it)->isEnabled())
-                        widget = *it;
+                    if ((*it)->mouseOnWidget(mousePos))
+                    {
+                        if ((*it)->isEnabled())
+                            widget = *it;
 
-                    break;
+                        break;
+                    }
                 }
             }
         }
@@ -1091,12 +1897,28 @@ namespace tgui
         for (const auto& widget : m_widgets)
         {
             if (widget->isVisible())
-                widget->draw(*target, states);
+                drawChildWidget(*target, states, *widget);
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::drawChildWidget(sf::RenderTarget& target, sf::RenderStates states, const Widget& widget) const
+    {
+        if ((widget.m_renderOffset != Vector2f{0, 0}) || (widget.m_renderScale != Vector2f{1, 1}))
+        {
+            // The transformation is applied around the center of the widget, the geometry of the widget itself doesn't change
+            const Vector2f center = widget.getPosition() + (widget.getSize() / 2.f);
+            states.transform.translate(center + widget.m_renderOffset);
+            states.transform.scale(widget.m_renderScale);
+            states.transform.translate(-center);
+        }
+
+        widget.draw(target, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::size_t Container::getFocusedWidgetIndex() const
     {
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
@@ -1159,6 +1981,23 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    GuiContainer::~GuiContainer()
+    {
+        // The widgets may outlive the gui, so they must be able to be scheduled again by another gui
+        for (const auto& weakWidget : m_pendingLayoutWidgets)
+        {
+            const auto widget = weakWidget.lock();
+            if (!widget)
+                continue;
+
+            widget->m_layoutUpdatePending = false;
+            if (widget->isContainer())
+                static_cast<Container&>(*widget).m_childLayoutUpdatePending = false;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void GuiContainer::setSize(const Layout2d&)
     {
     }
@@ -1180,6 +2019,213 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool GuiContainer::scheduleLayoutUpdate(Widget* widget)
+    {
+        if (!m_deferLayoutUpdates || !widget || (widget == this))
+            return false;
+
+        // Only widgets inside this gui can be updated later, the layouts of other widgets are recalculated immediately
+        const Widget* root = widget;
+        while (root->getParent())
+            root = root->getParent();
+
+        if (root != this)
+            return false;
+
+        if (widget->m_layoutUpdatePending)
+            return true;
+
+        widget->m_layoutUpdatePending = true;
+        m_pendingLayoutWidgets.push_back(widget->shared_from_this());
+
+        // The position or size of the widget may change, so the widgets that depend on it will also need to be updated
+        for (auto* layout : widget->m_boundPositionLayouts)
+            scheduleLayoutUpdate(layout->getConnectedWidget());
+        for (auto* layout : widget->m_boundSizeLayouts)
+            scheduleLayoutUpdate(layout->getConnectedWidget());
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::updateLayouts()
+    {
+        // Updating widgets can schedule new updates (e.g. when a container changes the size of its children), so keep going until done
+        while (!m_pendingLayoutWidgets.empty())
+        {
+            const auto pendingWidgets = std::move(m_pendingLayoutWidgets);
+            m_pendingLayoutWidgets.clear();
+
+            for (const auto& weakWidget : pendingWidgets)
+            {
+                const auto widget = weakWidget.lock();
+                if (widget)
+                    updateWidgetLayouts(*widget);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::updateWidgetLayouts(Widget& widget)
+    {
+        if (!widget.m_layoutUpdatePending)
+            return;
+
+        // The flag is reset first so that layouts that depend on each other can't cause infinite recursion
+        widget.m_layoutUpdatePending = false;
+
+        // The widgets on which the layouts depend are updated first, so that the widget only has to change once
+        std::vector<Widget*> boundWidgets;
+        widget.m_position.x.getBoundWidgets(boundWidgets);
+        widget.m_position.y.getBoundWidgets(boundWidgets);
+        widget.m_size.x.getBoundWidgets(boundWidgets);
+        widget.m_size.y.getBoundWidgets(boundWidgets);
+        for (auto* boundWidget : boundWidgets)
+        {
+            if (boundWidget->m_layoutUpdatePending)
+                updateWidgetLayouts(*boundWidget);
+        }
+
+        widget.m_position.x.updateValue();
+        widget.m_position.y.updateValue();
+        widget.m_size.x.updateValue();
+        widget.m_size.y.updateValue();
+
+        if (widget.m_position.getValue() != widget.m_prevPosition)
+            widget.setPosition(widget.m_position);
+        if (widget.m_size.getValue() != widget.m_prevSize)
+            widget.setSize(widget.m_size);
+
+        if (widget.isContainer())
+        {
+            auto& container = static_cast<Container&>(widget);
+            if (container.m_childLayoutUpdatePending)
+            {
+                container.m_childLayoutUpdatePending = false;
+                container.updateChildLayout();
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    AnimationScheduler& GuiContainer::getAnimationScheduler()
+    {
+        return m_animationScheduler;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const AnimationScheduler& GuiContainer::getAnimationScheduler() const
+    {
+        return m_animationScheduler;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::scheduleUpdate(Widget* widget, sf::Time delay)
+    {
+        const sf::Time updateTime = m_currentTime + std::max(delay, sf::Time::Zero);
+        if (widget->m_updateScheduled && (widget->m_scheduledUpdateTime <= updateTime))
+            return;
+
+        // The time that passed while the widget didn't need updates isn't passed to its update function
+        if (!widget->m_updateScheduled)
+            widget->m_lastUpdateTime = m_currentTime;
+
+        widget->m_updateScheduled = true;
+        widget->m_scheduledUpdateTime = updateTime;
+        widget->m_updateRequestedWithoutGui = false;
+
+        m_scheduledUpdates.push_back({updateTime, widget->shared_from_this()});
+        std::push_heap(m_scheduledUpdates.begin(), m_scheduledUpdates.end(),
+                       [](const ScheduledUpdate& left, const ScheduledUpdate& right){ return left.time > right.time; });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::scheduleRequestedUpdates(Widget& widget)
+    {
+        // A widget that was moved from another gui may still have an update scheduled there, which this gui won't process
+        if (widget.m_updateRequestedWithoutGui || widget.m_updateScheduled)
+        {
+            widget.m_updateScheduled = false;
+            scheduleUpdate(&widget, sf::Time::Zero);
+        }
+
+        if (widget.isContainer())
+        {
+            // Widgets that haven't been created yet don't have to be loaded for this
+            for (const auto& child : static_cast<const Container&>(widget).getWidgets())
+                scheduleRequestedUpdates(*child);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::updateScheduledWidgets(sf::Time elapsedTime)
+    {
+        m_currentTime += elapsedTime;
+
+        // Collect the widgets before updating them, updates that get scheduled while updating are only processed next time
+        std::vector<Widget::Ptr> widgetsToUpdate;
+        while (!m_scheduledUpdates.empty() && (m_scheduledUpdates.front().time <= m_currentTime))
+        {
+            std::pop_heap(m_scheduledUpdates.begin(), m_scheduledUpdates.end(),
+                          [](const ScheduledUpdate& left, const ScheduledUpdate& right){ return left.time > right.time; });
+            const ScheduledUpdate scheduledUpdate = std::move(m_scheduledUpdates.back());
+            m_scheduledUpdates.pop_back();
+
+            const auto widget = scheduledUpdate.widget.lock();
+            if (!widget || !widget->m_updateScheduled || (widget->m_scheduledUpdateTime != scheduledUpdate.time))
+                continue;
+
+            widget->m_updateScheduled = false;
+            widgetsToUpdate.push_back(widget);
+        }
+
+        for (const auto& widget : widgetsToUpdate)
+        {
+            // A widget that was removed from the gui gets updated again once it is added to a gui
+            const Widget* root = widget.get();
+            while (root->getParent())
+                root = root->getParent();
+
+            if (root != this)
+            {
+                widget->m_updateRequestedWithoutGui = true;
+                continue;
+            }
+
+            const sf::Time widgetElapsedTime = m_currentTime - widget->m_lastUpdateTime;
+            widget->m_lastUpdateTime = m_currentTime;
+            widget->update(widgetElapsedTime);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool GuiContainer::getTimeUntilScheduledUpdate(sf::Time& timeUntilUpdate) const
+    {
+        if (m_scheduledUpdates.empty())
+            return false;
+
+        // The front of the heap could be outdated, in which case the returned time is earlier than needed
+        timeUntilUpdate = std::max(m_scheduledUpdates.front().time - m_currentTime, sf::Time::Zero);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time GuiContainer::getCurrentTime() const
+    {
+        return m_currentTime;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void GuiContainer::draw(sf::RenderTarget&, sf::RenderStates) const
     {
     }
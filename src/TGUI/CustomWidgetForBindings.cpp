@@ -31,6 +31,14 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    CustomWidgetForBindings::CustomWidgetForBindings()
+    {
+        // The update function is implemented by the user, it is called once and can then schedule its next call itself
+        scheduleUpdate(sf::Time::Zero);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     CustomWidgetForBindings::Ptr CustomWidgetForBindings::create()
     {
         return std::make_shared<CustomWidgetForBindings>();
@@ -121,6 +129,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool CustomWidgetForBindings::canBeHitOutsideBounds() const
+    {
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void CustomWidgetForBindings::leftMousePressed(Vector2f pos)
     {
         Widget::leftMousePressed(pos);
@@ -27,6 +27,7 @@
 #include <TGUI/Clipboard.hpp>
 #include <TGUI/DefaultFont.hpp>
 #include <functional>
+#include <fstream>
 #include <sstream>
 #include <locale>
 #include <cctype> // isspace
@@ -40,6 +41,8 @@ namespace tgui
     {
         unsigned int globalTextSize = 13;
         unsigned int globalDoubleClickTime = 500;
+        bool globalLazyLoadingOfHiddenContainers = false;
+        bool globalTransformOnlyShowAnimations = false;
         std::string globalResourcePath = "";
         std::shared_ptr<sf::Font> globalFont = nullptr;
     }
@@ -101,6 +104,34 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void setLazyLoadingOfHiddenContainers(bool lazy)
+    {
+        globalLazyLoadingOfHiddenContainers = lazy;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool getLazyLoadingOfHiddenContainers()
+    {
+        return globalLazyLoadingOfHiddenContainers;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void setTransformOnlyShowAnimations(bool transformOnly)
+    {
+        globalTransformOnlyShowAnimations = transformOnly;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool getTransformOnlyShowAnimations()
+    {
+        return globalTransformOnlyShowAnimations;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void setResourcePath(const std::string& path)
     {
         globalResourcePath = path;
@@ -128,6 +159,24 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool readFileToString(const std::string& filename, std::string& contents)
+    {
+        std::ifstream file{filename, std::ios::binary | std::ios::ate};
+        if (!file.is_open())
+            return false;
+
+        const std::streamoff size = file.tellg();
+        contents.resize(size > 0 ? static_cast<std::size_t>(size) : 0);
+        file.seekg(0, std::ios::beg);
+        if (!contents.empty())
+            file.read(&contents[0], static_cast<std::streamsize>(contents.size()));
+
+        contents.resize(static_cast<std::size_t>(file.gcount()));
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
     int stoi(const std::string& value)
     {
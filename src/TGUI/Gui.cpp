@@ -26,10 +26,14 @@
 #include <TGUI/Clipboard.hpp>
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/Loading/DataIO.hpp>
 
 #include <SFML/Graphics/RenderTexture.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <set>
 
 #ifdef SFML_SYSTEM_WINDOWS
     #ifndef NOMINMAX // MinGW already defines this which causes a warning without this check
@@ -45,6 +49,52 @@
 
 namespace tgui
 {
+    namespace
+    {
+        bool isAbsolutePath(const std::string& filename)
+        {
+#ifdef SFML_SYSTEM_WINDOWS
+            return !filename.empty() && ((filename[0] == '/') || (filename[0] == '\\') || ((filename.size() > 1) && (filename[1] == ':')));
+#else
+            return !filename.empty() && (filename[0] == '/');
+#endif
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Collects the filenames of the images that are used in the widget file. The values are only inspected superficially,
+        // a filename that is missed or a value that isn't really a texture only affects which images are decoded in advance.
+        void findImageFilenames(const DataIO::Node& node, std::set<std::string>& filenames)
+        {
+            for (const auto& pair : node.propertyValuePairs)
+            {
+                std::string filename = pair.second->value;
+                if (!filename.empty() && (filename[0] == '"'))
+                {
+                    const auto quotePos = filename.find('"', 1);
+                    if (quotePos == std::string::npos)
+                        continue;
+
+                    filename = filename.substr(1, quotePos - 1);
+                }
+
+                const auto dotPos = filename.rfind('.');
+                if (dotPos == std::string::npos)
+                    continue;
+
+                const std::string extension = toLower(filename.substr(dotPos + 1));
+                if ((extension == "png") || (extension == "jpg") || (extension == "jpeg") || (extension == "bmp")
+                 || (extension == "tga") || (extension == "gif") || (extension == "psd") || (extension == "hdr") || (extension == "pic"))
+                {
+                    filenames.insert(filename);
+                }
+            }
+
+            for (const auto& child : node.children)
+                findImageFilenames(*child, filenames);
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Gui::Gui() :
@@ -133,8 +183,7 @@ namespace tgui
             m_container->m_size = view.getSize();
             m_container->onSizeChange.emit(m_container.get(), m_container->getSize());
 
-            for (auto& layout : m_container->m_boundSizeLayouts)
-                layout->recalculateValue();
+            m_container->recalculateBoundLayouts(m_container->m_boundSizeLayouts);
         }
         else // Set it anyway in case something changed that we didn't care to check
             m_view = view;
@@ -153,6 +202,9 @@ namespace tgui
     {
         assert(m_target != nullptr);
 
+        // The widgets have to be at their correct positions before finding the widget below the mouse
+        m_container->updateLayouts();
+
         // Check if the event has something to do with the mouse
         if ((event.type == sf::Event::MouseMoved) || (event.type == sf::Event::TouchMoved)
          || (event.type == sf::Event::MouseButtonPressed) || (event.type == sf::Event::TouchBegan)
@@ -279,6 +331,38 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::setDeferredLayoutUpdatesEnabled(bool enabled)
+    {
+        // Apply the changes that were still waiting before updating the layouts immediately again
+        if (!enabled)
+            m_container->updateLayouts();
+
+        m_container->m_deferLayoutUpdates = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isDeferredLayoutUpdatesEnabled() const
+    {
+        return m_container->m_deferLayoutUpdates;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::updateLayouts()
+    {
+        m_container->updateLayouts();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    AnimationScheduler& Gui::getAnimationScheduler()
+    {
+        return m_container->getAnimationScheduler();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::draw()
     {
         assert(m_target != nullptr);
@@ -289,6 +373,9 @@ namespace tgui
         else
             m_clock.restart();
 
+        // Apply the layout changes before drawing the widgets at their new positions
+        m_container->updateLayouts();
+
         // Change the view
         const sf::View oldView = m_target->getView();
         m_target->setView(m_view);
@@ -457,9 +544,22 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Gui::saveWidgetsToFile(const std::string& filename)
+    std::future<void> Gui::loadWidgetsFromFileAsync(const std::string& filename, bool replaceExisting)
+    {
+        AsyncLoad load;
+        load.parsedFile = std::async(std::launch::async, &Gui::parseWidgetFile, filename, getResourcePath(), Texture::getImageLoader());
+        load.replaceExisting = replaceExisting;
+
+        auto future = load.finished.get_future();
+        m_asyncLoads.push_back(std::move(load));
+        return future;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::saveWidgetsToFile(const std::string& filename, bool binary)
     {
-        m_container->saveWidgetsToFile(filename);
+        m_container->saveWidgetsToFile(filename, binary);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -478,17 +578,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Gui::saveWidgetsToStream(std::stringstream& stream) const
+    void Gui::saveWidgetsToStream(std::stringstream& stream, bool binary) const
     {
-        m_container->saveWidgetsToStream(stream);
+        m_container->saveWidgetsToStream(stream, binary);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Gui::updateTime(const sf::Time& elapsedTime)
     {
-        m_container->m_animationTimeElapsed = elapsedTime;
-        m_container->update(elapsedTime);
+        if (!m_asyncLoads.empty())
+            finishAsyncLoads();
+
+        // Only the widgets that asked for it are updated, instead of visiting every widget in the gui
+        m_container->updateScheduledWidgets(elapsedTime);
+        m_container->getAnimationScheduler().update(elapsedTime);
 
         if (m_tooltipPossible)
         {
@@ -512,6 +616,31 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Gui::getTimeUntilNextUpdate(sf::Time& timeUntilUpdate) const
+    {
+        if (!m_asyncLoads.empty() || (m_container->getAnimationScheduler().getAnimationCount() > 0))
+        {
+            timeUntilUpdate = sf::Time::Zero;
+            return true;
+        }
+
+        sf::Time timeUntilScheduledUpdate;
+        const bool updateScheduled = m_container->getTimeUntilScheduledUpdate(timeUntilScheduledUpdate);
+        if (m_tooltipPossible)
+        {
+            const sf::Time timeUntilToolTip = std::max(ToolTip::getInitialDelay() - m_tooltipTime, sf::Time::Zero);
+            timeUntilUpdate = updateScheduled ? std::min(timeUntilScheduledUpdate, timeUntilToolTip) : timeUntilToolTip;
+            return true;
+        }
+
+        if (updateScheduled)
+            timeUntilUpdate = timeUntilScheduledUpdate;
+
+        return updateScheduled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::init()
     {
     #ifdef SFML_SYSTEM_WINDOWS
@@ -522,6 +651,81 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::finishAsyncLoads()
+    {
+        // The finished loads are taken out of the list first, as loading widgets could start another asynchronous load
+        std::vector<AsyncLoad> finishedLoads;
+        for (auto it = m_asyncLoads.begin(); it != m_asyncLoads.end();)
+        {
+            if (it->parsedFile.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+            {
+                finishedLoads.push_back(std::move(*it));
+                it = m_asyncLoads.erase(it);
+            }
+            else
+                ++it;
+        }
+
+        for (auto& load : finishedLoads)
+        {
+            const auto oldImageLoader = Texture::getImageLoader();
+            try
+            {
+                const auto parsedFile = load.parsedFile.get();
+
+                // Let the textures use the images that were already decoded on the worker thread
+                auto* images = &parsedFile->images;
+                Texture::setImageLoader([images,oldImageLoader](const sf::String& filename){
+                        const auto it = images->find(filename);
+                        if (it == images->end())
+                            return oldImageLoader(filename);
+
+                        auto image = std::move(it->second);
+                        images->erase(it);
+                        return image;
+                    });
+
+                m_container->loadWidgetsFromNodeTree(parsedFile->rootNode, load.replaceExisting);
+
+                Texture::setImageLoader(oldImageLoader);
+                load.finished.set_value();
+            }
+            catch (...)
+            {
+                Texture::setImageLoader(oldImageLoader);
+                load.finished.set_exception(std::current_exception());
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<Gui::ParsedWidgetFile> Gui::parseWidgetFile(const std::string& filename, const std::string& resourcePath,
+                                                                const Texture::ImageLoaderFunc& imageLoader)
+    {
+        std::string contents;
+        if (!readFileToString(filename, contents))
+            throw Exception{"Failed to open '" + filename + "' to load the widgets from it."};
+
+        auto parsedFile = std::make_shared<ParsedWidgetFile>();
+        parsedFile->rootNode = DataIO::parse(contents.data(), contents.size());
+
+        std::set<std::string> imageFilenames;
+        findImageFilenames(*parsedFile->rootNode, imageFilenames);
+        for (const auto& imageFilename : imageFilenames)
+        {
+            // Use the same filename as the texture will pass to the image loader
+            const sf::String fullFilename = isAbsolutePath(imageFilename) ? imageFilename : resourcePath + imageFilename;
+            auto image = imageLoader(fullFilename);
+            if (image)
+                parsedFile->images[fullFilename] = std::move(image);
+        }
+
+        return parsedFile;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
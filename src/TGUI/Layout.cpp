@@ -29,6 +29,19 @@
 #include <TGUI/to_string.hpp>
 #include <SFML/System/Err.hpp>
 #include <cassert>
+#include <mutex>
+#include <unordered_map>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Expressions that need a larger stack than this use memory allocated on the heap during their calculation
+    const unsigned int MaxInlineStackSize = 16;
+
+    // Maximum number of different strings for which the parsed expression is remembered, the cache is emptied when it is full
+    const std::size_t MaxCachedExpressions = 1024;
+}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -65,6 +78,36 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout::Layout(std::string expression)
+    {
+        // Forms tend to contain the same expressions many times, so the result of parsing a string is reused
+        static std::mutex cacheMutex;
+        static std::unordered_map<std::string, ParsedExpression> cache;
+        {
+            std::lock_guard<std::mutex> lock{cacheMutex};
+            const auto it = cache.find(expression);
+            if (it != cache.end())
+            {
+                m_program = it->second.program;
+                m_value = it->second.value;
+                if (getBindingCount() > m_bindings.size())
+                    m_extraBindings.resize(getBindingCount() - m_bindings.size());
+                return;
+            }
+        }
+
+        std::string key = expression;
+        parseExpression(std::move(expression));
+
+        std::lock_guard<std::mutex> lock{cacheMutex};
+        if (cache.size() >= MaxCachedExpressions)
+            cache.clear();
+
+        cache.emplace(std::move(key), ParsedExpression{m_program, m_value});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::parseExpression(std::string expression)
     {
         // Empty strings have value 0 (although this might indicate a mistake in the expression, it is valid for unary minus)
         expression = trim(expression);
@@ -82,14 +125,13 @@ namespace tgui
                 // We don't know if we have to bind the width or height, so bind "size" and let the connectWidget function figure it out later
                 if (expression == "100%")
                 {
-                    m_boundString = "&.innersize";
-                    m_operation = Operation::BindingString;
+                    m_program = createBindingProgram("&.innersize");
                 }
                 else // value is a fraction of parent size
                 {
                     *this = Layout{Layout::Operation::Multiplies,
-                                   std::make_unique<Layout>(strToFloat(expression.substr(0, expression.length()-1)) / 100.f),
-                                   std::make_unique<Layout>("&.innersize")};
+                                   Layout{strToFloat(expression.substr(0, expression.length()-1)) / 100.f},
+                                   Layout{"&.innersize"}};
                 }
             }
             else
@@ -114,20 +156,19 @@ namespace tgui
                  || (expression.size() >= 11 && expression.substr(expression.size()-11) == "innerheight"))
                 {
                     // We can't search for the referenced widget yet as no widget is connected to the widget yet, so store the string for future parsing
-                    m_boundString = expression;
-                    m_operation = Operation::BindingString;
+                    m_program = createBindingProgram(expression);
                 }
                 else if (expression.size() >= 5 && expression.substr(expression.size()-5) == "right")
                 {
                     *this = Layout{Operation::Plus,
-                                   std::make_unique<Layout>(expression.substr(0, expression.size()-5) + "left"),
-                                   std::make_unique<Layout>(expression.substr(0, expression.size()-5) + "width")};
+                                   Layout{expression.substr(0, expression.size()-5) + "left"},
+                                   Layout{expression.substr(0, expression.size()-5) + "width"}};
                 }
                 else if (expression.size() >= 6 && expression.substr(expression.size()-6) == "bottom")
                 {
                     *this = Layout{Operation::Plus,
-                                   std::make_unique<Layout>(expression.substr(0, expression.size()-6) + "top"),
-                                   std::make_unique<Layout>(expression.substr(0, expression.size()-6) + "height")};
+                                   Layout{expression.substr(0, expression.size()-6) + "top"},
+                                   Layout{expression.substr(0, expression.size()-6) + "height"}};
                 }
                 else // Constant value
                     m_value = strToFloat(expression);
@@ -182,13 +223,13 @@ namespace tgui
                         else if ((searchPos == 3) && (bracketPos == expression.size()-1) && (expression.substr(0, 3) == "min"))
                         {
                             const auto& minSubExpressions = parseMinMaxExpresssion(expression.substr(4, expression.size() - 5));
-                            *this = Layout{Operation::Minimum, std::make_unique<Layout>(minSubExpressions.first), std::make_unique<Layout>(minSubExpressions.second)};
+                            *this = Layout{Operation::Minimum, Layout{minSubExpressions.first}, Layout{minSubExpressions.second}};
                             return;
                         }
                         else if ((searchPos == 3) && (bracketPos == expression.size()-1) && (expression.substr(0, 3) == "max"))
                         {
                             const auto& maxSubExpressions = parseMinMaxExpresssion(expression.substr(4, expression.size() - 5));
-                            *this = Layout{Operation::Maximum, std::make_unique<Layout>(maxSubExpressions.first), std::make_unique<Layout>(maxSubExpressions.second)};
+                            *this = Layout{Operation::Maximum, Layout{maxSubExpressions.first}, Layout{maxSubExpressions.second}};
                             return;
                         }
                         else // The brackets form a sub-expression
@@ -240,8 +281,8 @@ namespace tgui
                 std::advance(nextOperandIt, 1);
 
                 (*operandIt) = Layout{operators[i],
-                                      std::make_unique<Layout>(*operandIt),
-                                      std::make_unique<Layout>(*nextOperandIt)};
+                                      *operandIt,
+                                      *nextOperandIt};
 
                 operands.erase(nextOperandIt);
             }
@@ -263,7 +304,7 @@ namespace tgui
                 assert(nextOperandIt != operands.end());
 
                 // Handle unary plus or minus
-                if ((operandIt->m_operation == Operation::Value) && (nextOperandIt->m_operation == Operation::Value) && (operandIt->m_value == 0))
+                if (operandIt->isConstant() && nextOperandIt->isConstant() && (operandIt->m_value == 0))
                 {
                     if (operators[i] == Operation::Minus)
                         nextOperandIt->m_value = -nextOperandIt->m_value;
@@ -273,8 +314,8 @@ namespace tgui
                 else // Normal addition or subtraction
                 {
                     *operandIt = Layout{operators[i],
-                                        std::make_unique<Layout>(*operandIt),
-                                        std::make_unique<Layout>(*nextOperandIt)};
+                                        *operandIt,
+                                        *nextOperandIt};
                 }
 
                 operands.erase(nextOperandIt);
@@ -282,88 +323,94 @@ namespace tgui
         }
 
         assert(operands.size() == 1);
-        *this = operands.front();
+        *this = std::move(operands.front());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout::Layout(Operation operation, Widget* boundWidget) :
-        m_operation  {operation},
-        m_boundWidget{boundWidget}
+        m_program{createBindingProgram("")}
     {
-        assert((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop)
-               || (m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight)
-               || (m_operation == Operation::BindingInnerWidth) || (m_operation == Operation::BindingInnerHeight));
-        assert(m_boundWidget != nullptr);
+        assert((operation == Operation::BindingLeft) || (operation == Operation::BindingTop)
+               || (operation == Operation::BindingWidth) || (operation == Operation::BindingHeight)
+               || (operation == Operation::BindingInnerWidth) || (operation == Operation::BindingInnerHeight));
+        assert(boundWidget != nullptr);
 
-        if (m_operation == Operation::BindingLeft)
-            m_value = m_boundWidget->getPosition().x;
-        else if (m_operation == Operation::BindingTop)
-            m_value = m_boundWidget->getPosition().y;
-        else if (m_operation == Operation::BindingWidth)
-            m_value = m_boundWidget->getSize().x;
-        else if (m_operation == Operation::BindingHeight)
-            m_value = m_boundWidget->getSize().y;
-        else if (m_operation == Operation::BindingInnerWidth)
-        {
-            const auto* boundContainer = dynamic_cast<Container*>(boundWidget);
-            if (boundContainer)
-                m_value = boundContainer->getInnerSize().x;
-        }
-        else if (m_operation == Operation::BindingInnerHeight)
-        {
-            const auto* boundContainer = dynamic_cast<Container*>(boundWidget);
-            if (boundContainer)
-                m_value = boundContainer->getInnerSize().y;
-        }
+        m_bindings[0].operation = operation;
+        m_bindings[0].widget = boundWidget;
 
         resetPointers();
-        recalculateValue();
+        m_value = calculateValue();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Layout::Layout(Operation operation, std::unique_ptr<Layout> leftOperand, std::unique_ptr<Layout> rightOperand) :
-        m_operation   {operation},
-        m_leftOperand {std::move(leftOperand)},
-        m_rightOperand{std::move(rightOperand)}
+    Layout::Layout(Operation operation, const Layout& leftOperand, const Layout& rightOperand)
     {
-        assert(m_leftOperand != nullptr);
-        assert(m_rightOperand != nullptr);
+        assert((operation == Operation::Plus) || (operation == Operation::Minus)
+               || (operation == Operation::Multiplies) || (operation == Operation::Divides)
+               || (operation == Operation::Minimum) || (operation == Operation::Maximum));
+
+        // The instructions of both operands are placed after each other, followed by the operation that combines their results
+        auto program = std::make_shared<Program>();
+        for (const Layout* operand : {&leftOperand, &rightOperand})
+        {
+            if (operand->m_program)
+            {
+                const auto bindingOffset = static_cast<unsigned int>(program->bindingStrings.size());
+                for (const auto& instruction : operand->m_program->instructions)
+                {
+                    program->instructions.push_back(instruction);
+                    if (instruction.operation == Operation::BindingString)
+                        program->instructions.back().bindingIndex += bindingOffset;
+                }
+
+                program->bindingStrings.insert(program->bindingStrings.end(),
+                                               operand->m_program->bindingStrings.begin(), operand->m_program->bindingStrings.end());
+            }
+            else
+                program->instructions.push_back({Operation::Value, operand->m_value, 0});
+        }
+
+        program->instructions.push_back({operation, 0, 0});
+
+        // The result of the left operand stays on the stack while the right operand is being calculated
+        const unsigned int leftStackSize = leftOperand.m_program ? leftOperand.m_program->maxStackSize : 1;
+        const unsigned int rightStackSize = rightOperand.m_program ? rightOperand.m_program->maxStackSize : 1;
+        program->maxStackSize = std::max(leftStackSize, rightStackSize + 1);
+
+        m_program = std::move(program);
+        if (m_program->bindingStrings.size() > m_bindings.size())
+            m_extraBindings.resize(m_program->bindingStrings.size() - m_bindings.size());
+
+        const std::size_t leftBindingCount = leftOperand.getBindingCount();
+        for (std::size_t i = 0; i < leftBindingCount; ++i)
+            getBinding(i) = leftOperand.getBinding(i);
+        for (std::size_t i = 0; i < rightOperand.getBindingCount(); ++i)
+            getBinding(leftBindingCount + i) = rightOperand.getBinding(i);
+
+        resetStringBindings();
         resetPointers();
-        recalculateValue();
+        m_value = calculateValue();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout::Layout(const Layout& other) :
-        m_value          {other.m_value},
-        m_parent         {other.m_parent},
-        m_operation      {other.m_operation},
-        m_leftOperand    {other.m_leftOperand ? std::make_unique<Layout>(*other.m_leftOperand) : nullptr},
-        m_rightOperand   {other.m_rightOperand ? std::make_unique<Layout>(*other.m_rightOperand) : nullptr},
-        m_boundWidget    {other.m_boundWidget},
-        m_boundString    {other.m_boundString}
-    {
-        // Disconnect the bound widget if a string was used, the same name may apply to a different widget now
-        if (!m_boundString.empty())
-            m_boundWidget = nullptr;
-
+        m_value        {other.m_value},
+        m_program      {other.m_program},
+        m_bindings     (other.m_bindings),
+        m_extraBindings(other.m_extraBindings)
+    {
+        resetStringBindings();
         resetPointers();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Layout::Layout(Layout&& other) :
-        m_value          {std::move(other.m_value)},
-        m_parent         {std::move(other.m_parent)},
-        m_operation      {other.m_operation},
-        m_leftOperand    {std::move(other.m_leftOperand)},
-        m_rightOperand   {std::move(other.m_rightOperand)},
-        m_boundWidget    {other.m_boundWidget},
-        m_boundString    {std::move(other.m_boundString)}
+    Layout::Layout(Layout&& other)
     {
-        resetPointers();
+        stealProgram(other);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -374,18 +421,12 @@ namespace tgui
         {
             unbindLayout();
 
-            m_value           = other.m_value;
-            m_parent          = other.m_parent;
-            m_operation       = other.m_operation;
-            m_leftOperand     = other.m_leftOperand ? std::make_unique<Layout>(*other.m_leftOperand) : nullptr;
-            m_rightOperand    = other.m_rightOperand ? std::make_unique<Layout>(*other.m_rightOperand) : nullptr;
-            m_boundWidget     = other.m_boundWidget;
-            m_boundString     = other.m_boundString;
-
-            // Disconnect the bound widget if a string was used, the same name may apply to a different widget now
-            if (!m_boundString.empty())
-                m_boundWidget = nullptr;
+            m_value         = other.m_value;
+            m_program       = other.m_program;
+            m_bindings      = other.m_bindings;
+            m_extraBindings = other.m_extraBindings;
 
+            resetStringBindings();
             resetPointers();
         }
 
@@ -399,16 +440,7 @@ namespace tgui
         if (this != &other)
         {
             unbindLayout();
-
-            m_value           = std::move(other.m_value);
-            m_parent          = std::move(other.m_parent);
-            m_operation       = other.m_operation;
-            m_leftOperand     = std::move(other.m_leftOperand);
-            m_rightOperand    = std::move(other.m_rightOperand);
-            m_boundWidget     = other.m_boundWidget;
-            m_boundString     = std::move(other.m_boundString);
-
-            resetPointers();
+            stealProgram(other);
         }
 
         return *this;
@@ -425,295 +457,479 @@ namespace tgui
 
     std::string Layout::toString() const
     {
-        if (m_operation == Operation::Value)
-        {
+        if (!m_program)
             return to_string(m_value);
-        }
-        else if (m_operation == Operation::Minimum)
+
+        std::size_t index = m_program->instructions.size() - 1;
+        return subExpressionToString(index).str;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::connectWidget(Widget* widget, bool xAxis, std::function<void()> valueChangedCallbackHandler)
+    {
+        const float oldValue = m_value;
+
+        if (m_program)
         {
-            return "min(" + m_leftOperand->toString() + ", " + m_rightOperand->toString() + ")";
+            // Parse the string bindings even when the referred widgets were already found. The widget may be added to a different parent
+            bool bindingsChanged = false;
+            for (std::size_t i = 0; i < getBindingCount(); ++i)
+            {
+                if (m_program->bindingStrings[i].empty())
+                    continue;
+
+                Binding binding = getBinding(i);
+                if (!parseBindingString(m_program->bindingStrings[i], widget, xAxis, binding))
+                    continue;
+
+                if ((binding.widget == getBinding(i).widget) && (binding.operation == getBinding(i).operation))
+                    continue;
+
+                if (!bindingsChanged)
+                {
+                    unbindLayout();
+                    bindingsChanged = true;
+                }
+
+                getBinding(i) = binding;
+            }
+
+            if (bindingsChanged)
+                resetPointers();
+
+            m_value = calculateValue();
         }
-        else if (m_operation == Operation::Maximum)
+
+        m_connectedWidgetCallback = valueChangedCallbackHandler;
+        m_connectedWidget = widget;
+
+        if (m_value != oldValue)
         {
-            return "max(" + m_leftOperand->toString() + ", " + m_rightOperand->toString() + ")";
+            if (m_connectedWidgetCallback)
+                m_connectedWidgetCallback();
         }
-        else if ((m_operation == Operation::Plus) || (m_operation == Operation::Minus) || (m_operation == Operation::Multiplies) || (m_operation == Operation::Divides))
-        {
-            char operatorChar;
-            if (m_operation == Operation::Plus)
-                operatorChar = '+';
-            else if (m_operation == Operation::Minus)
-                operatorChar = '-';
-            else if (m_operation == Operation::Multiplies)
-                operatorChar = '*';
-            else // if (m_operation == Operation::Divides)
-                operatorChar = '/';
-
-            auto subExpressionNeedsBrackets = [](const std::unique_ptr<Layout>& operand)
-                {
-                    if (!operand->m_leftOperand)
-                        return false;
+    }
 
-                    if ((operand->m_operation == Operation::Minimum) || (operand->m_operation == Operation::Maximum))
-                        return false;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                    if ((operand->m_operation == Operation::Multiplies) && (operand->m_leftOperand->m_operation == Operation::Value) && (operand->m_rightOperand->toString() == "100%"))
-                        return false;
+    void Layout::unbindWidget(Widget* widget)
+    {
+        if (!m_program)
+            return;
 
-                    return true;
-                };
+        for (std::size_t i = 0; i < getBindingCount(); ++i)
+        {
+            Binding& binding = getBinding(i);
+            if (binding.widget != widget)
+                continue;
 
-            if (subExpressionNeedsBrackets(m_leftOperand) && subExpressionNeedsBrackets(m_rightOperand))
-                return "(" + m_leftOperand->toString() + ") " + operatorChar + " (" + m_rightOperand->toString() + ")";
-            else if (subExpressionNeedsBrackets(m_leftOperand))
-                return "(" + m_leftOperand->toString() + ") " + operatorChar + " " + m_rightOperand->toString();
-            else if (subExpressionNeedsBrackets(m_rightOperand))
-                return m_leftOperand->toString() + " " + operatorChar + " (" + m_rightOperand->toString() + ")";
+            binding.widget = nullptr;
+            if (!m_program->bindingStrings[i].empty())
+                binding.operation = Operation::BindingString;
             else
             {
-                if ((m_operation == Operation::Multiplies) && (m_leftOperand->m_operation == Operation::Value) && (m_rightOperand->toString() == "100%"))
-                    return to_string(m_leftOperand->getValue() * 100) + '%';
-                else
-                    return m_leftOperand->toString() + " " + operatorChar + " " + m_rightOperand->toString();
+                binding.value = 0;
+                binding.operation = Operation::Value;
             }
         }
-        else
-        {
-            if (m_boundString == "&.innersize")
-                return "100%";
 
-            // Hopefully the expression is stored in the bound string, otherwise (i.e. when bind functions were used) it is infeasible to turn it into a string
-            return m_boundString;
+        // A layout that only consisted of the binding is now just a constant
+        if ((m_program->instructions.size() == 1) && (m_bindings[0].operation == Operation::Value))
+        {
+            m_program = nullptr;
+            m_bindings[0] = {};
         }
+
+        recalculateValue();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::unbindLayout()
+    void Layout::recalculateValue()
     {
-        if (m_boundWidget)
-        {
-            assert((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop)
-                   || (m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight)
-                   || (m_operation == Operation::BindingInnerWidth) || (m_operation == Operation::BindingInnerHeight));
+        const float oldValue = m_value;
+        updateValue();
 
-            if ((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop))
-                m_boundWidget->unbindPositionLayout(this);
-            else
-                m_boundWidget->unbindSizeLayout(this);
+        if (m_value != oldValue)
+        {
+            if (m_connectedWidgetCallback)
+                m_connectedWidgetCallback();
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::resetPointers()
+    void Layout::updateValue()
     {
-        if (m_leftOperand != nullptr)
-        {
-            assert(m_rightOperand != nullptr);
+        if (m_program)
+            m_value = calculateValue();
+    }
 
-            m_leftOperand->m_parent = this;
-            m_rightOperand->m_parent = this;
-        }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget* Layout::getConnectedWidget() const
+    {
+        return m_connectedWidget;
+    }
 
-        if (m_boundWidget)
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::getBoundWidgets(std::vector<Widget*>& boundWidgets) const
+    {
+        for (std::size_t i = 0; i < getBindingCount(); ++i)
         {
-            assert((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop)
-                   || (m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight)
-                   || (m_operation == Operation::BindingInnerWidth) || (m_operation == Operation::BindingInnerHeight));
+            if (getBinding(i).widget)
+                boundWidgets.push_back(getBinding(i).widget);
+        }
+    }
 
-            if ((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop))
-                m_boundWidget->bindPositionLayout(this);
-            else
-                m_boundWidget->bindSizeLayout(this);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<const Layout::Program> Layout::createBindingProgram(std::string boundString)
+    {
+        // Layouts created with the bind functions all have the same program, so they can share it
+        if (boundString.empty())
+        {
+            static const auto unnamedBindingProgram = []{
+                    auto program = std::make_shared<Program>();
+                    program->instructions.push_back({Operation::BindingString, 0, 0});
+                    program->bindingStrings.emplace_back();
+                    program->maxStackSize = 1;
+                    return std::shared_ptr<const Program>{std::move(program)};
+                }();
+
+            return unnamedBindingProgram;
         }
+
+        auto program = std::make_shared<Program>();
+        program->instructions.push_back({Operation::BindingString, 0, 0});
+        program->bindingStrings.push_back(std::move(boundString));
+        program->maxStackSize = 1;
+        return program;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::connectWidget(Widget* widget, bool xAxis, std::function<void()> valueChangedCallbackHandler)
+    std::size_t Layout::getBindingCount() const
     {
-        const float oldValue = m_value;
+        return m_program ? m_program->bindingStrings.size() : 0;
+    }
 
-        // No callbacks must be made while parsing, a single callback will be made when done if needed
-        m_connectedWidgetCallback = nullptr;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        parseBindingStringRecursive(widget, xAxis);
+    Layout::Binding& Layout::getBinding(std::size_t index)
+    {
+        if (index < m_bindings.size())
+            return m_bindings[index];
+        else
+            return m_extraBindings[index - m_bindings.size()];
+    }
 
-        // Restore the callback function
-        m_connectedWidgetCallback = valueChangedCallbackHandler;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        if (m_value != oldValue)
-        {
-            if (m_connectedWidgetCallback)
-                m_connectedWidgetCallback();
-        }
+    const Layout::Binding& Layout::getBinding(std::size_t index) const
+    {
+        if (index < m_bindings.size())
+            return m_bindings[index];
+        else
+            return m_extraBindings[index - m_bindings.size()];
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::unbindWidget()
+    float Layout::calculateValue()
     {
-        m_boundWidget = nullptr;
+        assert(m_program != nullptr);
 
-        if (!m_boundString.empty())
-            m_operation = Operation::BindingString;
-        else
+        // Small expressions are evaluated without allocating memory
+        float inlineStack[MaxInlineStackSize];
+        std::vector<float> allocatedStack;
+        float* stack = inlineStack;
+        if (m_program->maxStackSize > MaxInlineStackSize)
         {
-            m_value = 0;
-            m_operation = Operation::Value;
+            allocatedStack.resize(m_program->maxStackSize);
+            stack = allocatedStack.data();
         }
 
-        recalculateValue();
+        std::size_t stackSize = 0;
+        for (const auto& instruction : m_program->instructions)
+        {
+            switch (instruction.operation)
+            {
+                case Operation::Value:
+                    stack[stackSize++] = instruction.value;
+                    break;
+                case Operation::BindingString:
+                {
+                    Binding& binding = getBinding(instruction.bindingIndex);
+                    updateBindingValue(binding);
+                    stack[stackSize++] = binding.value;
+                    break;
+                }
+                default:
+                {
+                    assert(stackSize >= 2);
+                    const float right = stack[--stackSize];
+                    float& left = stack[stackSize - 1];
+                    switch (instruction.operation)
+                    {
+                        case Operation::Plus:
+                            left = left + right;
+                            break;
+                        case Operation::Minus:
+                            left = left - right;
+                            break;
+                        case Operation::Multiplies:
+                            left = left * right;
+                            break;
+                        case Operation::Divides:
+                            if (right != 0)
+                                left = left / right;
+                            else
+                                left = 0;
+                            break;
+                        case Operation::Minimum:
+                            left = std::min(left, right);
+                            break;
+                        case Operation::Maximum:
+                            left = std::max(left, right);
+                            break;
+                        default:
+                            assert(false);
+                            break;
+                    };
+                    break;
+                }
+            };
+        }
+
+        assert(stackSize == 1);
+        return stack[0];
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::recalculateValue()
+    void Layout::updateBindingValue(Binding& binding)
     {
-        const float oldValue = m_value;
-
-        switch (m_operation)
+        switch (binding.operation)
         {
-            case Operation::Value:
-                break;
-            case Operation::Plus:
-                m_value = m_leftOperand->getValue() + m_rightOperand->getValue();
-                break;
-            case Operation::Minus:
-                m_value = m_leftOperand->getValue() - m_rightOperand->getValue();
-                break;
-            case Operation::Multiplies:
-                m_value = m_leftOperand->getValue() * m_rightOperand->getValue();
-                break;
-            case Operation::Divides:
-                if (m_rightOperand->getValue() != 0)
-                    m_value = m_leftOperand->getValue() / m_rightOperand->getValue();
-                else
-                    m_value = 0;
-                break;
-            case Operation::Minimum:
-                m_value = std::min(m_leftOperand->getValue(), m_rightOperand->getValue());
-                break;
-            case Operation::Maximum:
-                m_value = std::max(m_leftOperand->getValue(), m_rightOperand->getValue());
-                break;
             case Operation::BindingLeft:
-                m_value = m_boundWidget->getPosition().x;
+                binding.value = binding.widget->getPosition().x;
                 break;
             case Operation::BindingTop:
-                m_value = m_boundWidget->getPosition().y;
+                binding.value = binding.widget->getPosition().y;
                 break;
             case Operation::BindingWidth:
-                m_value = m_boundWidget->getSize().x;
+                binding.value = binding.widget->getSize().x;
                 break;
             case Operation::BindingHeight:
-                m_value = m_boundWidget->getSize().y;
+                binding.value = binding.widget->getSize().y;
                 break;
             case Operation::BindingInnerWidth:
-            {
-                const auto* boundContainer = dynamic_cast<Container*>(m_boundWidget);
-                if (boundContainer)
-                    m_value = boundContainer->getInnerSize().x;
+                if (binding.widget->isContainer())
+                    binding.value = static_cast<Container*>(binding.widget)->getInnerSize().x;
                 break;
-            }
             case Operation::BindingInnerHeight:
-            {
-                const auto* boundContainer = dynamic_cast<Container*>(m_boundWidget);
-                if (boundContainer)
-                    m_value = boundContainer->getInnerSize().y;
+                if (binding.widget->isContainer())
+                    binding.value = static_cast<Container*>(binding.widget)->getInnerSize().y;
                 break;
-            }
-            case Operation::BindingString:
-                // The string should have already been parsed by now.
-                // Passing here either means something is wrong with the string or the layout was not connected to a widget with a parent yet.
+            default:
+                // The value isn't changed when the binding doesn't refer to a widget.
+                // For a string binding this either means something is wrong with the string or the layout was not connected to a widget with a parent yet.
                 break;
         };
+    }
 
-        if (m_value != oldValue)
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Layout::SubExpressionString Layout::subExpressionToString(std::size_t& index) const
+    {
+        const Instruction& instruction = m_program->instructions[index];
+        if (instruction.operation == Operation::Value)
+            return {to_string(instruction.value), false, true, instruction.value};
+
+        if (instruction.operation == Operation::BindingString)
         {
-            if (m_parent)
-                m_parent->recalculateValue();
+            const Binding& binding = getBinding(instruction.bindingIndex);
+            if (binding.operation == Operation::Value)
+                return {to_string(binding.value), false, true, binding.value};
+
+            const std::string& boundString = m_program->bindingStrings[instruction.bindingIndex];
+            if (boundString == "&.innersize")
+                return {"100%", false, false, 0};
+
+            // Hopefully the expression is stored in the bound string, otherwise (i.e. when bind functions were used) it is infeasible to turn it into a string
+            return {boundString, false, false, 0};
+        }
+
+        // The right operand ends right before the operation, the left operand ends right before the right operand
+        assert(index >= 2);
+        --index;
+        const auto right = subExpressionToString(index);
+        --index;
+        const auto left = subExpressionToString(index);
+
+        if (instruction.operation == Operation::Minimum)
+            return {"min(" + left.str + ", " + right.str + ")", false, false, 0};
+        else if (instruction.operation == Operation::Maximum)
+            return {"max(" + left.str + ", " + right.str + ")", false, false, 0};
+
+        char operatorChar;
+        if (instruction.operation == Operation::Plus)
+            operatorChar = '+';
+        else if (instruction.operation == Operation::Minus)
+            operatorChar = '-';
+        else if (instruction.operation == Operation::Multiplies)
+            operatorChar = '*';
+        else // if (instruction.operation == Operation::Divides)
+            operatorChar = '/';
+
+        if (left.needsBrackets && right.needsBrackets)
+            return {"(" + left.str + ") " + operatorChar + " (" + right.str + ")", true, false, 0};
+        else if (left.needsBrackets)
+            return {"(" + left.str + ") " + operatorChar + " " + right.str, true, false, 0};
+        else if (right.needsBrackets)
+            return {left.str + " " + operatorChar + " (" + right.str + ")", true, false, 0};
+        else
+        {
+            if ((instruction.operation == Operation::Multiplies) && left.isValue && (right.str == "100%"))
+                return {to_string(left.value * 100) + '%', false, false, 0};
             else
-            {
-                // The topmost layout must tell the connected widget about the new value
-                if (m_connectedWidgetCallback)
-                    m_connectedWidgetCallback();
-            }
+                return {left.str + " " + operatorChar + " " + right.str, true, false, 0};
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::parseBindingStringRecursive(Widget* widget, bool xAxis)
+    void Layout::resetStringBindings()
+    {
+        // Disconnect the bound widgets if a string was used, the same name may apply to a different widget now
+        for (std::size_t i = 0; i < getBindingCount(); ++i)
+        {
+            if (m_program->bindingStrings[i].empty())
+                continue;
+
+            Binding& binding = getBinding(i);
+            binding.widget = nullptr;
+            binding.operation = Operation::BindingString;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::stealProgram(Layout& other)
+    {
+        other.unbindLayout();
+
+        m_value         = other.m_value;
+        m_program       = std::move(other.m_program);
+        m_bindings      = other.m_bindings;
+        m_extraBindings = std::move(other.m_extraBindings);
+
+        other.m_program = nullptr;
+        other.m_bindings = {};
+        other.m_extraBindings.clear();
+
+        resetPointers();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::unbindLayout()
     {
-        if (m_leftOperand)
+        for (std::size_t i = 0; i < getBindingCount(); ++i)
         {
-            assert(m_rightOperand != nullptr);
+            const Binding& binding = getBinding(i);
+            if (!binding.widget)
+                continue;
+
+            assert((binding.operation == Operation::BindingLeft) || (binding.operation == Operation::BindingTop)
+                   || (binding.operation == Operation::BindingWidth) || (binding.operation == Operation::BindingHeight)
+                   || (binding.operation == Operation::BindingInnerWidth) || (binding.operation == Operation::BindingInnerHeight));
 
-            m_leftOperand->parseBindingStringRecursive(widget, xAxis);
-            m_rightOperand->parseBindingStringRecursive(widget, xAxis);
+            if ((binding.operation == Operation::BindingLeft) || (binding.operation == Operation::BindingTop))
+                binding.widget->unbindPositionLayout(this);
+            else
+                binding.widget->unbindSizeLayout(this);
         }
+    }
 
-        // Parse the string binding even when the referred widget was already found. The widget may be added to a different parent
-        if (!m_boundString.empty())
-            parseBindingString(m_boundString, widget, xAxis);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::resetPointers()
+    {
+        for (std::size_t i = 0; i < getBindingCount(); ++i)
+        {
+            const Binding& binding = getBinding(i);
+            if (!binding.widget)
+                continue;
+
+            assert((binding.operation == Operation::BindingLeft) || (binding.operation == Operation::BindingTop)
+                   || (binding.operation == Operation::BindingWidth) || (binding.operation == Operation::BindingHeight)
+                   || (binding.operation == Operation::BindingInnerWidth) || (binding.operation == Operation::BindingInnerHeight));
+
+            if ((binding.operation == Operation::BindingLeft) || (binding.operation == Operation::BindingTop))
+                binding.widget->bindPositionLayout(this);
+            else
+                binding.widget->bindSizeLayout(this);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::parseBindingString(const std::string& expression, Widget* widget, bool xAxis)
+    bool Layout::parseBindingString(const std::string& expression, Widget* widget, bool xAxis, Binding& binding)
     {
         if (expression == "x" || expression == "left")
         {
-            m_operation = Operation::BindingLeft;
-            m_boundWidget = widget;
+            binding.operation = Operation::BindingLeft;
+            binding.widget = widget;
         }
         else if (expression == "y" || expression == "top")
         {
-            m_operation = Operation::BindingTop;
-            m_boundWidget = widget;
+            binding.operation = Operation::BindingTop;
+            binding.widget = widget;
         }
         else if (expression == "w" || expression == "width")
         {
-            m_operation = Operation::BindingWidth;
-            m_boundWidget = widget;
+            binding.operation = Operation::BindingWidth;
+            binding.widget = widget;
         }
         else if (expression == "h" || expression == "height")
         {
-            m_operation = Operation::BindingHeight;
-            m_boundWidget = widget;
+            binding.operation = Operation::BindingHeight;
+            binding.widget = widget;
         }
         else if (expression == "iw" || expression == "innerwidth")
         {
-            m_operation = Operation::BindingInnerWidth;
-            m_boundWidget = widget;
+            binding.operation = Operation::BindingInnerWidth;
+            binding.widget = widget;
         }
         else if (expression == "ih" || expression == "innerheight")
         {
-            m_operation = Operation::BindingInnerHeight;
-            m_boundWidget = widget;
+            binding.operation = Operation::BindingInnerHeight;
+            binding.widget = widget;
         }
         else if (expression == "size")
         {
             if (xAxis)
-                return parseBindingString("width", widget, xAxis);
+                return parseBindingString("width", widget, xAxis, binding);
             else
-                return parseBindingString("height", widget, xAxis);
+                return parseBindingString("height", widget, xAxis, binding);
         }
         else if (expression == "innersize")
         {
             if (xAxis)
-                return parseBindingString("innerwidth", widget, xAxis);
+                return parseBindingString("innerwidth", widget, xAxis, binding);
             else
-                return parseBindingString("innerheight", widget, xAxis);
+                return parseBindingString("innerheight", widget, xAxis, binding);
         }
         else if ((expression == "pos") || (expression == "position"))
         {
             if (xAxis)
-                return parseBindingString("x", widget, xAxis);
+                return parseBindingString("x", widget, xAxis, binding);
             else
-                return parseBindingString("y", widget, xAxis);
+                return parseBindingString("y", widget, xAxis, binding);
         }
         else
         {
@@ -724,41 +940,33 @@ namespace tgui
                 if (widgetName == "parent" || widgetName == "&")
                 {
                     if (widget->getParent())
-                        return parseBindingString(expression.substr(dotPos+1), widget->getParent(), xAxis);
+                        return parseBindingString(expression.substr(dotPos+1), widget->getParent(), xAxis, binding);
                 }
                 else if (!widgetName.empty())
                 {
                     // If the widget is a container, search in its children first
-                    Container* container = dynamic_cast<Container*>(widget);
-                    if (container != nullptr)
+                    if (widget->isContainer())
                     {
-                        const auto& widgets = container->getWidgets();
-                        for (std::size_t i = 0; i < widgets.size(); ++i)
-                        {
-                            if (toLower(widgets[i]->getWidgetName()) == widgetName)
-                                return parseBindingString(expression.substr(dotPos+1), widgets[i].get(), xAxis);
-                        }
+                        Widget* child = static_cast<Container*>(widget)->getChildByLowercaseName(widgetName);
+                        if (child)
+                            return parseBindingString(expression.substr(dotPos+1), child, xAxis, binding);
                     }
 
                     // If the widget has a parent, look for a sibling
                     if (widget->getParent())
                     {
-                        const auto& widgets = widget->getParent()->getWidgets();
-                        for (std::size_t i = 0; i < widgets.size(); ++i)
-                        {
-                            if (toLower(widgets[i]->getWidgetName()) == widgetName)
-                                return parseBindingString(expression.substr(dotPos+1), widgets[i].get(), xAxis);
-                        }
+                        Widget* sibling = widget->getParent()->getChildByLowercaseName(widgetName);
+                        if (sibling)
+                            return parseBindingString(expression.substr(dotPos+1), sibling, xAxis, binding);
                     }
                 }
             }
 
             // The referred widget was not found or there was something wrong with the string
-            return;
+            return false;
         }
 
-        resetPointers();
-        recalculateValue();
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -766,35 +974,35 @@ namespace tgui
 
     Layout operator-(Layout right)
     {
-        return Layout{Layout::Operation::Minus, std::make_unique<Layout>(), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Minus, Layout{}, right};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator+(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Plus, std::make_unique<Layout>(std::move(left)), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Plus, left, right};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator-(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Minus, std::make_unique<Layout>(std::move(left)), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Minus, left, right};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator*(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Multiplies, std::make_unique<Layout>(std::move(left)), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Multiplies, left, right};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator/(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Divides, std::make_unique<Layout>(std::move(left)), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Divides, left, right};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -877,8 +1085,8 @@ namespace tgui
         Layout bindRight(Widget::Ptr widget)
         {
             return Layout{Layout::Operation::Plus,
-                          std::make_unique<Layout>(Layout::Operation::BindingLeft, widget.get()),
-                          std::make_unique<Layout>(Layout::Operation::BindingWidth, widget.get())};
+                          Layout{Layout::Operation::BindingLeft, widget.get()},
+                          Layout{Layout::Operation::BindingWidth, widget.get()}};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -886,8 +1094,8 @@ namespace tgui
         Layout bindBottom(Widget::Ptr widget)
         {
             return Layout{Layout::Operation::Plus,
-                          std::make_unique<Layout>(Layout::Operation::BindingTop, widget.get()),
-                          std::make_unique<Layout>(Layout::Operation::BindingHeight, widget.get())};
+                          Layout{Layout::Operation::BindingTop, widget.get()},
+                          Layout{Layout::Operation::BindingHeight, widget.get()}};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -929,14 +1137,14 @@ namespace tgui
 
         Layout bindMin(const Layout& value1, const Layout& value2)
         {
-            return Layout{Layout::Operation::Minimum, std::make_unique<Layout>(value1), std::make_unique<Layout>(value2)};
+            return Layout{Layout::Operation::Minimum, value1, value2};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         Layout bindMax(const Layout& value1, const Layout& value2)
         {
-            return Layout{Layout::Operation::Maximum, std::make_unique<Layout>(value1), std::make_unique<Layout>(value2)};
+            return Layout{Layout::Operation::Maximum, value1, value2};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,850 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/Loading/BinaryThemeLoader.hpp>
+#include <TGUI/Loading/Deserializer.hpp>
+#include <TGUI/Loading/Serializer.hpp>
+#include <TGUI/Renderers/WidgetRenderer.hpp>
+#include <TGUI/Global.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#if defined(SFML_SYSTEM_WINDOWS)
+    #ifndef NOMINMAX // MinGW already defines this which causes a warning without this check
+        #define NOMINMAX
+    #endif
+    #define NOMB
+    #define VC_EXTRALEAN
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#elif !defined(SFML_SYSTEM_ANDROID)
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::map<std::string, std::shared_ptr<BinaryThemeLoader::MappedTheme>> BinaryThemeLoader::m_cache;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace
+    {
+        // The file consists of a header, followed by the section table, the property table, the data words and the string
+        // table. All integers are 32-bit and are stored in the byte order of the machine that compiled the theme.
+        const char fileMagic[8] = {'T', 'G', 'U', 'I', 'T', 'H', 'M', 'B'};
+        const std::uint32_t fileByteOrderMark = 0x01020304;
+        const std::uint32_t fileVersion = 2;
+
+        const std::uint32_t noPathInsertion = 0xFFFFFFFF;
+
+        struct FileHeader
+        {
+            char magic[8];
+            std::uint32_t byteOrderMark;
+            std::uint32_t version;
+            std::uint32_t sectionCount;
+            std::uint32_t propertyCount;
+            std::uint32_t dataWordCount;
+            std::uint32_t stringTableSize;
+        };
+
+        // Nested sections have an empty name, they can only be reached through a property of another section
+        struct SectionEntry
+        {
+            std::uint32_t nameOffset;
+            std::uint32_t nameLength;
+            std::uint32_t firstProperty;
+            std::uint32_t propertyCount;
+        };
+
+        struct PropertyEntry
+        {
+            std::uint32_t nameOffset;
+            std::uint32_t nameLength;
+            std::uint32_t type;
+            std::uint32_t dataOffset;
+        };
+
+        // Amount of data words used by each value type:
+        //   String:  offset and length of the text, position where the theme path has to be inserted (or noPathInsertion)
+        //   Color:   red | green << 8 | blue << 16 | alpha << 24, whether the color is set
+        //   Outline: left, top, right and bottom as floats
+        //   Texture: offset and length of the filename, whether the filename is relative to the theme,
+        //            part rect (left, top, width, height), middle rect (left, top, width, height), smooth
+        //   Section: index of the nested section
+        enum class ValueType : std::uint32_t
+        {
+            String,
+            Color,
+            Outline,
+            Texture,
+            Section
+        };
+
+        std::uint32_t getDataWordCount(ValueType type)
+        {
+            switch (type)
+            {
+                case ValueType::String:
+                    return 3;
+                case ValueType::Color:
+                    return 2;
+                case ValueType::Outline:
+                    return 4;
+                case ValueType::Texture:
+                    return 12;
+                case ValueType::Section:
+                    return 1;
+                default:
+                    return 0;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::uint32_t floatToWord(float value)
+        {
+            std::uint32_t word;
+            std::memcpy(&word, &value, sizeof(word));
+            return word;
+        }
+
+        float wordToFloat(std::uint32_t word)
+        {
+            float value;
+            std::memcpy(&value, &word, sizeof(value));
+            return value;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::string getDirectory(const std::string& filename)
+        {
+            const auto slashPos = filename.find_last_of("/\\");
+            if (slashPos != std::string::npos)
+                return filename.substr(0, slashPos+1);
+            else
+                return "";
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool isFilenameProperty(const std::string& property)
+        {
+            return ((property.size() >= 7) && (property.compare(0, 7, "texture") == 0)) || (property == "font");
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Read-only view on the contents of a file, which is memory-mapped when the platform supports it
+        class MappedFile
+        {
+        public:
+
+            MappedFile(const std::string& filename)
+            {
+            #if defined(SFML_SYSTEM_WINDOWS)
+                // The destructor isn't called when the constructor throws, so the handles are closed before throwing
+                m_file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+                if (m_file == INVALID_HANDLE_VALUE)
+                    throw Exception{"Failed to open '" + filename + "'."};
+
+                LARGE_INTEGER fileSize;
+                if (!GetFileSizeEx(m_file, &fileSize) || (fileSize.QuadPart == 0))
+                {
+                    release();
+                    throw Exception{"Failed to map '" + filename + "' in memory, file is empty."};
+                }
+
+                m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                if (!m_mapping)
+                {
+                    release();
+                    throw Exception{"Failed to map '" + filename + "' in memory."};
+                }
+
+                m_data = static_cast<const char*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+                if (!m_data)
+                {
+                    release();
+                    throw Exception{"Failed to map '" + filename + "' in memory."};
+                }
+
+                m_size = static_cast<std::size_t>(fileSize.QuadPart);
+            #elif !defined(SFML_SYSTEM_ANDROID)
+                const int fd = open(filename.c_str(), O_RDONLY);
+                if (fd < 0)
+                    throw Exception{"Failed to open '" + filename + "'."};
+
+                struct stat fileInfo;
+                if ((fstat(fd, &fileInfo) != 0) || (fileInfo.st_size == 0))
+                {
+                    close(fd);
+                    throw Exception{"Failed to map '" + filename + "' in memory, file is empty."};
+                }
+
+                void* data = mmap(nullptr, static_cast<std::size_t>(fileInfo.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+                close(fd);
+                if (data == MAP_FAILED)
+                    throw Exception{"Failed to map '" + filename + "' in memory."};
+
+                m_data = static_cast<const char*>(data);
+                m_size = static_cast<std::size_t>(fileInfo.st_size);
+            #else
+                // Memory mapping isn't available on this platform, so the file is read in memory instead
+                std::ifstream file{filename, std::ios::binary};
+                if (!file.is_open())
+                    throw Exception{"Failed to open '" + filename + "'."};
+
+                m_buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+                m_data = m_buffer.data();
+                m_size = m_buffer.size();
+            #endif
+            }
+
+            ~MappedFile()
+            {
+                release();
+            }
+
+            MappedFile(const MappedFile&) = delete;
+            MappedFile& operator=(const MappedFile&) = delete;
+
+            const char* getData() const
+            {
+                return m_data;
+            }
+
+            std::size_t getSize() const
+            {
+                return m_size;
+            }
+
+        private:
+
+            void release()
+            {
+            #if defined(SFML_SYSTEM_WINDOWS)
+                if (m_data)
+                    UnmapViewOfFile(m_data);
+                if (m_mapping)
+                    CloseHandle(m_mapping);
+                if (m_file != INVALID_HANDLE_VALUE)
+                    CloseHandle(m_file);
+            #elif !defined(SFML_SYSTEM_ANDROID)
+                if (m_data)
+                    munmap(const_cast<char*>(m_data), m_size);
+            #endif
+            }
+
+        private:
+            const char* m_data = nullptr;
+            std::size_t m_size = 0;
+
+        #if defined(SFML_SYSTEM_WINDOWS)
+            HANDLE m_file = INVALID_HANDLE_VALUE;
+            HANDLE m_mapping = nullptr;
+        #elif defined(SFML_SYSTEM_ANDROID)
+            std::vector<char> m_buffer;
+        #endif
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Builds the contents of a binary theme while compiling a text theme
+        class ThemeWriter
+        {
+        public:
+
+            ThemeWriter(const std::string& resourcePath) :
+                m_resourcePath{resourcePath}
+            {
+            }
+
+            // Adds the section and returns its index. Nested sections are added before the section that contains them.
+            std::uint32_t addSection(const std::string& name, const std::map<sf::String, sf::String>& properties)
+            {
+                std::vector<PropertyEntry> entries;
+                for (const auto& property : properties)
+                {
+                    PropertyEntry entry;
+                    entry.nameOffset = addString(property.first);
+                    entry.nameLength = static_cast<std::uint32_t>(property.first.toAnsiString().length());
+                    addValue(property.first, property.second, entry);
+                    entries.push_back(entry);
+                }
+
+                SectionEntry section;
+                section.nameOffset = addString(name);
+                section.nameLength = static_cast<std::uint32_t>(name.length());
+                section.firstProperty = static_cast<std::uint32_t>(m_properties.size());
+                section.propertyCount = static_cast<std::uint32_t>(entries.size());
+
+                m_properties.insert(m_properties.end(), entries.begin(), entries.end());
+                m_sections.push_back(section);
+                return static_cast<std::uint32_t>(m_sections.size() - 1);
+            }
+
+            void save(const std::string& filename) const
+            {
+                std::ofstream file{filename, std::ios::binary};
+                if (!file.is_open())
+                    throw Exception{"Failed to open '" + filename + "' for writing the binary theme."};
+
+                FileHeader header;
+                std::memcpy(header.magic, fileMagic, sizeof(fileMagic));
+                header.byteOrderMark = fileByteOrderMark;
+                header.version = fileVersion;
+                header.sectionCount = static_cast<std::uint32_t>(m_sections.size());
+                header.propertyCount = static_cast<std::uint32_t>(m_properties.size());
+                header.dataWordCount = static_cast<std::uint32_t>(m_data.size());
+                header.stringTableSize = static_cast<std::uint32_t>(m_strings.size());
+
+                file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+                file.write(reinterpret_cast<const char*>(m_sections.data()), static_cast<std::streamsize>(m_sections.size() * sizeof(SectionEntry)));
+                file.write(reinterpret_cast<const char*>(m_properties.data()), static_cast<std::streamsize>(m_properties.size() * sizeof(PropertyEntry)));
+                file.write(reinterpret_cast<const char*>(m_data.data()), static_cast<std::streamsize>(m_data.size() * sizeof(std::uint32_t)));
+                file.write(m_strings.data(), static_cast<std::streamsize>(m_strings.size()));
+
+                if (!file)
+                    throw Exception{"Failed to write the binary theme to '" + filename + "'."};
+            }
+
+        private:
+
+            std::uint32_t addString(const std::string& str)
+            {
+                const auto offset = static_cast<std::uint32_t>(m_strings.size());
+                m_strings += str;
+                return offset;
+            }
+
+            // Removes the path of the text theme from a filename, so that the binary theme can be placed in another folder
+            bool makeRelative(std::string& filename) const
+            {
+                if (m_resourcePath.empty() || (filename.compare(0, m_resourcePath.length(), m_resourcePath) != 0))
+                    return false;
+
+                filename.erase(0, m_resourcePath.length());
+                return true;
+            }
+
+            void addValue(const std::string& property, const sf::String& value, PropertyEntry& entry)
+            {
+                const std::string str = trim(value);
+                ObjectConverter decoded;
+                try
+                {
+                    if (!str.empty() && (str[0] == '{'))
+                    {
+                        // Nested sections are stored as separate sections without a name
+                        std::map<sf::String, sf::String> nestedProperties;
+                        for (const auto& pair : Deserializer::deserialize(ObjectConverter::Type::RendererData, str).getRenderer()->propertyValuePairs)
+                            nestedProperties[pair.first] = ObjectConverter{pair.second}.getString();
+
+                        const std::uint32_t nestedSection = addSection("", nestedProperties);
+                        entry.type = static_cast<std::uint32_t>(ValueType::Section);
+                        entry.dataOffset = static_cast<std::uint32_t>(m_data.size());
+                        m_data.push_back(nestedSection);
+                        return;
+                    }
+
+                    // The property name tells us that the value is a texture, even when decodeValue can't recognize it
+                    if ((property.size() >= 7) && (property.compare(0, 7, "texture") == 0) && !str.empty() && (str[0] == '"'))
+                        decoded = Deserializer::deserialize(ObjectConverter::Type::Texture, str);
+                    else
+                        decoded = BaseThemeLoader::decodeValue(value);
+                }
+                catch (const Exception&)
+                {
+                    decoded = ObjectConverter{value};
+                }
+
+                entry.dataOffset = static_cast<std::uint32_t>(m_data.size());
+                switch (decoded.getType())
+                {
+                    case ObjectConverter::Type::Color:
+                    {
+                        const Color& color = decoded.getColor();
+                        entry.type = static_cast<std::uint32_t>(ValueType::Color);
+                        m_data.push_back(static_cast<std::uint32_t>(color.getRed())
+                                         | (static_cast<std::uint32_t>(color.getGreen()) << 8)
+                                         | (static_cast<std::uint32_t>(color.getBlue()) << 16)
+                                         | (static_cast<std::uint32_t>(color.getAlpha()) << 24));
+                        m_data.push_back(color.isSet() ? 1 : 0);
+                        return;
+                    }
+
+                    case ObjectConverter::Type::Outline:
+                    {
+                        // Outlines with relative values can't be stored as numbers
+                        if (str.find('%') != std::string::npos)
+                            break;
+
+                        const Outline& outline = decoded.getOutline();
+                        entry.type = static_cast<std::uint32_t>(ValueType::Outline);
+                        m_data.push_back(floatToWord(outline.getLeft()));
+                        m_data.push_back(floatToWord(outline.getTop()));
+                        m_data.push_back(floatToWord(outline.getRight()));
+                        m_data.push_back(floatToWord(outline.getBottom()));
+                        return;
+                    }
+
+                    case ObjectConverter::Type::Texture:
+                    {
+                        const Texture& texture = decoded.getTexture();
+                        if (!texture.getData())
+                            break;
+
+                        std::string filename = texture.getId();
+                        const bool relative = makeRelative(filename);
+                        const sf::IntRect& partRect = texture.getData()->rect;
+                        const sf::IntRect middleRect = texture.getMiddleRect();
+
+                        entry.type = static_cast<std::uint32_t>(ValueType::Texture);
+                        m_data.push_back(addString(filename));
+                        m_data.push_back(static_cast<std::uint32_t>(filename.length()));
+                        m_data.push_back(relative ? 1 : 0);
+                        m_data.push_back(static_cast<std::uint32_t>(partRect.left));
+                        m_data.push_back(static_cast<std::uint32_t>(partRect.top));
+                        m_data.push_back(static_cast<std::uint32_t>(partRect.width));
+                        m_data.push_back(static_cast<std::uint32_t>(partRect.height));
+                        m_data.push_back(static_cast<std::uint32_t>(middleRect.left));
+                        m_data.push_back(static_cast<std::uint32_t>(middleRect.top));
+                        m_data.push_back(static_cast<std::uint32_t>(middleRect.width));
+                        m_data.push_back(static_cast<std::uint32_t>(middleRect.height));
+                        m_data.push_back(texture.isSmooth() ? 1 : 0);
+                        return;
+                    }
+
+                    default:
+                        break;
+                }
+
+                // Store the value as text. Filenames are made relative to the theme again, they are stored behind the quote.
+                std::string text = value;
+                std::uint32_t pathInsertPosition = noPathInsertion;
+                if (isFilenameProperty(property) && !text.empty())
+                {
+                    const std::size_t quoteLength = (text[0] == '"') ? 1 : 0;
+                    std::string filename = text.substr(quoteLength);
+                    if (makeRelative(filename))
+                    {
+                        text = text.substr(0, quoteLength) + filename;
+                        pathInsertPosition = static_cast<std::uint32_t>(quoteLength);
+                    }
+                }
+
+                entry.type = static_cast<std::uint32_t>(ValueType::String);
+                m_data.push_back(addString(text));
+                m_data.push_back(static_cast<std::uint32_t>(text.length()));
+                m_data.push_back(pathInsertPosition);
+            }
+
+        private:
+            std::string m_resourcePath;
+            std::vector<SectionEntry> m_sections;
+            std::vector<PropertyEntry> m_properties;
+            std::vector<std::uint32_t> m_data;
+            std::string m_strings;
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct BinaryThemeLoader::MappedTheme
+    {
+        MappedTheme(const std::string& filename, const std::string& fullFilename) :
+            file        {fullFilename},
+            resourcePath{getDirectory(filename)}
+        {
+            const char* data = file.getData();
+            if ((file.getSize() < sizeof(FileHeader)) || (std::memcmp(data, fileMagic, sizeof(fileMagic)) != 0))
+                throw Exception{"Failed to load '" + filename + "', file is not a binary theme."};
+
+            std::memcpy(&header, data, sizeof(header));
+            if (header.byteOrderMark != fileByteOrderMark)
+                throw Exception{"Failed to load '" + filename + "', binary theme was compiled on a machine with a different byte order."};
+            if (header.version != fileVersion)
+                throw Exception{"Failed to load '" + filename + "', unsupported binary theme version " + to_string(header.version) + "."};
+
+            // The sizes are checked with 64-bit integers to prevent overflows from corrupt headers
+            const std::uint64_t propertiesOffset = sizeof(FileHeader) + std::uint64_t{header.sectionCount} * sizeof(SectionEntry);
+            const std::uint64_t dataOffset = propertiesOffset + std::uint64_t{header.propertyCount} * sizeof(PropertyEntry);
+            const std::uint64_t stringsOffset = dataOffset + std::uint64_t{header.dataWordCount} * sizeof(std::uint32_t);
+            if (stringsOffset + header.stringTableSize > file.getSize())
+                throw Exception{"Failed to load '" + filename + "', binary theme is truncated."};
+
+            sectionsStart = sizeof(FileHeader);
+            propertiesStart = static_cast<std::size_t>(propertiesOffset);
+            dataStart = static_cast<std::size_t>(dataOffset);
+            stringsStart = static_cast<std::size_t>(stringsOffset);
+
+            // Validate all offsets once, so that they can be trusted while loading the renderers
+            for (std::uint32_t i = 0; i < header.sectionCount; ++i)
+            {
+                const SectionEntry section = getSection(i);
+                if (!isValidString(section.nameOffset, section.nameLength)
+                 || (section.firstProperty > header.propertyCount) || (section.propertyCount > header.propertyCount - section.firstProperty))
+                    throw Exception{"Failed to load '" + filename + "', binary theme contains an invalid section."};
+
+                for (std::uint32_t j = section.firstProperty; j < section.firstProperty + section.propertyCount; ++j)
+                {
+                    if (!isValidProperty(getProperty(j), i))
+                        throw Exception{"Failed to load '" + filename + "', binary theme contains an invalid property."};
+                }
+
+                if (section.nameLength > 0)
+                    sectionIndices[getString(section.nameOffset, section.nameLength)] = i;
+            }
+        }
+
+        SectionEntry getSection(std::uint32_t index) const
+        {
+            SectionEntry section;
+            std::memcpy(&section, file.getData() + sectionsStart + index * sizeof(SectionEntry), sizeof(section));
+            return section;
+        }
+
+        PropertyEntry getProperty(std::uint32_t index) const
+        {
+            PropertyEntry property;
+            std::memcpy(&property, file.getData() + propertiesStart + index * sizeof(PropertyEntry), sizeof(property));
+            return property;
+        }
+
+        std::uint32_t getWord(std::uint32_t index) const
+        {
+            std::uint32_t word;
+            std::memcpy(&word, file.getData() + dataStart + index * sizeof(std::uint32_t), sizeof(word));
+            return word;
+        }
+
+        std::string getString(std::uint32_t offset, std::uint32_t length) const
+        {
+            return {file.getData() + stringsStart + offset, length};
+        }
+
+        bool isValidString(std::uint32_t offset, std::uint32_t length) const
+        {
+            return (offset <= header.stringTableSize) && (length <= header.stringTableSize - offset);
+        }
+
+        bool isValidProperty(const PropertyEntry& property, std::uint32_t sectionIndex) const
+        {
+            const std::uint32_t wordCount = getDataWordCount(static_cast<ValueType>(property.type));
+            if ((wordCount == 0) || !isValidString(property.nameOffset, property.nameLength)
+             || (property.dataOffset > header.dataWordCount) || (wordCount > header.dataWordCount - property.dataOffset))
+                return false;
+
+            switch (static_cast<ValueType>(property.type))
+            {
+                case ValueType::String:
+                {
+                    const std::uint32_t length = getWord(property.dataOffset + 1);
+                    const std::uint32_t pathInsertPosition = getWord(property.dataOffset + 2);
+                    return isValidString(getWord(property.dataOffset), length)
+                        && ((pathInsertPosition == noPathInsertion) || (pathInsertPosition <= length));
+                }
+
+                case ValueType::Texture:
+                    return isValidString(getWord(property.dataOffset), getWord(property.dataOffset + 1));
+
+                case ValueType::Section: // Nested sections are always written before the section containing them
+                    return getWord(property.dataOffset) < sectionIndex;
+
+                default:
+                    return true;
+            }
+        }
+
+        PropertyValueMap getProperties(std::uint32_t sectionIndex) const
+        {
+            PropertyValueMap properties;
+
+            const SectionEntry section = getSection(sectionIndex);
+            for (std::uint32_t i = section.firstProperty; i < section.firstProperty + section.propertyCount; ++i)
+            {
+                const PropertyEntry property = getProperty(i);
+                properties[getString(property.nameOffset, property.nameLength)] = getValue(property);
+            }
+
+            return properties;
+        }
+
+        ObjectConverter getValue(const PropertyEntry& property) const
+        {
+            const std::uint32_t offset = property.dataOffset;
+            switch (static_cast<ValueType>(property.type))
+            {
+                case ValueType::Color:
+                {
+                    if (!getWord(offset + 1))
+                        return Color{};
+
+                    const std::uint32_t rgba = getWord(offset);
+                    return Color{static_cast<std::uint8_t>(rgba & 0xFF), static_cast<std::uint8_t>((rgba >> 8) & 0xFF),
+                                 static_cast<std::uint8_t>((rgba >> 16) & 0xFF), static_cast<std::uint8_t>((rgba >> 24) & 0xFF)};
+                }
+
+                case ValueType::Outline:
+                    return Outline{wordToFloat(getWord(offset)), wordToFloat(getWord(offset + 1)),
+                                   wordToFloat(getWord(offset + 2)), wordToFloat(getWord(offset + 3))};
+
+                case ValueType::Texture:
+                {
+                    std::string filename = getString(getWord(offset), getWord(offset + 1));
+                    if (getWord(offset + 2))
+                        filename = resourcePath + filename;
+
+                    const sf::IntRect partRect{static_cast<int>(getWord(offset + 3)), static_cast<int>(getWord(offset + 4)),
+                                               static_cast<int>(getWord(offset + 5)), static_cast<int>(getWord(offset + 6))};
+                    const sf::IntRect middleRect{static_cast<int>(getWord(offset + 7)), static_cast<int>(getWord(offset + 8)),
+                                                 static_cast<int>(getWord(offset + 9)), static_cast<int>(getWord(offset + 10))};
+                    try
+                    {
+                        return Texture{filename, partRect, middleRect, getWord(offset + 11) != 0};
+                    }
+                    catch (const Exception&)
+                    {
+                        // Keep the value as text, the exception will be thrown again when a widget tries to use the texture
+                        return sf::String{getString(property)};
+                    }
+                }
+
+                case ValueType::Section:
+                    return RendererData::create(getProperties(getWord(offset)));
+
+                case ValueType::String:
+                default:
+                    return sf::String{getString(property)};
+            }
+        }
+
+        // Returns the value in the same form as it would have had in the text theme
+        std::string getString(const PropertyEntry& property) const
+        {
+            const std::uint32_t offset = property.dataOffset;
+            switch (static_cast<ValueType>(property.type))
+            {
+                case ValueType::String:
+                {
+                    std::string text = getString(getWord(offset), getWord(offset + 1));
+                    if (getWord(offset + 2) != noPathInsertion)
+                        text.insert(getWord(offset + 2), resourcePath);
+
+                    return text;
+                }
+
+                case ValueType::Texture:
+                {
+                    std::string filename = getString(getWord(offset), getWord(offset + 1));
+                    if (getWord(offset + 2))
+                        filename = resourcePath + filename;
+
+                    std::string text = Serializer::serialize(sf::String{filename});
+                    if (getWord(offset + 5) && getWord(offset + 6))
+                    {
+                        text += " Part(" + to_string(getWord(offset + 3)) + ", " + to_string(getWord(offset + 4))
+                                + ", " + to_string(getWord(offset + 5)) + ", " + to_string(getWord(offset + 6)) + ")";
+                    }
+                    if (getWord(offset + 9) && getWord(offset + 10))
+                    {
+                        text += " Middle(" + to_string(getWord(offset + 7)) + ", " + to_string(getWord(offset + 8))
+                                  + ", " + to_string(getWord(offset + 9)) + ", " + to_string(getWord(offset + 10)) + ")";
+                    }
+                    if (getWord(offset + 11))
+                        text += " Smooth";
+
+                    return text;
+                }
+
+                case ValueType::Section:
+                    return "{\n" + getSectionBody(getWord(offset)) + "}";
+
+                default:
+                    return Serializer::serialize(getValue(property));
+            }
+        }
+
+        std::string getSectionBody(std::uint32_t sectionIndex) const
+        {
+            std::string body;
+            const SectionEntry section = getSection(sectionIndex);
+            for (std::uint32_t i = section.firstProperty; i < section.firstProperty + section.propertyCount; ++i)
+            {
+                const PropertyEntry property = getProperty(i);
+                const std::string name = getString(property.nameOffset, property.nameLength);
+                if (static_cast<ValueType>(property.type) == ValueType::Section)
+                    body += name + " {\n" + getSectionBody(getWord(property.dataOffset)) + "}\n";
+                else
+                    body += name + " = " + getString(property) + ";\n";
+            }
+
+            return body;
+        }
+
+        MappedFile file;
+        std::string resourcePath;
+        FileHeader header;
+        std::size_t sectionsStart;
+        std::size_t propertiesStart;
+        std::size_t dataStart;
+        std::size_t stringsStart;
+        std::map<std::string, std::uint32_t> sectionIndices;
+        std::map<std::string, std::map<sf::String, sf::String>> stringProperties;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BinaryThemeLoader::compile(const std::string& themeFilename, const std::string& binaryFilename)
+    {
+        // Take the sections out of the cache of the text loader again, unless the theme was already loaded before
+        std::map<std::string, std::map<sf::String, sf::String>> sections;
+        auto cacheIt = DefaultThemeLoader::m_propertiesCache.find(themeFilename);
+        if (cacheIt != DefaultThemeLoader::m_propertiesCache.end())
+            sections = cacheIt->second;
+        else
+        {
+            DefaultThemeLoader textLoader;
+            textLoader.preload(themeFilename);
+
+            cacheIt = DefaultThemeLoader::m_propertiesCache.find(themeFilename);
+            sections = std::move(cacheIt->second);
+            DefaultThemeLoader::m_propertiesCache.erase(cacheIt);
+        }
+
+        // The text loader inserted the folder of the theme file in front of the filenames, which is removed again
+        ThemeWriter writer{getDirectory(themeFilename)};
+        for (const auto& section : sections)
+            writer.addSection(section.first, section.second);
+
+        writer.save(binaryFilename);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BinaryThemeLoader::preload(const std::string& filename)
+    {
+        if (filename.empty() || (m_cache.find(filename) != m_cache.end()))
+            return;
+
+        std::string fullFilename = filename;
+    #ifdef SFML_SYSTEM_WINDOWS
+        if ((filename[0] != '/') && (filename[0] != '\\') && ((filename.size() <= 1) || (filename[1] != ':')))
+    #else
+        if (filename[0] != '/')
+    #endif
+            fullFilename = getResourcePath() + filename;
+
+        m_cache[filename] = std::make_shared<MappedTheme>(filename, fullFilename);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::map<sf::String, sf::String>& BinaryThemeLoader::load(const std::string& filename, const std::string& section)
+    {
+        preload(filename);
+
+        const std::string lowercaseSection = toLower(section);
+
+        // An empty filename is not considered an error and will result in an empty property list
+        static std::map<sf::String, sf::String> emptyProperties;
+        if (filename.empty())
+            return emptyProperties;
+
+        auto& theme = *m_cache[filename];
+        const auto sectionIt = theme.sectionIndices.find(lowercaseSection);
+        if (sectionIt == theme.sectionIndices.end())
+            throw Exception{"No section '" + section + "' was found in file '" + filename + "'."};
+
+        auto& properties = theme.stringProperties[lowercaseSection];
+        if (properties.empty())
+        {
+            const SectionEntry sectionEntry = theme.getSection(sectionIt->second);
+            for (std::uint32_t i = sectionEntry.firstProperty; i < sectionEntry.firstProperty + sectionEntry.propertyCount; ++i)
+            {
+                const PropertyEntry property = theme.getProperty(i);
+                properties[theme.getString(property.nameOffset, property.nameLength)] = theme.getString(property);
+            }
+        }
+
+        return properties;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BinaryThemeLoader::canLoad(const std::string& filename, const std::string& section)
+    {
+        if (filename.empty())
+            return true;
+
+        const auto it = m_cache.find(filename);
+        if (it == m_cache.end())
+            return false;
+
+        return it->second->sectionIndices.find(toLower(section)) != it->second->sectionIndices.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyValueMap BinaryThemeLoader::loadProperties(const std::string& filename, const std::string& section)
+    {
+        preload(filename);
+
+        if (filename.empty())
+            return {};
+
+        const auto& theme = *m_cache[filename];
+        const auto sectionIt = theme.sectionIndices.find(toLower(section));
+        if (sectionIt == theme.sectionIndices.end())
+            throw Exception{"No section '" + section + "' was found in file '" + filename + "'."};
+
+        return theme.getProperties(sectionIt->second);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BinaryThemeLoader::flushCache(const std::string& filename)
+    {
+        if (filename != "")
+            m_cache.erase(filename);
+        else
+            m_cache.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
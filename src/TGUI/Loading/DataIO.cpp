@@ -24,46 +24,51 @@
 
 
 #include <TGUI/Loading/DataIO.hpp>
+#include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Global.hpp>
 #include <TGUI/String.hpp>
 #include <TGUI/to_string.hpp>
 
+#include <algorithm>
 #include <cctype>
 #include <cassert>
+#include <cstring>
+#include <cstdint>
+#include <map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #define REMOVE_WHITESPACE_AND_COMMENTS(ReturnErrorOnEOF) \
     for (;;) \
     { \
-        stream >> std::ws; \
-        if (stream.peek() == EOF) \
+        input.skipWhitespace(); \
+        if (input.peek() == EOF) \
             break; \
         \
-        if (stream.peek() == '/') \
+        if (input.peek() == '/') \
         { \
             char c; \
-            stream.read(&c, 1); \
-            if (stream.peek() == '/') \
+            input.read(c); \
+            if (input.peek() == '/') \
             { \
-                while (stream.peek() != EOF) \
+                while (input.peek() != EOF) \
                 { \
-                    stream.read(&c, 1); \
+                    input.read(c); \
                     if (c == '\n') \
                         break; \
                 } \
             } \
-            else if (stream.peek() == '*') \
+            else if (input.peek() == '*') \
             { \
-                while (stream.peek() != EOF) \
+                while (input.peek() != EOF) \
                 { \
-                    stream.read(&c, 1); \
-                    if (stream.peek() == '*') \
+                    input.read(c); \
+                    if (input.peek() == '*') \
                     { \
-                        stream.read(&c, 1); \
-                        if (stream.peek() == '/') \
+                        input.read(c); \
+                        if (input.peek() == '/') \
                         { \
-                            stream.read(&c, 1); \
+                            input.read(c); \
                             break; \
                         } \
                     } \
@@ -78,7 +83,7 @@
         break; \
     } \
     \
-    if (stream.peek() == EOF) \
+    if (input.peek() == EOF) \
     { \
         if (ReturnErrorOnEOF) \
             return "Unexpected EOF while parsing."; \
@@ -92,31 +97,76 @@ namespace tgui
 {
     namespace
     {
+        // Contiguous input that is parsed without copying it. All characters are accessed directly instead of going
+        // through the virtual functions of a stream for every single character.
+        struct InputBuffer
+        {
+            InputBuffer(const char* data, std::size_t size, std::size_t startPos = 0) :
+                begin  {data},
+                current{data + startPos},
+                end    {data + size}
+            {
+            }
+
+            int peek() const
+            {
+                return (current < end) ? static_cast<unsigned char>(*current) : EOF;
+            }
+
+            void read(char& c)
+            {
+                if (current < end)
+                    c = *current++;
+            }
+
+            void skipWhitespace()
+            {
+                while ((current < end) && ::isspace(static_cast<unsigned char>(*current)))
+                    ++current;
+            }
+
+            // Returns the length of the sequence of characters at the current position that have no special meaning
+            std::size_t getPlainCharacterCount(const char* specialCharacters) const
+            {
+                const char* it = current;
+                while ((it < end) && !::isspace(static_cast<unsigned char>(*it)) && !std::strchr(specialCharacters, *it))
+                    ++it;
+
+                return static_cast<std::size_t>(it - current);
+            }
+
+            const char* begin;
+            const char* current;
+            const char* end;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         // Forward declare one of the functions to solve circular dependency
-        std::string parseSection(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const std::string& sectionName);
+        std::string parseSection(InputBuffer& input, const std::unique_ptr<DataIO::Node>& node, const std::string& sectionName);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string readWord(std::stringstream& stream)
+        std::string readWord(InputBuffer& input)
         {
             std::string word = "";
-            while (stream.peek() != EOF)
+            while (input.peek() != EOF)
             {
-                char c = static_cast<char>(stream.peek());
+                char c = static_cast<char>(input.peek());
                 if (c == '\r')
                 {
-                    stream.read(&c, 1);
+                    input.read(c);
                     return word;
                 }
                 else if (!::isspace(c) && (c != '=') && (c != ';') && (c != '{') && (c != '}'))
                 {
-                    stream.read(&c, 1);
+                    input.read(c);
 
-                    if ((c == '/') && (stream.peek() == '/'))
+                    if ((c == '/') && (input.peek() == '/'))
                     {
-                        while (stream.peek() != EOF)
+                        while (input.peek() != EOF)
                         {
-                            stream.read(&c, 1);
+                            input.read(c);
                             if (c == '\n')
                             {
                                 assert(!word.empty()); // No known case in which you can pass here with an empty word
@@ -124,16 +174,16 @@ namespace tgui
                             }
                         }
                     }
-                    else if ((c == '/') && (stream.peek() == '*'))
+                    else if ((c == '/') && (input.peek() == '*'))
                     {
-                        while (stream.peek() != EOF)
+                        while (input.peek() != EOF)
                         {
-                            stream.read(&c, 1);
+                            input.read(c);
                             if (c == '*')
                             {
-                                if (stream.peek() == '/')
+                                if (input.peek() == '/')
                                 {
-                                    stream.read(&c, 1);
+                                    input.read(c);
                                     break;
                                 }
                             }
@@ -143,9 +193,9 @@ namespace tgui
                     {
                         word.push_back(c);
                         bool backslash = false;
-                        while (stream.peek() != EOF)
+                        while (input.peek() != EOF)
                         {
-                            stream.read(&c, 1);
+                            input.read(c);
                             word.push_back(c);
 
                             if (c == '"' && !backslash)
@@ -158,7 +208,14 @@ namespace tgui
                         }
                     }
                     else
+                    {
                         word.push_back(c);
+
+                        // Copy the rest of the word at once as long as it doesn't contain characters with a special meaning
+                        const std::size_t count = input.getPlainCharacterCount("=;{}/\"");
+                        word.append(input.current, count);
+                        input.current += count;
+                    }
                 }
                 else
                     return word;
@@ -169,37 +226,37 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string readLine(std::stringstream& stream)
+        std::string readLine(InputBuffer& input)
         {
             std::string line;
             bool whitespaceFound = false;
-            while (stream.peek() != EOF)
+            while (input.peek() != EOF)
             {
-                char c = static_cast<char>(stream.peek());
+                char c = static_cast<char>(input.peek());
 
                 if (c == '/')
                 {
-                    stream.read(&c, 1);
-                    if (stream.peek() == '/')
+                    input.read(c);
+                    if (input.peek() == '/')
                     {
-                        while (stream.peek() != EOF)
+                        while (input.peek() != EOF)
                         {
-                            stream.read(&c, 1);
+                            input.read(c);
                             if (c == '\n')
                                 break;
                         }
                     }
-                    else if (stream.peek() == '*')
+                    else if (input.peek() == '*')
                     {
-                        while (stream.peek() != EOF)
+                        while (input.peek() != EOF)
                         {
-                            stream.read(&c, 1);
-                            if (stream.peek() == '*')
+                            input.read(c);
+                            if (input.peek() == '*')
                             {
-                                stream.read(&c, 1);
-                                if (stream.peek() == '/')
+                                input.read(c);
+                                if (input.peek() == '/')
                                 {
-                                    stream.read(&c, 1);
+                                    input.read(c);
                                     break;
                                 }
                             }
@@ -217,13 +274,13 @@ namespace tgui
 
                 if (c == '"')
                 {
-                    stream.read(&c, 1);
+                    input.read(c);
                     line.push_back(c);
 
                     bool backslash = false;
-                    while (stream.peek() != EOF)
+                    while (input.peek() != EOF)
                     {
-                        stream.read(&c, 1);
+                        input.read(c);
                         line.push_back(c);
 
                         if (c == '"' && !backslash)
@@ -235,10 +292,10 @@ namespace tgui
                             backslash = false;
                     }
 
-                    if (stream.peek() == EOF)
+                    if (input.peek() == EOF)
                         return "";
 
-                    c = static_cast<char>(stream.peek());
+                    c = static_cast<char>(input.peek());
                 }
 
                 if ((c == '=') || (c == '{'))
@@ -251,7 +308,7 @@ namespace tgui
                 }
                 else if (::isspace(c))
                 {
-                    stream.read(&c, 1);
+                    input.read(c);
                     if (!whitespaceFound)
                     {
                         whitespaceFound = true;
@@ -262,7 +319,12 @@ namespace tgui
                 {
                     whitespaceFound = false;
                     line.push_back(c);
-                    stream.read(&c, 1);
+                    input.read(c);
+
+                    // Copy the rest of the word at once as long as it doesn't contain characters with a special meaning
+                    const std::size_t count = input.getPlainCharacterCount("=;{}/\"");
+                    line.append(input.current, count);
+                    input.current += count;
                 }
             }
 
@@ -271,25 +333,25 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string parseKeyValue(std::stringstream& stream, std::unique_ptr<DataIO::Node>& node, const std::string& key)
+        std::string parseKeyValue(InputBuffer& input, std::unique_ptr<DataIO::Node>& node, const std::string& key)
         {
-            // Read the assignment symbol from the stream and remove the whitespace behind it
+            // Read the assignment symbol from the input and remove the whitespace behind it
             char chr;
-            stream.read(&chr, 1);
+            input.read(chr);
 
             REMOVE_WHITESPACE_AND_COMMENTS(true)
 
             // Check for subsection as value
-            if (stream.peek() == '{')
-                return parseSection(stream, node, key);
+            if (input.peek() == '{')
+                return parseSection(input, node, key);
 
             // Read the value
-            std::string line = trim(readLine(stream));
+            std::string line = trim(readLine(input));
             if (!line.empty())
             {
                 // Remove the ';' if it is there
-                if (stream.peek() == ';')
-                    stream.read(&chr, 1);
+                if (input.peek() == ';')
+                    input.read(chr);
 
                 // Create a value node to store the value
                 auto valueNode = std::make_unique<DataIO::ValueNode>();
@@ -352,11 +414,11 @@ namespace tgui
             }
             else
             {
-                if (stream.peek() == EOF)
+                if (input.peek() == EOF)
                     return "Found EOF while trying to read a value.";
                 else
                 {
-                    chr = static_cast<char>(stream.peek());
+                    chr = static_cast<char>(input.peek());
                     if (chr == '=')
                         return "Found '=' while trying to read a value.";
                     else if (chr == '{')
@@ -369,59 +431,59 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string parseSection(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const std::string& sectionName)
+        std::string parseSection(InputBuffer& input, const std::unique_ptr<DataIO::Node>& node, const std::string& sectionName)
         {
             // Create a new node for this section
             auto sectionNode = std::make_unique<DataIO::Node>();
             sectionNode->parent = node.get();
             sectionNode->name = sectionName;
 
-            // Read the brace from the stream
+            // Read the brace from the input
             char chr;
-            stream.read(&chr, 1);
+            input.read(chr);
 
-            while (stream.peek() != EOF)
+            while (input.peek() != EOF)
             {
                 REMOVE_WHITESPACE_AND_COMMENTS(true)
 
-                std::string word = readWord(stream);
+                std::string word = readWord(input);
                 if (word == "")
                 {
-                    if (stream.peek() == EOF)
+                    if (input.peek() == EOF)
                         return "Found EOF while trying to read property or nested section name.";
-                    else if (stream.peek() == '}')
+                    else if (input.peek() == '}')
                     {
                         node->children.push_back(std::move(sectionNode));
 
-                        stream.read(&chr, 1);
+                        input.read(chr);
 
                         // Ignore semicolon behind closing brace
                         REMOVE_WHITESPACE_AND_COMMENTS(false)
-                        if (stream.peek() == ';')
-                            stream.read(&chr, 1);
+                        if (input.peek() == ';')
+                            input.read(chr);
 
                         REMOVE_WHITESPACE_AND_COMMENTS(false)
                         return "";
                     }
-                    else if (stream.peek() != '{')
-                        return "Expected property or nested section name, found '" + std::string(1, static_cast<char>(stream.peek())) + "' instead.";
+                    else if (input.peek() != '{')
+                        return "Expected property or nested section name, found '" + std::string(1, static_cast<char>(input.peek())) + "' instead.";
                 }
 
                 REMOVE_WHITESPACE_AND_COMMENTS(true)
-                if (stream.peek() == '{')
+                if (input.peek() == '{')
                 {
-                    std::string error = parseSection(stream, sectionNode, word);
+                    std::string error = parseSection(input, sectionNode, word);
                     if (!error.empty())
                         return error;
                 }
-                else if (stream.peek() == '=')
+                else if (input.peek() == '=')
                 {
-                    std::string error = parseKeyValue(stream, sectionNode, word);
+                    std::string error = parseKeyValue(input, sectionNode, word);
                     if (!error.empty())
                         return error;
                 }
                 else
-                    return "Expected '{' or '=', found '" + std::string(1, static_cast<char>(stream.peek())) + "' instead.";
+                    return "Expected '{' or '=', found '" + std::string(1, static_cast<char>(input.peek())) + "' instead.";
             }
 
             return "Found EOF while reading section.";
@@ -429,25 +491,510 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string parseRootSection(std::stringstream& stream, std::unique_ptr<DataIO::Node>& root)
+        std::string parseRootSection(InputBuffer& input, std::unique_ptr<DataIO::Node>& root)
         {
             REMOVE_WHITESPACE_AND_COMMENTS(false)
 
-            std::string word = readWord(stream);
+            std::string word = readWord(input);
             if (word == "")
             {
                 REMOVE_WHITESPACE_AND_COMMENTS(true)
-                if (stream.peek() != '{')
-                    return "Expected section name, found '" + std::string(1, static_cast<char>(stream.peek())) + "' instead.";
+                if (input.peek() != '{')
+                    return "Expected section name, found '" + std::string(1, static_cast<char>(input.peek())) + "' instead.";
             }
 
             REMOVE_WHITESPACE_AND_COMMENTS(true)
-            if (stream.peek() == '{')
-                return parseSection(stream, root, word);
-            else if (stream.peek() == '=')
-                return parseKeyValue(stream, root, word);
+            if (input.peek() == '{')
+                return parseSection(input, root, word);
+            else if (input.peek() == '=')
+                return parseKeyValue(input, root, word);
             else
-                return "Expected '{' or '=', found '" + std::string(1, static_cast<char>(stream.peek())) + "' instead.";
+                return "Expected '{' or '=', found '" + std::string(1, static_cast<char>(input.peek())) + "' instead.";
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // The binary format consists of a header, a table with the offset and length of every string, the characters of all
+        // strings and finally the words that describe the nodes. All integers are 32-bit and are stored in the byte order of
+        // the machine that created the file.
+        //
+        // A node is stored as the string index of the part of its name in front of the first dot (e.g. the widget type), the
+        // string index of the part behind the dot plus one (or 0 when the name has no dot), its property count and child
+        // count, followed by its properties and then by its children. A property is
+        // stored as the string index of its key, the value tag and the string index of the value text, followed by the data
+        // of the tag (see ValueTag). The text is always kept, so that the parsed tree emits the exact same text again.
+        const char binaryMagic[8] = {'T', 'G', 'U', 'I', 'F', 'R', 'M', 'B'};
+        const std::uint32_t binaryByteOrderMark = 0x01020304;
+        const std::uint32_t binaryVersion = 3;
+
+        struct BinaryHeader
+        {
+            char magic[8];
+            std::uint32_t byteOrderMark;
+            std::uint32_t version;
+            std::uint32_t stringCount;
+            std::uint32_t stringDataSize;
+            std::uint32_t nodeWordCount;
+        };
+
+        // Data words that follow the value text of a property:
+        //   Text:     none
+        //   List:     item count, string index of each item
+        //   Number:   float
+        //   Bool:     0 or 1
+        //   Color:    red | green << 8 | blue << 16 | alpha << 24
+        //   Outline:  left, top, right and bottom as floats
+        //   Texture:  string index of the filename, part rect, middle rect, smooth
+        //   Layout:   string indices of the x and y expressions
+        enum class ValueTag : std::uint32_t
+        {
+            Text,
+            List,
+            Number,
+            Bool,
+            Color,
+            Outline,
+            Texture,
+            Layout
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::uint32_t floatToWord(float value)
+        {
+            std::uint32_t word;
+            std::memcpy(&word, &value, sizeof(word));
+            return word;
+        }
+
+        float wordToFloat(std::uint32_t word)
+        {
+            float value;
+            std::memcpy(&value, &word, sizeof(value));
+            return value;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool isNumber(const std::string& str)
+        {
+            bool digitFound = false;
+            for (std::size_t i = 0; i < str.length(); ++i)
+            {
+                if ((str[i] >= '0') && (str[i] <= '9'))
+                    digitFound = true;
+                else if ((str[i] != '.') && !((i == 0) && ((str[i] == '-') || (str[i] == '+'))))
+                    return false;
+            }
+
+            return digitFound;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool hasImageExtension(const std::string& filename)
+        {
+            const auto dotPos = filename.find_last_of('.');
+            if (dotPos == std::string::npos)
+                return false;
+
+            const std::string extension = toLower(filename.substr(dotPos + 1));
+            return (extension == "png") || (extension == "jpg") || (extension == "jpeg") || (extension == "bmp")
+                || (extension == "tga") || (extension == "gif") || (extension == "psd") || (extension == "hdr") || (extension == "pic");
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Splits the value between brackets at the commas that aren't nested inside other brackets
+        std::vector<std::string> splitBracketedValue(const std::string& str)
+        {
+            std::vector<std::string> tokens;
+            if ((str.size() < 2) || (str.front() != '(') || (str.back() != ')'))
+                return tokens;
+
+            unsigned int bracketCount = 0;
+            std::size_t tokenStart = 1;
+            for (std::size_t i = 1; i < str.size() - 1; ++i)
+            {
+                if (str[i] == '(')
+                    ++bracketCount;
+                else if (str[i] == ')')
+                {
+                    if (bracketCount == 0)
+                        return {};
+
+                    --bracketCount;
+                }
+                else if ((str[i] == ',') && (bracketCount == 0))
+                {
+                    tokens.push_back(trim(str.substr(tokenStart, i - tokenStart)));
+                    tokenStart = i + 1;
+                }
+            }
+
+            if (bracketCount != 0)
+                return {};
+
+            tokens.push_back(trim(str.substr(tokenStart, str.size() - 1 - tokenStart)));
+            return tokens;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Collects the strings and node words while emitting a binary file. Identical strings are only stored once.
+        struct BinaryWriter
+        {
+            std::uint32_t addString(const std::string& str)
+            {
+                const auto it = stringIndices.find(str);
+                if (it != stringIndices.end())
+                    return it->second;
+
+                const auto index = static_cast<std::uint32_t>(stringTable.size() / 2);
+                stringTable.push_back(static_cast<std::uint32_t>(stringData.size()));
+                stringTable.push_back(static_cast<std::uint32_t>(str.size()));
+                stringData += str;
+                stringIndices[str] = index;
+                return index;
+            }
+
+            void addNode(const DataIO::Node& node)
+            {
+                const auto dotPos = node.name.find('.');
+                words.push_back(addString(node.name.substr(0, dotPos)));
+                words.push_back((dotPos != std::string::npos) ? addString(node.name.substr(dotPos + 1)) + 1 : 0);
+                words.push_back(static_cast<std::uint32_t>(node.propertyValuePairs.size()));
+                words.push_back(static_cast<std::uint32_t>(node.children.size()));
+
+                for (const auto& pair : node.propertyValuePairs)
+                {
+                    words.push_back(addString(pair.first));
+                    addValue(*pair.second);
+                }
+
+                for (const auto& child : node.children)
+                    addNode(*child);
+            }
+
+            void addValue(const DataIO::ValueNode& valueNode)
+            {
+                const std::string& value = valueNode.value;
+                if (valueNode.listNode)
+                {
+                    words.push_back(static_cast<std::uint32_t>(ValueTag::List));
+                    words.push_back(addString(value));
+                    words.push_back(static_cast<std::uint32_t>(valueNode.valueList.size()));
+                    for (const auto& item : valueNode.valueList)
+                        words.push_back(addString(item));
+                    return;
+                }
+
+                // Store the value decoded when its type can be recognized. The decoded form is only a shortcut for the loader,
+                // when the guess is wrong (e.g. a number that is used as a string) the text will simply be parsed instead.
+                std::vector<std::uint32_t> data;
+                const ValueTag tag = decodeValue(value, data);
+                words.push_back(static_cast<std::uint32_t>(tag));
+                words.push_back(addString(value));
+                words.insert(words.end(), data.begin(), data.end());
+            }
+
+            ValueTag decodeValue(const std::string& value, std::vector<std::uint32_t>& data)
+            {
+                if (value.empty())
+                    return ValueTag::Text;
+
+                try
+                {
+                    if ((value == "true") || (value == "false"))
+                    {
+                        data.push_back((value == "true") ? 1 : 0);
+                        return ValueTag::Bool;
+                    }
+                    else if (isNumber(value))
+                    {
+                        data.push_back(floatToWord(Deserializer::deserialize(ObjectConverter::Type::Number, value).getNumber()));
+                        return ValueTag::Number;
+                    }
+                    else if ((value[0] == '#') || (toLower(value.substr(0, 4)) == "rgb(") || (toLower(value.substr(0, 5)) == "rgba("))
+                    {
+                        const Color color = Deserializer::deserialize(ObjectConverter::Type::Color, value).getColor();
+                        data.push_back(static_cast<std::uint32_t>(color.getRed())
+                                       | (static_cast<std::uint32_t>(color.getGreen()) << 8)
+                                       | (static_cast<std::uint32_t>(color.getBlue()) << 16)
+                                       | (static_cast<std::uint32_t>(color.getAlpha()) << 24));
+                        return ValueTag::Color;
+                    }
+                    else if (value[0] == '"')
+                    {
+                        std::string filename;
+                        sf::IntRect partRect;
+                        sf::IntRect middleRect;
+                        bool smooth;
+                        Deserializer::readTexture(value, filename, partRect, middleRect, smooth);
+
+                        // A quoted string is only considered a texture when it has texture parameters or an image extension
+                        if ((partRect == sf::IntRect{}) && (middleRect == sf::IntRect{}) && !smooth && !hasImageExtension(filename))
+                            return ValueTag::Text;
+
+                        data.push_back(addString(filename));
+                        for (const auto& rect : {partRect, middleRect})
+                        {
+                            data.push_back(static_cast<std::uint32_t>(rect.left));
+                            data.push_back(static_cast<std::uint32_t>(rect.top));
+                            data.push_back(static_cast<std::uint32_t>(rect.width));
+                            data.push_back(static_cast<std::uint32_t>(rect.height));
+                        }
+                        data.push_back(smooth ? 1 : 0);
+                        return ValueTag::Texture;
+                    }
+                    else if (value[0] == '(')
+                    {
+                        const std::vector<std::string> tokens = splitBracketedValue(value);
+                        if ((tokens.size() == 4) && isNumber(tokens[0]) && isNumber(tokens[1]) && isNumber(tokens[2]) && isNumber(tokens[3]))
+                        {
+                            for (const auto& token : tokens)
+                                data.push_back(floatToWord(strToFloat(token)));
+                            return ValueTag::Outline;
+                        }
+                        else if ((tokens.size() == 2) && !tokens[0].empty() && !tokens[1].empty())
+                        {
+                            // Quotes around the expressions are removed, like when parsing a layout
+                            for (std::string token : tokens)
+                            {
+                                if ((token.size() >= 2) && (token[0] == '"') && (token[token.length()-1] == '"'))
+                                    token = token.substr(1, token.length()-2);
+
+                                data.push_back(addString(token));
+                            }
+                            return ValueTag::Layout;
+                        }
+                    }
+                }
+                catch (const Exception&)
+                {
+                    // The value isn't what it looked like, it is kept as text
+                    data.clear();
+                }
+
+                return ValueTag::Text;
+            }
+
+            std::map<std::string, std::uint32_t> stringIndices;
+            std::vector<std::uint32_t> stringTable;
+            std::string stringData;
+            std::vector<std::uint32_t> words;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Reconstructs the nodes from a binary file, with bounds checks on everything that is read from the file
+        struct BinaryReader
+        {
+            std::uint32_t readWord()
+            {
+                if (wordIndex >= wordCount)
+                    throw Exception{"Error while parsing binary input. Unexpected end of node data."};
+
+                std::uint32_t word;
+                std::memcpy(&word, words + wordIndex * sizeof(std::uint32_t), sizeof(word));
+                ++wordIndex;
+                return word;
+            }
+
+            std::string getString(std::uint32_t index) const
+            {
+                if (index >= stringCount)
+                    throw Exception{"Error while parsing binary input. String index out of range."};
+
+                std::uint32_t entry[2];
+                std::memcpy(entry, stringTable + index * sizeof(entry), sizeof(entry));
+                if ((entry[0] > stringDataSize) || (entry[1] > stringDataSize - entry[0]))
+                    throw Exception{"Error while parsing binary input. String lies outside the string data."};
+
+                return std::string(stringData + entry[0], entry[1]);
+            }
+
+            std::string readString()
+            {
+                return getString(readWord());
+            }
+
+            void readNode(DataIO::Node& node)
+            {
+                node.name = readString();
+                const std::uint32_t nameIndex = readWord();
+                if (nameIndex > 0)
+                    node.name += '.' + getString(nameIndex - 1);
+
+                const std::uint32_t propertyCount = readWord();
+                const std::uint32_t childCount = readWord();
+
+                for (std::uint32_t i = 0; i < propertyCount; ++i)
+                {
+                    std::string key = readString();
+                    node.propertyValuePairs[std::move(key)] = readValue();
+                }
+
+                // Every child requires at least 4 words, which prevents reserving memory for an invalid count
+                if (childCount > (wordCount - wordIndex) / 4)
+                    throw Exception{"Error while parsing binary input. Unexpected end of node data."};
+
+                node.children.reserve(childCount);
+                for (std::uint32_t i = 0; i < childCount; ++i)
+                {
+                    node.children.push_back(std::make_unique<DataIO::Node>());
+                    node.children.back()->parent = &node;
+                    readNode(*node.children.back());
+                }
+            }
+
+            std::unique_ptr<DataIO::ValueNode> readValue()
+            {
+                const std::uint32_t tag = readWord();
+                auto valueNode = std::make_unique<DataIO::ValueNode>(readString());
+
+                if (static_cast<ValueTag>(tag) == ValueTag::Text)
+                    return valueNode;
+
+                if (static_cast<ValueTag>(tag) == ValueTag::List)
+                {
+                    const std::uint32_t listSize = readWord();
+                    if (listSize > wordCount - wordIndex)
+                        throw Exception{"Error while parsing binary input. Unexpected end of node data."};
+
+                    valueNode->listNode = true;
+                    valueNode->valueList.reserve(listSize);
+                    for (std::uint32_t i = 0; i < listSize; ++i)
+                        valueNode->valueList.push_back(readString());
+
+                    return valueNode;
+                }
+
+                auto decoded = std::make_shared<DataIO::DecodedValue>();
+                switch (static_cast<ValueTag>(tag))
+                {
+                    case ValueTag::Number:
+                    {
+                        decoded->type = DataIO::DecodedValue::Type::Number;
+                        decoded->numbers[0] = wordToFloat(readWord());
+                        break;
+                    }
+                    case ValueTag::Bool:
+                    {
+                        decoded->type = DataIO::DecodedValue::Type::Bool;
+                        decoded->numbers[0] = (readWord() != 0) ? 1.f : 0.f;
+                        break;
+                    }
+                    case ValueTag::Color:
+                    {
+                        const std::uint32_t rgba = readWord();
+                        decoded->type = DataIO::DecodedValue::Type::Color;
+                        for (unsigned int i = 0; i < 4; ++i)
+                            decoded->numbers[i] = static_cast<float>((rgba >> (8 * i)) & 0xFF);
+                        break;
+                    }
+                    case ValueTag::Outline:
+                    {
+                        decoded->type = DataIO::DecodedValue::Type::Outline;
+                        for (unsigned int i = 0; i < 4; ++i)
+                            decoded->numbers[i] = wordToFloat(readWord());
+                        break;
+                    }
+                    case ValueTag::Texture:
+                    {
+                        decoded->type = DataIO::DecodedValue::Type::Texture;
+                        decoded->strings[0] = readString();
+                        for (unsigned int i = 0; i < 8; ++i)
+                            decoded->rects[i] = static_cast<int>(readWord());
+                        decoded->smooth = (readWord() != 0);
+                        break;
+                    }
+                    case ValueTag::Layout:
+                    {
+                        decoded->type = DataIO::DecodedValue::Type::Layout;
+                        decoded->strings[0] = readString();
+                        decoded->strings[1] = readString();
+                        break;
+                    }
+                    default:
+                        throw Exception{"Error while parsing binary input. Unknown value type " + to_string(tag) + "."};
+                }
+
+                valueNode->decoded = std::move(decoded);
+                return valueNode;
+            }
+
+            const char* stringTable;
+            const char* stringData;
+            const char* words;
+            std::uint32_t stringCount;
+            std::uint32_t stringDataSize;
+            std::uint32_t wordCount;
+            std::uint32_t wordIndex;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::unique_ptr<DataIO::Node> parseBinaryInput(const char* data, std::size_t size)
+        {
+            BinaryHeader header;
+            if (size < sizeof(header))
+                throw Exception{"Error while parsing binary input. The header is incomplete."};
+
+            std::memcpy(&header, data, sizeof(header));
+            if (header.byteOrderMark != binaryByteOrderMark)
+                throw Exception{"Error while parsing binary input. The file was created on a machine with a different byte order."};
+            if (header.version != binaryVersion)
+                throw Exception{"Error while parsing binary input. Unsupported version " + to_string(header.version) + "."};
+
+            const std::uint64_t requiredSize = sizeof(header)
+                                             + std::uint64_t{header.stringCount} * 2 * sizeof(std::uint32_t)
+                                             + header.stringDataSize
+                                             + std::uint64_t{header.nodeWordCount} * sizeof(std::uint32_t);
+            if (requiredSize > size)
+                throw Exception{"Error while parsing binary input. The file is truncated."};
+
+            BinaryReader reader;
+            reader.stringTable = data + sizeof(header);
+            reader.stringData = reader.stringTable + header.stringCount * 2 * sizeof(std::uint32_t);
+            reader.words = reader.stringData + header.stringDataSize;
+            reader.stringCount = header.stringCount;
+            reader.stringDataSize = header.stringDataSize;
+            reader.wordCount = header.nodeWordCount;
+            reader.wordIndex = 0;
+
+            auto root = std::make_unique<DataIO::Node>();
+            reader.readNode(*root);
+            return root;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::unique_ptr<DataIO::Node> parseInput(InputBuffer& input)
+        {
+            if (DataIO::isBinary(input.current, static_cast<std::size_t>(input.end - input.current)))
+                return parseBinaryInput(input.current, static_cast<std::size_t>(input.end - input.current));
+
+            auto root = std::make_unique<DataIO::Node>();
+
+            std::string error;
+            while (input.peek() != EOF)
+            {
+                error = parseRootSection(input, root);
+                if (!error.empty())
+                {
+                    // The line number is only known when the error didn't occur at the end of the input
+                    if (input.current < input.end)
+                    {
+                        const std::size_t lineNumber = std::count(input.begin, input.current, '\n') + 1;
+                        throw Exception{"Error while parsing input at line " + to_string(lineNumber) + ". " + error};
+                    }
+                    else
+                        throw Exception{"Error while parsing input. " + error};
+                }
+            }
+
+            return root;
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -497,27 +1044,25 @@ namespace tgui
 
     std::unique_ptr<DataIO::Node> DataIO::parse(std::stringstream& stream)
     {
-        auto root = std::make_unique<Node>();
+        const std::string str = stream.str();
 
-        std::string error;
-        while (stream.peek() != EOF)
-        {
-            error = parseRootSection(stream, root);
-            if (!error.empty())
-            {
-                if (stream.tellg() != std::stringstream::pos_type(-1))
-                {
-                    std::string str = stream.str();
-                    auto position = static_cast<std::iterator_traits<std::string::const_iterator>::difference_type>(stream.tellg());
-                    std::size_t lineNumber = std::count(str.begin(), str.begin() + position, '\n') + 1;
-                    throw Exception{"Error while parsing input at line " + to_string(lineNumber) + ". " + error};
-                }
-                else
-                    throw Exception{"Error while parsing input. " + error};
-            }
-        }
+        std::size_t startPos = 0;
+        if (stream.tellg() != std::stringstream::pos_type(-1))
+            startPos = static_cast<std::size_t>(stream.tellg());
+
+        // The entire stream is parsed, so we move the read position to the end
+        stream.seekg(0, std::ios::end);
+
+        InputBuffer input{str.data(), str.size(), startPos};
+        return parseInput(input);
+    }
 
-        return root;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> DataIO::parse(const char* data, std::size_t size)
+    {
+        InputBuffer input{data, size};
+        return parseInput(input);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -545,6 +1090,34 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::emitBinary(const std::unique_ptr<Node>& rootNode, std::stringstream& stream)
+    {
+        BinaryWriter writer;
+        writer.addNode(*rootNode);
+
+        BinaryHeader header;
+        std::memcpy(header.magic, binaryMagic, sizeof(binaryMagic));
+        header.byteOrderMark = binaryByteOrderMark;
+        header.version = binaryVersion;
+        header.stringCount = static_cast<std::uint32_t>(writer.stringTable.size() / 2);
+        header.stringDataSize = static_cast<std::uint32_t>(writer.stringData.size());
+        header.nodeWordCount = static_cast<std::uint32_t>(writer.words.size());
+
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        stream.write(reinterpret_cast<const char*>(writer.stringTable.data()), writer.stringTable.size() * sizeof(std::uint32_t));
+        stream.write(writer.stringData.data(), writer.stringData.size());
+        stream.write(reinterpret_cast<const char*>(writer.words.data()), writer.words.size() * sizeof(std::uint32_t));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool DataIO::isBinary(const char* data, std::size_t size)
+    {
+        return (size >= sizeof(binaryMagic)) && (std::memcmp(data, binaryMagic, sizeof(binaryMagic)) == 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
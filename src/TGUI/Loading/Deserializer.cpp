@@ -289,85 +289,11 @@ namespace tgui
                     return Texture{value};
             }
 
-            std::string::const_iterator c = value.begin();
-            ++c; // Skip the opening quote
-
             std::string filename;
-            char prev = '\0';
-
-            // Look for the end quote
-            bool filenameFound = false;
-            while (c != value.end())
-            {
-                if ((*c != '"') || (prev == '\\'))
-                {
-                    prev = *c;
-                    filename.push_back(*c);
-                    ++c;
-                }
-                else
-                {
-                    ++c;
-                    filenameFound = true;
-                    break;
-                }
-            }
-
-            if (!filenameFound)
-                throw Exception{"Failed to deserialize texture '" + value + "'. Failed to find the closing quote of the filename."};
-
-            // There may be optional parameters
             sf::IntRect partRect;
             sf::IntRect middleRect;
             bool smooth = false;
-
-            while (removeWhitespace(value, c))
-            {
-                std::string word;
-                auto openingBracketPos = value.find('(', c - value.begin());
-                if (openingBracketPos != std::string::npos)
-                    word = value.substr(c - value.begin(), openingBracketPos - (c - value.begin()));
-                else
-                {
-                    if (toLower(trim(value.substr(c - value.begin()))) == "smooth")
-                    {
-                        smooth = true;
-                        break;
-                    }
-                    else
-                        throw Exception{"Failed to deserialize texture '" + value + "'. Invalid text found behind filename."};
-                }
-
-                sf::IntRect* rect = nullptr;
-                if ((word == "Part") || (word == "part"))
-                {
-                    rect = &partRect;
-                    std::advance(c, 4);
-                }
-                else if ((word == "Middle") || (word == "middle"))
-                {
-                    rect = &middleRect;
-                    std::advance(c, 6);
-                }
-                else
-                {
-                    if (word.empty())
-                        throw Exception{"Failed to deserialize texture '" + value + "'. Expected 'Part' or 'Middle' in front of opening bracket."};
-                    else
-                        throw Exception{"Failed to deserialize texture '" + value + "'. Unexpected word '" + word + "' in front of opening bracket. Expected 'Part' or 'Middle'."};
-                }
-
-                auto closeBracketPos = value.find(')', c - value.begin());
-                if (closeBracketPos != std::string::npos)
-                {
-                    if (!readIntRect(value.substr(c - value.begin(), closeBracketPos - (c - value.begin()) + 1), *rect))
-                        throw Exception{"Failed to parse " + word + " rectangle while deserializing texture '" + value + "'."};
-                }
-                else
-                    throw Exception{"Failed to deserialize texture '" + value + "'. Failed to find closing bracket for " + word + " rectangle."};
-
-                std::advance(c, closeBracketPos - (c - value.begin()) + 1);
-            }
+            Deserializer::readTexture(value, filename, partRect, middleRect, smooth);
 
             return Texture{filename, partRect, middleRect, smooth};
         }
@@ -398,8 +324,7 @@ namespace tgui
 
         ObjectConverter deserializeRendererData(const std::string& renderer)
         {
-            std::stringstream ss{renderer};
-            auto node = DataIO::parse(ss);
+            auto node = DataIO::parse(renderer.data(), renderer.size());
 
             // The root node should contain exactly one child which is the node we need
             if (node->propertyValuePairs.empty() && (node->children.size() == 1))
@@ -420,6 +345,33 @@ namespace tgui
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Checks whether the function that deserializes the type is still the default one and wasn't replaced with setFunction
+        bool isDefaultFunction(ObjectConverter::Type type, const Deserializer::DeserializeFunc& func)
+        {
+            using FunctionPtr = ObjectConverter(*)(const std::string&);
+            const FunctionPtr* functionPtr = func.target<FunctionPtr>();
+            if (!functionPtr)
+                return false;
+
+            switch (type)
+            {
+                case ObjectConverter::Type::Bool:
+                    return *functionPtr == deserializeBool;
+                case ObjectConverter::Type::Color:
+                    return *functionPtr == deserializeColor;
+                case ObjectConverter::Type::Number:
+                    return *functionPtr == deserializeNumber;
+                case ObjectConverter::Type::Outline:
+                    return *functionPtr == deserializeOutline;
+                case ObjectConverter::Type::Texture:
+                    return *functionPtr == deserializeTexture;
+                default:
+                    return false;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -447,6 +399,57 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    ObjectConverter Deserializer::deserialize(ObjectConverter::Type type, const DataIO::ValueNode& node)
+    {
+        // The decoded value can only be used instead of the default functions, a custom function always gets the string
+        if (node.decoded && isDefaultFunction(type, m_deserializers[type]))
+        {
+            const DataIO::DecodedValue& decoded = *node.decoded;
+            switch (decoded.type)
+            {
+                case DataIO::DecodedValue::Type::Number:
+                    if (type == ObjectConverter::Type::Number)
+                        return decoded.numbers[0];
+                    break;
+
+                case DataIO::DecodedValue::Type::Bool:
+                    if (type == ObjectConverter::Type::Bool)
+                        return decoded.numbers[0] != 0;
+                    break;
+
+                case DataIO::DecodedValue::Type::Color:
+                    if (type == ObjectConverter::Type::Color)
+                    {
+                        return Color{static_cast<std::uint8_t>(decoded.numbers[0]), static_cast<std::uint8_t>(decoded.numbers[1]),
+                                     static_cast<std::uint8_t>(decoded.numbers[2]), static_cast<std::uint8_t>(decoded.numbers[3])};
+                    }
+                    break;
+
+                case DataIO::DecodedValue::Type::Outline:
+                    if (type == ObjectConverter::Type::Outline)
+                        return Outline{decoded.numbers[0], decoded.numbers[1], decoded.numbers[2], decoded.numbers[3]};
+                    break;
+
+                case DataIO::DecodedValue::Type::Texture:
+                    if (type == ObjectConverter::Type::Texture)
+                    {
+                        return Texture{decoded.strings[0],
+                                       {decoded.rects[0], decoded.rects[1], decoded.rects[2], decoded.rects[3]},
+                                       {decoded.rects[4], decoded.rects[5], decoded.rects[6], decoded.rects[7]},
+                                       decoded.smooth};
+                    }
+                    break;
+
+                default:
+                    break;
+            }
+        }
+
+        return deserialize(type, node.value);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Deserializer::setFunction(ObjectConverter::Type type, const DeserializeFunc& deserializer)
     {
         m_deserializers[type] = deserializer;
@@ -461,6 +464,91 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Deserializer::readTexture(const std::string& value, std::string& filename, sf::IntRect& partRect, sf::IntRect& middleRect, bool& smooth)
+    {
+        std::string::const_iterator c = value.begin();
+        ++c; // Skip the opening quote
+
+        filename.clear();
+        char prev = '\0';
+
+        // Look for the end quote
+        bool filenameFound = false;
+        while (c != value.end())
+        {
+            if ((*c != '"') || (prev == '\\'))
+            {
+                prev = *c;
+                filename.push_back(*c);
+                ++c;
+            }
+            else
+            {
+                ++c;
+                filenameFound = true;
+                break;
+            }
+        }
+
+        if (!filenameFound)
+            throw Exception{"Failed to deserialize texture '" + value + "'. Failed to find the closing quote of the filename."};
+
+        // There may be optional parameters
+        partRect = {};
+        middleRect = {};
+        smooth = false;
+
+        while (removeWhitespace(value, c))
+        {
+            std::string word;
+            auto openingBracketPos = value.find('(', c - value.begin());
+            if (openingBracketPos != std::string::npos)
+                word = value.substr(c - value.begin(), openingBracketPos - (c - value.begin()));
+            else
+            {
+                if (toLower(trim(value.substr(c - value.begin()))) == "smooth")
+                {
+                    smooth = true;
+                    break;
+                }
+                else
+                    throw Exception{"Failed to deserialize texture '" + value + "'. Invalid text found behind filename."};
+            }
+
+            sf::IntRect* rect = nullptr;
+            if ((word == "Part") || (word == "part"))
+            {
+                rect = &partRect;
+                std::advance(c, 4);
+            }
+            else if ((word == "Middle") || (word == "middle"))
+            {
+                rect = &middleRect;
+                std::advance(c, 6);
+            }
+            else
+            {
+                if (word.empty())
+                    throw Exception{"Failed to deserialize texture '" + value + "'. Expected 'Part' or 'Middle' in front of opening bracket."};
+                else
+                    throw Exception{"Failed to deserialize texture '" + value + "'. Unexpected word '" + word + "' in front of opening bracket. Expected 'Part' or 'Middle'."};
+            }
+
+            auto closeBracketPos = value.find(')', c - value.begin());
+            if (closeBracketPos != std::string::npos)
+            {
+                if (!readIntRect(value.substr(c - value.begin(), closeBracketPos - (c - value.begin()) + 1), *rect))
+                    throw Exception{"Failed to parse " + word + " rectangle while deserializing texture '" + value + "'."};
+            }
+            else
+                throw Exception{"Failed to deserialize texture '" + value + "'. Failed to find closing bracket for " + word + " rectangle."};
+
+            std::advance(c, closeBracketPos - (c - value.begin()) + 1);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::vector<std::string> Deserializer::split(const std::string& str, char delim)
     {
         std::vector<std::string> tokens;
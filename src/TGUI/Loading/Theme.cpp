@@ -25,6 +25,7 @@
 
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Loading/Serializer.hpp>
+#include <TGUI/TextureManager.hpp>
 #include <TGUI/Global.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -261,10 +262,13 @@ namespace tgui
                                                        {"backgroundcolorhover", Color::White},
                                                        {"selectedbackgroundcolor", Color{0, 110, 255}},
                                                        {"selectedbackgroundcolorhover", Color{30, 150, 255}}})},
-                    {"verticallayout", RendererData::create({})}
+                    {"verticallayout", RendererData::create({})},
+                    {"virtuallistpanel", RendererData::create({{"bordercolor", Color::Black},
+                                                               {"backgroundcolor", Color::White}})}
                };
             }
         };
+
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -278,7 +282,10 @@ namespace tgui
         m_primary(primary)
     {
         if (!primary.empty())
+        {
+            const TextureManager::LoadBatch batch;
             m_themeLoader->preload(primary);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -293,6 +300,9 @@ namespace tgui
 
     void Theme::load(const std::string& primary)
     {
+        // All textures of the theme are loaded in one batch, the image is only decoded once for all parts that use it
+        const TextureManager::LoadBatch batch;
+
         m_primary = primary;
         m_themeLoader->preload(primary);
 
@@ -300,59 +310,37 @@ namespace tgui
         for (auto& pair : m_renderers)
         {
             auto& renderer = pair.second;
-            const auto oldData = renderer;
 
             if (!m_themeLoader->canLoad(m_primary, pair.first))
                 continue;
 
-            auto& properties = m_themeLoader->load(m_primary, pair.first);
-
             // Update the property-value pairs of the renderer
-            renderer->propertyValuePairs = std::map<std::string, ObjectConverter>{};
-            for (const auto& property : properties)
-                renderer->propertyValuePairs[property.first] = ObjectConverter(property.second);
-
-            // Tell the widgets that were using this renderer about all the updated properties, both new ones and old ones that were now reset to their default value
-            auto oldIt = oldData->propertyValuePairs.begin();
-            auto newIt = renderer->propertyValuePairs.begin();
-            while (oldIt != oldData->propertyValuePairs.end() && newIt != renderer->propertyValuePairs.end())
-            {
-                if (oldIt->first < newIt->first)
-                {
-                    // Update values that no longer exist in the new renderer and are now reset to the default value
-                    for (const auto& observer : renderer->observers)
-                        observer.second(oldIt->first);
+            const PropertyValueMap oldProperties = std::move(renderer->propertyValuePairs);
+            renderer->propertyValuePairs = m_themeLoader->loadProperties(m_primary, pair.first);
 
-                    ++oldIt;
-                }
-                else
+            // Tell the widgets that were using this renderer about all the updated properties, both new ones and old ones that were now reset to their default value.
+            // Properties that still have the same value don't have to be sent to the widgets again.
+            for (const auto& oldProperty : oldProperties)
+            {
+                // Update values that no longer exist in the new renderer and are now reset to the default value
+                if (renderer->propertyValuePairs.find(oldProperty.first) == renderer->propertyValuePairs.end())
                 {
-                    // Update changed and new properties
                     for (const auto& observer : renderer->observers)
-                        observer.second(newIt->first);
-
-                    if (newIt->first < oldIt->first)
-                        ++newIt;
-                    else
-                    {
-                        ++oldIt;
-                        ++newIt;
-                    }
+                        observer.second(oldProperty.first);
                 }
             }
-            while (oldIt != oldData->propertyValuePairs.end())
-            {
-                for (const auto& observer : renderer->observers)
-                    observer.second(oldIt->first);
 
-                ++oldIt;
-            }
-            while (newIt != renderer->propertyValuePairs.end())
+            // Update changed and new properties. The map is accessed by index as observers may add default values to it.
+            const std::size_t newPropertyCount = renderer->propertyValuePairs.size();
+            for (std::size_t i = 0; i < newPropertyCount; ++i)
             {
-                for (const auto& observer : renderer->observers)
-                    observer.second(newIt->first);
+                const auto& property = *(renderer->propertyValuePairs.begin() + i);
+                const auto oldIt = oldProperties.find(property.first);
+                if ((oldIt != oldProperties.end()) && (oldIt->second == property.second))
+                    continue;
 
-                ++newIt;
+                for (const auto& observer : renderer->observers)
+                    observer.second(property.first);
             }
         }
     }
@@ -368,10 +356,9 @@ namespace tgui
         if (it != m_renderers.end())
             return it->second;
 
+        const TextureManager::LoadBatch batch;
         m_renderers[lowercaseSecondary] = RendererData::create();
-        auto& properties = m_themeLoader->load(m_primary, lowercaseSecondary);
-        for (const auto& property : properties)
-            m_renderers[lowercaseSecondary]->propertyValuePairs[property.first] = ObjectConverter(property.second);
+        m_renderers[lowercaseSecondary]->propertyValuePairs = m_themeLoader->loadProperties(m_primary, lowercaseSecondary);
 
         return m_renderers[lowercaseSecondary];
     }
@@ -392,9 +379,8 @@ namespace tgui
         if (!m_themeLoader->canLoad(m_primary, lowercaseSecondary))
             return nullptr;
 
-        auto& properties = m_themeLoader->load(m_primary, lowercaseSecondary);
-        for (const auto& property : properties)
-            m_renderers[lowercaseSecondary]->propertyValuePairs[property.first] = ObjectConverter(property.second);
+        const TextureManager::LoadBatch batch;
+        m_renderers[lowercaseSecondary]->propertyValuePairs = m_themeLoader->loadProperties(m_primary, lowercaseSecondary);
 
         return m_renderers[lowercaseSecondary];
     }
@@ -26,11 +26,11 @@
 #include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Loading/ThemeLoader.hpp>
 #include <TGUI/Loading/DataIO.hpp>
+#include <TGUI/Renderers/WidgetRenderer.hpp>
 #include <TGUI/Global.hpp>
 
 #include <cassert>
 #include <sstream>
-#include <fstream>
 #include <set>
 
 #ifdef SFML_SYSTEM_ANDROID
@@ -133,6 +133,33 @@ namespace tgui
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Checks whether the value is a filename of an image, either quoted or as plain text (e.g. "image.png" or image.png).
+        // Optional parameters like Part, Middle or Smooth may follow the quoted filename.
+        bool isImageFilename(const std::string& str)
+        {
+            std::string filename;
+            if (str[0] == '"')
+            {
+                const auto quotePos = str.find('"', 1);
+                if (quotePos == std::string::npos)
+                    return false;
+
+                filename = toLower(str.substr(1, quotePos - 1));
+            }
+            else
+                filename = toLower(str);
+
+            const auto dotPos = filename.find_last_of('.');
+            if (dotPos == std::string::npos)
+                return false;
+
+            const std::string extension = filename.substr(dotPos + 1);
+            return (extension == "png") || (extension == "jpg") || (extension == "jpeg") || (extension == "bmp")
+                || (extension == "tga") || (extension == "gif") || (extension == "psd") || (extension == "hdr") || (extension == "pic");
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -143,6 +170,62 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    PropertyValueMap BaseThemeLoader::loadProperties(const std::string& primary, const std::string& secondary)
+    {
+        PropertyValueMap properties;
+        for (const auto& property : load(primary, secondary))
+            properties[property.first] = decodeValue(property.second);
+
+        return properties;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter BaseThemeLoader::decodeValue(const sf::String& value)
+    {
+        const std::string str = trim(value);
+        if (str.empty())
+            return ObjectConverter{value};
+
+        const std::string lowercaseStr = toLower(str);
+
+        ObjectConverter::Type type;
+        if (str[0] == '{')
+            type = ObjectConverter::Type::RendererData;
+        else if ((str[0] == '#') || (lowercaseStr.compare(0, 4, "rgb(") == 0) || (lowercaseStr.compare(0, 5, "rgba(") == 0))
+            type = ObjectConverter::Type::Color;
+        else if (str[0] == '(')
+            type = ObjectConverter::Type::Outline;
+        else if (isImageFilename(str))
+            type = ObjectConverter::Type::Texture;
+        else
+            return ObjectConverter{value};
+
+        try
+        {
+            ObjectConverter decoded = Deserializer::deserialize(type, str);
+
+            // Sections inside the renderer are decoded as well
+            if (type == ObjectConverter::Type::RendererData)
+            {
+                for (auto& pair : decoded.getRenderer()->propertyValuePairs)
+                {
+                    if (pair.second.getType() == ObjectConverter::Type::String)
+                        pair.second = decodeValue(pair.second.getString());
+                }
+            }
+
+            return decoded;
+        }
+        catch (const Exception&)
+        {
+            // Keep the string, the exception will be thrown again when a widget tries to use the value
+            return ObjectConverter{value};
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void DefaultThemeLoader::flushCache(const std::string& filename)
     {
         if (filename != "")
@@ -172,10 +255,10 @@ namespace tgui
             if (slashPos != std::string::npos)
                 resourcePath = filename.substr(0, slashPos+1);
 
-            std::stringstream fileContents;
+            std::string fileContents;
             readFile(filename, fileContents);
 
-            std::unique_ptr<DataIO::Node> root = DataIO::parse(fileContents);
+            std::unique_ptr<DataIO::Node> root = DataIO::parse(fileContents.data(), fileContents.size());
 
             if (root->propertyValuePairs.size() != 0)
                 throw Exception{"Unexpected result while loading theme file '" + filename + "'. Root property-value pair found."};
@@ -246,7 +329,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void DefaultThemeLoader::readFile(const std::string& filename, std::stringstream& contents) const
+    void DefaultThemeLoader::readFile(const std::string& filename, std::string& contents) const
     {
         if (filename.empty())
             return;
@@ -283,26 +366,19 @@ namespace tgui
 
             off_t assetLength = AAsset_getLength(asset);
 
-            char* buffer = new char[assetLength + 1];
-            AAsset_read(asset, buffer, assetLength);
-            buffer[assetLength] = 0;
-
-            contents << buffer;
+            contents.resize(static_cast<std::size_t>(assetLength));
+            if (assetLength > 0)
+                AAsset_read(asset, &contents[0], assetLength);
 
             AAsset_close(asset);
-            delete[] buffer;
 
             activity->vm->DetachCurrentThread();
         }
         else
     #endif
         {
-            std::ifstream file{fullFilename};
-            if (!file.is_open())
+            if (!readFileToString(fullFilename, contents))
                 throw Exception{"Failed to open theme file '" + fullFilename + "'."};
-
-            contents << file.rdbuf();
-            file.close();
         }
     }
 
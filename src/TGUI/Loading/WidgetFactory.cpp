@@ -54,8 +54,10 @@
 #include <TGUI/Widgets/SpinButton.hpp>
 #include <TGUI/Widgets/Tabs.hpp>
 #include <TGUI/Widgets/TextBox.hpp>
+#include <TGUI/Widgets/TiledPicture.hpp>
 #include <TGUI/Widgets/TreeView.hpp>
 #include <TGUI/Widgets/VerticalLayout.hpp>
+#include <TGUI/Widgets/VirtualListPanel.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -94,8 +96,10 @@ namespace tgui
         {"spinbutton", std::make_shared<SpinButton>},
         {"tabs", std::make_shared<Tabs>},
         {"textbox", std::make_shared<TextBox>},
+        {"tiledpicture", std::make_shared<TiledPicture>},
         {"treeview", std::make_shared<TreeView>},
-        {"verticallayout", std::make_shared<VerticalLayout>}
+        {"verticallayout", std::make_shared<VerticalLayout>},
+        {"virtuallistpanel", std::make_shared<VirtualListPanel>}
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -38,12 +38,13 @@ namespace tgui
     {
         assert(m_type != Type::None);
 
-        if (m_serialized)
-            return m_string;
+        if (m_type == Type::String)
+            return m_value.get<sf::String>();
+
+        if (!m_serializedString)
+            m_serializedString = std::make_shared<const sf::String>(Serializer::serialize(ObjectConverter{*this}));
 
-        m_string = Serializer::serialize(ObjectConverter{*this});
-        m_serialized = true;
-        return m_string;
+        return *m_serializedString;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -54,10 +55,7 @@ namespace tgui
         assert(m_type == Type::Font || m_type == Type::String);
 
         if (m_type == Type::String)
-        {
-            m_value = Font(m_string);
-            m_type = Type::Font;
-        }
+            decode(Type::Font);
 
         return m_value.get<Font>();
     }
@@ -70,10 +68,7 @@ namespace tgui
         assert(m_type == Type::Color || m_type == Type::String);
 
         if (m_type == Type::String)
-        {
-            m_value = Color(m_string);
-            m_type = Type::Color;
-        }
+            decode(Type::Color);
 
         return m_value.get<Color>();
     }
@@ -86,10 +81,7 @@ namespace tgui
         assert(m_type == Type::Bool || m_type == Type::String);
 
         if (m_type == Type::String)
-        {
-            m_value = Deserializer::deserialize(ObjectConverter::Type::Bool, m_string).getBool();
-            m_type = Type::Bool;
-        }
+            decode(Type::Bool);
 
         return m_value.get<bool>();
     }
@@ -102,10 +94,7 @@ namespace tgui
         assert(m_type == Type::Number || m_type == Type::String);
 
         if (m_type == Type::String)
-        {
-            m_value = Deserializer::deserialize(ObjectConverter::Type::Number, m_string).getNumber();
-            m_type = Type::Number;
-        }
+            decode(Type::Number);
 
         return m_value.get<float>();
     }
@@ -118,10 +107,7 @@ namespace tgui
         assert(m_type == Type::Outline || m_type == Type::String);
 
         if (m_type == Type::String)
-        {
-            m_value = Deserializer::deserialize(ObjectConverter::Type::Outline, m_string).getOutline();
-            m_type = Type::Outline;
-        }
+            decode(Type::Outline);
 
         return m_value.get<Outline>();
     }
@@ -134,10 +120,7 @@ namespace tgui
         assert(m_type == Type::Texture || m_type == Type::String);
 
         if (m_type == Type::String)
-        {
-            m_value = Deserializer::deserialize(ObjectConverter::Type::Texture, m_string).getTexture();
-            m_type = Type::Texture;
-        }
+            decode(Type::Texture);
 
         return m_value.get<Texture>();
     }
@@ -150,10 +133,7 @@ namespace tgui
         assert(m_type == Type::TextStyle || m_type == Type::String);
 
         if (m_type == Type::String)
-        {
-            m_value = Deserializer::deserialize(ObjectConverter::Type::TextStyle, m_string).getTextStyle();
-            m_type = Type::TextStyle;
-        }
+            decode(Type::TextStyle);
 
         return m_value.get<TextStyle>();
     }
@@ -166,16 +146,30 @@ namespace tgui
         assert(m_type == Type::RendererData || m_type == Type::String);
 
         if (m_type == Type::String)
-        {
-            m_value = Deserializer::deserialize(ObjectConverter::Type::RendererData, m_string).getRenderer();
-            m_type = Type::RendererData;
-        }
+            decode(Type::RendererData);
 
         return m_value.get<std::shared_ptr<RendererData>>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ObjectConverter::decode(Type type)
+    {
+        // The string is replaced by the decoded value, it is no longer needed afterwards. The value is only replaced once
+        // decoding succeeded, so that a failed decode leaves the string in place.
+        const sf::String& string = m_value.get<sf::String>();
+        if (type == Type::Font)
+            m_value = Font(string);
+        else if (type == Type::Color)
+            m_value = Color(string);
+        else
+            m_value = std::move(Deserializer::deserialize(type, string).m_value);
+
+        m_type = type;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     ObjectConverter::Type ObjectConverter::getType() const
     {
         return m_type;
@@ -196,7 +190,7 @@ namespace tgui
         case Type::None:
             return true;
         case Type::String:
-            return m_string == right.m_string;
+            return m_value.get<sf::String>() == right.m_value.get<sf::String>();
         case Type::Bool:
             return m_value.get<bool>() == right.m_value.get<bool>();
         case Type::Font:
@@ -0,0 +1,202 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/PropertyValueMap.hpp>
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    PropertyValueMap::PropertyValueMap(std::initializer_list<value_type> init)
+    {
+        rebuildBuckets(init.size() * 2);
+        for (const auto& pair : init)
+            (*this)[pair.first] = pair.second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyValueMap::PropertyValueMap(const std::map<std::string, ObjectConverter>& properties)
+    {
+        rebuildBuckets(properties.size() * 2);
+        for (const auto& pair : properties)
+            (*this)[pair.first] = pair.second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyValueMap::iterator PropertyValueMap::find(PropertyId property)
+    {
+        return m_entries.begin() + findIndex(property);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyValueMap::const_iterator PropertyValueMap::find(PropertyId property) const
+    {
+        return m_entries.begin() + findIndex(property);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyValueMap::iterator PropertyValueMap::find(const std::string& property)
+    {
+        return find(PropertyId{property});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyValueMap::const_iterator PropertyValueMap::find(const std::string& property) const
+    {
+        return find(PropertyId{property});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter& PropertyValueMap::operator[](PropertyId property)
+    {
+        const std::size_t index = findIndex(property);
+        if (index < m_entries.size())
+            return m_entries[index].second;
+
+        return insert(std::string(property.getName(), property.getLength()), property.getHash());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter& PropertyValueMap::operator[](const std::string& property)
+    {
+        return (*this)[PropertyId{property}];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t PropertyValueMap::count(PropertyId property) const
+    {
+        return (findIndex(property) < m_entries.size()) ? 1 : 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t PropertyValueMap::count(const std::string& property) const
+    {
+        return count(PropertyId{property});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t PropertyValueMap::erase(PropertyId property)
+    {
+        const std::size_t index = findIndex(property);
+        if (index >= m_entries.size())
+            return 0;
+
+        // Erasing is rare, so we just remove the entry and rebuild the table instead of shifting the probe sequences
+        m_entries.erase(m_entries.begin() + index);
+        m_entryHashes.erase(m_entryHashes.begin() + index);
+        rebuildBuckets(m_buckets.size());
+        return 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t PropertyValueMap::erase(const std::string& property)
+    {
+        return erase(PropertyId{property});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PropertyValueMap::clear()
+    {
+        m_entries.clear();
+        m_entryHashes.clear();
+        m_buckets.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t PropertyValueMap::findIndex(PropertyId property) const
+    {
+        if (m_buckets.empty())
+            return m_entries.size();
+
+        const std::size_t mask = m_buckets.size() - 1;
+        for (std::size_t i = property.getHash() & mask; ; i = (i + 1) & mask)
+        {
+            const std::uint32_t slot = m_buckets[i];
+            if (slot == 0)
+                return m_entries.size();
+
+            if ((m_entryHashes[slot - 1] == property.getHash()) && property.matches(m_entries[slot - 1].first))
+                return slot - 1;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter& PropertyValueMap::insert(std::string&& name, std::uint32_t hash)
+    {
+        // Keep the load factor below 50% so that probe sequences stay short
+        if ((m_entries.size() + 1) * 2 > m_buckets.size())
+            rebuildBuckets(std::max<std::size_t>(16, m_buckets.size() * 2));
+
+        m_entries.emplace_back(std::move(name), ObjectConverter{});
+        m_entryHashes.push_back(hash);
+
+        const std::size_t mask = m_buckets.size() - 1;
+        std::size_t i = hash & mask;
+        while (m_buckets[i] != 0)
+            i = (i + 1) & mask;
+
+        m_buckets[i] = static_cast<std::uint32_t>(m_entries.size());
+        return m_entries.back().second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PropertyValueMap::rebuildBuckets(std::size_t bucketCount)
+    {
+        // The bucket count has to be a power of two
+        std::size_t powerOfTwo = 16;
+        while (powerOfTwo < bucketCount)
+            powerOfTwo *= 2;
+
+        m_buckets.assign(powerOfTwo, 0);
+
+        const std::size_t mask = m_buckets.size() - 1;
+        for (std::size_t entry = 0; entry < m_entryHashes.size(); ++entry)
+        {
+            std::size_t i = m_entryHashes[entry] & mask;
+            while (m_buckets[i] != 0)
+                i = (i + 1) & mask;
+
+            m_buckets[i] = static_cast<std::uint32_t>(entry + 1);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
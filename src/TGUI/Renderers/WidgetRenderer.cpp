@@ -38,7 +38,8 @@ namespace tgui
 
     void WidgetRenderer::setOpacity(float opacity)
     {
-        setProperty("opacity", ObjectConverter{std::max(0.f, std::min(1.f, opacity))});
+        TGUI_PROPERTY_ID(property, Opacity);
+        setProperty(property, ObjectConverter{std::max(0.f, std::min(1.f, opacity))});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -47,24 +48,27 @@ namespace tgui
 
     void WidgetRenderer::setOpacityDisabled(float opacity)
     {
+        TGUI_PROPERTY_ID(property, OpacityDisabled);
         if (opacity != -1.f)
-            setProperty("opacitydisabled", ObjectConverter{std::max(0.f, std::min(1.f, opacity))});
+            setProperty(property, ObjectConverter{std::max(0.f, std::min(1.f, opacity))});
         else
-            setProperty("opacitydisabled", ObjectConverter{-1.f});
+            setProperty(property, ObjectConverter{-1.f});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void WidgetRenderer::setFont(Font font)
     {
-        setProperty("font", font);
+        TGUI_PROPERTY_ID(property, Font);
+        setProperty(property, font);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font WidgetRenderer::getFont() const
     {
-        auto it = m_data->propertyValuePairs.find("font");
+        TGUI_PROPERTY_ID(property, Font);
+        const auto it = m_data->propertyValuePairs.find(property);
         if (it != m_data->propertyValuePairs.end())
             return it->second.getFont();
         else
@@ -75,15 +79,24 @@ namespace tgui
 
     void WidgetRenderer::setProperty(const std::string& property, ObjectConverter&& value)
     {
-        std::string lowercaseProperty = toLower(property);
+        const std::string lowercaseProperty = toLower(property);
+        setProperty(PropertyId{lowercaseProperty}, std::move(value));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetRenderer::setProperty(PropertyId property, ObjectConverter&& value)
+    {
+        ObjectConverter& storedValue = m_data->propertyValuePairs[property];
+        if (storedValue == value)
+            return;
 
-        if (m_data->propertyValuePairs[lowercaseProperty] != value)
-        {
-            m_data->propertyValuePairs[lowercaseProperty] = value;
+        storedValue = std::move(value);
 
-            for (const auto& observer : m_data->observers)
-                observer.second(lowercaseProperty);
-        }
+        // The observers receive the stored key, the id doesn't necessarily refer to a lowercase name
+        const std::string& name = m_data->propertyValuePairs.find(property)->first;
+        for (const auto& observer : m_data->observers)
+            observer.second(name);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -99,7 +112,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const std::map<std::string, ObjectConverter>& WidgetRenderer::getPropertyValuePairs() const
+    const PropertyValueMap& WidgetRenderer::getPropertyValuePairs() const
     {
         return m_data->propertyValuePairs;
     }
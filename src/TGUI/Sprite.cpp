@@ -153,7 +153,7 @@ namespace tgui
 
     bool Sprite::isTransparentPixel(Vector2f pos) const
     {
-        if (!isSet() || !m_texture.getData()->image || (m_size.x == 0) || (m_size.y == 0))
+        if (!isSet() || !m_texture.getData()->alphaMask || (m_size.x == 0) || (m_size.y == 0))
             return true;
 
         if (getRotation() != 0)
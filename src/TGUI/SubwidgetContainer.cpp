@@ -34,6 +34,65 @@ namespace tgui
     SubwidgetContainer::SubwidgetContainer()
     {
         m_draggableWidget = true;
+
+        // Widgets in the internal container aren't part of the gui, their updates and mouse release listeners go through us
+        m_container->m_ownerWidget = this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    SubwidgetContainer::SubwidgetContainer(const SubwidgetContainer& other) :
+        Widget     {other},
+        m_container{other.m_container}
+    {
+        m_container->m_ownerWidget = this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    SubwidgetContainer::SubwidgetContainer(SubwidgetContainer&& other) :
+        Widget     {std::move(other)},
+        m_container{std::move(other.m_container)}
+    {
+        m_container->m_ownerWidget = this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    SubwidgetContainer& SubwidgetContainer::operator= (const SubwidgetContainer& other)
+    {
+        if (this != &other)
+        {
+            Widget::operator=(other);
+            m_container = other.m_container;
+            m_container->m_ownerWidget = this;
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    SubwidgetContainer& SubwidgetContainer::operator= (SubwidgetContainer&& other)
+    {
+        if (this != &other)
+        {
+            Widget::operator=(std::move(other));
+            m_container = std::move(other.m_container);
+            m_container->m_ownerWidget = this;
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SubwidgetContainer::setParent(Container* parent)
+    {
+        Widget::setParent(parent);
+
+        if (parent && !m_container->m_mouseReleaseListeners.empty())
+            parent->addMouseReleaseListener(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -157,6 +216,7 @@ namespace tgui
 
     void SubwidgetContainer::update(sf::Time elapsedTime)
     {
+        // Widgets that need another update schedule it again while being updated, which schedules an update for us
         m_container->update(elapsedTime);
     }
 
@@ -300,15 +300,12 @@ namespace tgui
 
     bool Texture::isTransparentPixel(sf::Vector2u pixel) const
     {
-        if (!m_data || !m_data->image)
+        if (!m_data || !m_data->alphaMask)
             return false;
 
         assert(pixel.x < m_data->texture.getSize().x && pixel.y < m_data->texture.getSize().y);
 
-        if (m_data->image->getPixel(pixel.x + m_data->rect.left, pixel.y + m_data->rect.top).a == 0)
-            return true;
-        else
-            return false;
+        return m_data->alphaMask->isTransparentPixel(pixel.x + m_data->rect.left, pixel.y + m_data->rect.top);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -349,6 +346,9 @@ namespace tgui
     {
         assert(func != nullptr);
         m_imageLoader = func;
+
+        // An image decoded by the old function must not be used when a texture is loaded with the new function
+        TextureManager::releaseDecodedImage();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,80 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/TextureData.hpp>
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    AlphaMask::AlphaMask(const sf::Image& image) :
+        m_size       {image.getSize()},
+        m_wordsPerRow{(m_size.x + 63) / 64},
+        m_bits       (m_wordsPerRow * m_size.y, 0)
+    {
+        const sf::Uint8* pixels = image.getPixelsPtr();
+        if (!pixels)
+            return;
+
+        // The inner loop has no branches and no dependencies between pixels, so that the compiler can vectorize it
+        for (unsigned int y = 0; y < m_size.y; ++y)
+        {
+            const sf::Uint8* alpha = pixels + (static_cast<std::size_t>(y) * m_size.x * 4) + 3;
+            std::uint64_t* row = &m_bits[y * m_wordsPerRow];
+            for (std::size_t word = 0; word < m_wordsPerRow; ++word)
+            {
+                const unsigned int firstX = static_cast<unsigned int>(word * 64);
+                const unsigned int count = std::min(64u, m_size.x - firstX);
+
+                std::uint64_t bits = 0;
+                for (unsigned int i = 0; i < count; ++i)
+                    bits |= static_cast<std::uint64_t>(alpha[(firstX + i) * 4] != 0) << i;
+
+                row[word] = bits;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Vector2u AlphaMask::getSize() const
+    {
+        return m_size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool AlphaMask::isTransparentPixel(unsigned int x, unsigned int y) const
+    {
+        return ((m_bits[(y * m_wordsPerRow) + (x / 64)] >> (x % 64)) & 1) == 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
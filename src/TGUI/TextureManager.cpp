@@ -32,11 +32,32 @@
 namespace tgui
 {
     std::map<sf::String, std::list<TextureDataHolder>> TextureManager::m_imageMap;
+    sf::String TextureManager::m_decodedImageFilename;
+    std::shared_ptr<sf::Image> TextureManager::m_decodedImage;
+    unsigned int TextureManager::m_loadBatchCount = 0;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextureManager::LoadBatch::LoadBatch()
+    {
+        ++m_loadBatchCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextureManager::LoadBatch::~LoadBatch()
+    {
+        if (--m_loadBatchCount == 0)
+            releaseDecodedImage();
+    }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::shared_ptr<TextureData> TextureManager::getTexture(Texture& texture, const sf::String& filename, const sf::IntRect& partRect)
     {
+        // The decoded image is released when returning, unless the texture is loaded as part of a bigger batch
+        const LoadBatch batch;
+
         // Look if we already had this image
         auto imageIt = m_imageMap.find(filename);
         if (imageIt != m_imageMap.end())
@@ -85,22 +106,34 @@ namespace tgui
         }
         else // Not an svg
         {
-            // Share the image if it was loaded before
+            // Share the alpha mask if the image was loaded before
             if (imageIt->second.size() >= 2)
-                data->image = imageIt->second.begin()->data->image;
+                data->alphaMask = imageIt->second.begin()->data->alphaMask;
 
-            if (!data->image)
-                data->image = texture.getImageLoader()(filename);
-            if (data->image)
+            // The image is only decoded again when other images were loaded in between
+            std::shared_ptr<sf::Image> image;
+            if (m_decodedImage && (m_decodedImageFilename == filename))
+                image = m_decodedImage;
+            else
             {
+                image = texture.getImageLoader()(filename);
+                m_decodedImage = image;
+                m_decodedImageFilename = filename;
+            }
+
+            if (image)
+            {
+                if (!data->alphaMask)
+                    data->alphaMask = std::make_shared<AlphaMask>(*image);
+
                 // Create a texture from the image
                 bool loadFromImageSuccess;
                 if (partRect == sf::IntRect{})
-                    loadFromImageSuccess = data->texture.loadFromImage(*data->image);
+                    loadFromImageSuccess = data->texture.loadFromImage(*image);
                 else
                 {
-                    if ((partRect.left < static_cast<int>(data->image->getSize().x)) && (partRect.top < static_cast<int>(data->image->getSize().y)))
-                        loadFromImageSuccess = data->texture.loadFromImage(*data->image, partRect);
+                    if ((partRect.left < static_cast<int>(image->getSize().x)) && (partRect.top < static_cast<int>(image->getSize().y)))
+                        loadFromImageSuccess = data->texture.loadFromImage(*image, partRect);
                     else
                         loadFromImageSuccess = false;
                 }
@@ -158,7 +191,12 @@ namespace tgui
                     {
                         imageIt->second.erase(dataIt);
                         if (imageIt->second.empty())
+                        {
+                            if (m_decodedImageFilename == imageIt->first)
+                                releaseDecodedImage();
+
                             m_imageMap.erase(imageIt);
+                        }
                     }
 
                     return;
@@ -170,6 +208,14 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::releaseDecodedImage()
+    {
+        m_decodedImage = nullptr;
+        m_decodedImageFilename.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
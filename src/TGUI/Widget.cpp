@@ -40,24 +40,23 @@ namespace tgui
 
     namespace
     {
-        void finishExistingConflictingAnimations(std::vector<std::shared_ptr<priv::Animation>>& animations, ShowAnimationType type)
+        void finishExistingConflictingAnimations(AnimationScheduler& scheduler, const Widget* widget, ShowAnimationType type)
         {
             // Only one animation of each type can be played at the same type. If e.g. a fade animation was already in progress
             // when starting a new one, the old animation is finished immediately.
             // Different types of animations (e.g. fading and moving) can occur at the same time.
-            auto animIt = animations.begin();
-            while (animIt != animations.end())
+            if (type == ShowAnimationType::Fade)
+                scheduler.finishAnimations(widget, AnimationScheduler::Property::Opacity);
+            else
             {
-                auto& animation = *animIt;
-                if (((type == ShowAnimationType::Fade) && (animation->getType() == priv::Animation::Type::Fade))
-                 || ((type == ShowAnimationType::Scale) && (animation->getType() == priv::Animation::Type::Resize))
-                 || ((type != ShowAnimationType::Fade) && (animation->getType() == priv::Animation::Type::Move)))
+                // The position is finished first, the callback of a scale animation restores the position when resizing finishes
+                scheduler.finishAnimations(widget, AnimationScheduler::Property::Position);
+                scheduler.finishAnimations(widget, AnimationScheduler::Property::RenderOffset);
+                if (type == ShowAnimationType::Scale)
                 {
-                    animation->finish();
-                    animIt = animations.erase(animIt);
+                    scheduler.finishAnimations(widget, AnimationScheduler::Property::Size);
+                    scheduler.finishAnimations(widget, AnimationScheduler::Property::RenderScale);
                 }
-                else
-                    ++animIt;
             }
         }
 
@@ -110,6 +109,17 @@ namespace tgui
 
             return {x, y};
         }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        static Layout2d parseLayout(const DataIO::ValueNode& node)
+        {
+            // A binary widget file may already contain the value split in its x and y layouts
+            if (node.decoded && (node.decoded->type == DataIO::DecodedValue::Type::Layout))
+                return {node.decoded->strings[0], node.decoded->strings[1]};
+            else
+                return parseLayout(node.value);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -128,10 +138,10 @@ namespace tgui
             m_renderer->unsubscribe(this);
 
         for (auto& layout : m_boundPositionLayouts)
-            layout->unbindWidget();
+            layout->unbindWidget(this);
 
         for (auto& layout : m_boundSizeLayouts)
-            layout->unbindWidget();
+            layout->unbindWidget(this);
 
         SignalManager::getSignalManager()->remove(this);
     }
@@ -153,9 +163,9 @@ namespace tgui
         m_parent                       {nullptr},
         m_draggableWidget              {other.m_draggableWidget},
         m_containerWidget              {other.m_containerWidget},
+        m_notifiedOfAllMouseReleases   {other.m_notifiedOfAllMouseReleases},
         m_toolTip                      {other.m_toolTip ? other.m_toolTip->clone() : nullptr},
         m_renderer                     {other.m_renderer},
-        m_showAnimations               {other.m_showAnimations},
         m_fontCached                   {other.m_fontCached},
         m_opacityCached                {other.m_opacityCached}
     {
@@ -165,6 +175,9 @@ namespace tgui
         m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
 
         m_renderer->subscribe(this, m_rendererChangedCallback);
+
+        // The copy will need to be updated by the gui to which it gets added when the original widget needed updates
+        m_updateRequestedWithoutGui = other.m_updateRequestedWithoutGui || other.m_updateScheduled;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -194,9 +207,9 @@ namespace tgui
         m_animationTimeElapsed         {std::move(other.m_animationTimeElapsed)},
         m_draggableWidget              {std::move(other.m_draggableWidget)},
         m_containerWidget              {std::move(other.m_containerWidget)},
+        m_notifiedOfAllMouseReleases   {std::move(other.m_notifiedOfAllMouseReleases)},
         m_toolTip                      {std::move(other.m_toolTip)},
         m_renderer                     {other.m_renderer},
-        m_showAnimations               {std::move(other.m_showAnimations)},
         m_fontCached                   {std::move(other.m_fontCached)},
         m_opacityCached                {std::move(other.m_opacityCached)}
     {
@@ -247,9 +260,10 @@ namespace tgui
             m_animationTimeElapsed = {};
             m_draggableWidget      = other.m_draggableWidget;
             m_containerWidget      = other.m_containerWidget;
+            m_notifiedOfAllMouseReleases = other.m_notifiedOfAllMouseReleases;
             m_toolTip              = other.m_toolTip ? other.m_toolTip->clone() : nullptr;
             m_renderer             = other.m_renderer;
-            m_showAnimations       = {};
+            m_animationScheduler   = nullptr;
             m_fontCached           = other.m_fontCached;
             m_opacityCached        = other.m_opacityCached;
 
@@ -260,6 +274,9 @@ namespace tgui
 
             m_renderer->subscribe(this, m_rendererChangedCallback);
 
+            if (other.m_updateRequestedWithoutGui || other.m_updateScheduled)
+                scheduleUpdate(sf::Time::Zero);
+
             if (m_parent)
             {
                 SignalManager::getSignalManager()->remove(this);
@@ -303,9 +320,10 @@ namespace tgui
             m_animationTimeElapsed = std::move(other.m_animationTimeElapsed);
             m_draggableWidget      = std::move(other.m_draggableWidget);
             m_containerWidget      = std::move(other.m_containerWidget);
+            m_notifiedOfAllMouseReleases = std::move(other.m_notifiedOfAllMouseReleases);
             m_toolTip              = std::move(other.m_toolTip);
             m_renderer             = std::move(other.m_renderer);
-            m_showAnimations       = std::move(other.m_showAnimations);
+            m_animationScheduler   = nullptr;
             m_fontCached           = std::move(other.m_fontCached);
             m_opacityCached        = std::move(other.m_opacityCached);
 
@@ -343,40 +361,26 @@ namespace tgui
         m_renderer->subscribe(this, m_rendererChangedCallback);
         rendererData->shared = true;
 
-        // Tell the widget about all the updated properties, both new ones and old ones that were now reset to their default value
-        auto oldIt = oldData->propertyValuePairs.begin();
-        auto newIt = rendererData->propertyValuePairs.begin();
-        while (oldIt != oldData->propertyValuePairs.end() && newIt != rendererData->propertyValuePairs.end())
-        {
-            if (oldIt->first < newIt->first)
-            {
-                // Update values that no longer exist in the new renderer and are now reset to the default value
-                rendererChanged(oldIt->first);
-                ++oldIt;
-            }
-            else
-            {
-                // Update changed and new properties
-                rendererChanged(newIt->first);
-
-                if (newIt->first < oldIt->first)
-                    ++newIt;
-                else
-                {
-                    ++oldIt;
-                    ++newIt;
-                }
-            }
-        }
-        while (oldIt != oldData->propertyValuePairs.end())
+        // Tell the widget about the properties that differ between the old and new renderer, both new ones and old ones that
+        // were now reset to their default value. Properties with the same value in both renderers are already up-to-date.
+        // The maps are accessed by index because rendererChanged may add default values to them while we are looping.
+        const std::size_t oldPropertyCount = oldData->propertyValuePairs.size();
+        for (std::size_t i = 0; i < oldPropertyCount; ++i)
         {
-            rendererChanged(oldIt->first);
-            ++oldIt;
+            // Update values that no longer exist in the new renderer and are now reset to the default value
+            const std::string& property = (oldData->propertyValuePairs.begin() + i)->first;
+            if (rendererData->propertyValuePairs.find(property) == rendererData->propertyValuePairs.end())
+                rendererChanged(property);
         }
-        while (newIt != rendererData->propertyValuePairs.end())
+
+        // Update changed and new properties
+        const std::size_t newPropertyCount = rendererData->propertyValuePairs.size();
+        for (std::size_t i = 0; i < newPropertyCount; ++i)
         {
-            rendererChanged(newIt->first);
-            ++newIt;
+            const auto& pair = *(rendererData->propertyValuePairs.begin() + i);
+            const auto oldIt = oldData->propertyValuePairs.find(pair.first);
+            if ((oldIt == oldData->propertyValuePairs.end()) || (oldIt->second != pair.second))
+                rendererChanged(pair.first);
         }
     }
 
@@ -439,8 +443,10 @@ namespace tgui
             m_prevPosition = getPosition();
             onPositionChange.emit(this, getPosition());
 
-            for (auto& layout : m_boundPositionLayouts)
-                layout->recalculateValue();
+            if (m_parent)
+                m_parent->childWidgetBoundsChanged(this);
+
+            recalculateBoundLayouts(m_boundPositionLayouts);
         }
     }
 
@@ -457,8 +463,10 @@ namespace tgui
             m_prevSize = getSize();
             onSizeChange.emit(this, getSize());
 
-            for (auto& layout : m_boundSizeLayouts)
-                layout->recalculateValue();
+            if (m_parent)
+                m_parent->childWidgetBoundsChanged(this);
+
+            recalculateBoundLayouts(m_boundSizeLayouts);
         }
     }
 
@@ -499,7 +507,12 @@ namespace tgui
         //const Vector2f startPosition = getPosition();
         //const Vector2f startSize = getSize();
 
-        finishExistingConflictingAnimations(m_showAnimations, type);
+        auto& scheduler = getAnimationScheduler();
+        finishExistingConflictingAnimations(scheduler, this, type);
+
+        // Animations that were started before the widget was added to a gui are still played by the widget itself
+        if (m_animationScheduler && (m_animationScheduler.get() != &scheduler))
+            finishExistingConflictingAnimations(*m_animationScheduler, this, type);
 
         switch (type)
         {
@@ -516,33 +529,39 @@ namespace tgui
                 else // If fading was already in progress then adapt the duration to finish the animation sooner
                     duration *= (startOpacity / endOpacity);
 
-                m_showAnimations.push_back(std::make_shared<priv::FadeAnimation>(shared_from_this(), animStartOpacity, endOpacity, duration,
-                                                                                 TGUI_LAMBDA_CAPTURE_EQ_THIS{onAnimationFinished.emit(this, type, true); }));
+                scheduler.animateOpacity(shared_from_this(), animStartOpacity, endOpacity, duration, EasingType::Linear,
+                    TGUI_LAMBDA_CAPTURE_EQ_THIS{onAnimationFinished.emit(this, type, true); });
                 break;
             }
             case ShowAnimationType::Scale:
             {
-                m_showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), getPosition() + (getSize() / 2.f), getPosition(), duration));
-                m_showAnimations.push_back(std::make_shared<priv::ResizeAnimation>(shared_from_this(), Vector2f{0, 0}, getSize(), duration,
-                                                                                   TGUI_LAMBDA_CAPTURE_EQ_THIS{onAnimationFinished.emit(this, type, true); }));
+                if (getTransformOnlyShowAnimations())
+                {
+                    m_renderScale = {0, 0};
+                    scheduler.animateRenderScale(shared_from_this(), Vector2f{0, 0}, Vector2f{1, 1}, duration, EasingType::Linear,
+                        TGUI_LAMBDA_CAPTURE_EQ_THIS{onAnimationFinished.emit(this, type, true); });
+                    break;
+                }
+
+                scheduler.animatePosition(shared_from_this(), getPosition() + (getSize() / 2.f), getPosition(), duration);
+                scheduler.animateSize(shared_from_this(), Vector2f{0, 0}, getSize(), duration, EasingType::Linear,
+                    TGUI_LAMBDA_CAPTURE_EQ_THIS{onAnimationFinished.emit(this, type, true); });
                 setPosition(getPosition() + (getSize() / 2.f));
                 setSize(0, 0);
                 break;
             }
             case ShowAnimationType::SlideFromLeft:
             {
-                m_showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{-getFullSize().x, getPosition().y}, getPosition(), duration,
-                                                                                 TGUI_LAMBDA_CAPTURE_EQ_THIS{onAnimationFinished.emit(this, type, true); }));
-                setPosition({-getFullSize().x, getPosition().y});
+                animateSlide(scheduler, {-getFullSize().x, getPosition().y}, getPosition(), duration,
+                    TGUI_LAMBDA_CAPTURE_EQ_THIS{onAnimationFinished.emit(this, type, true); });
                 break;
             }
             case ShowAnimationType::SlideFromRight:
             {
                 if (getParent())
                 {
-                    m_showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getParent()->getSize().x + getWidgetOffset().x, getPosition().y}, getPosition(), duration,
-                                                                                     TGUI_LAMBDA_CAPTURE_EQ_THIS{onAnimationFinished.emit(this, type, true); }));
-                    setPosition({getParent()->getSize().x + getWidgetOffset().x, getPosition().y});
+                    animateSlide(scheduler, {getParent()->getSize().x + getWidgetOffset().x, getPosition().y}, getPosition(), duration,
+                        TGUI_LAMBDA_CAPTURE_EQ_THIS{onAnimationFinished.emit(this, type, true); });
                 }
                 else
                 {
@@ -553,18 +572,16 @@ namespace tgui
             }
             case ShowAnimationType::SlideFromTop:
             {
-                m_showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getPosition().x, -getFullSize().y}, getPosition(), duration,
-                                                                                 TGUI_LAMBDA_CAPTURE_EQ_THIS{onAnimationFinished.emit(this, type, true); }));
-                setPosition({getPosition().x, -getFullSize().y});
+                animateSlide(scheduler, {getPosition().x, -getFullSize().y}, getPosition(), duration,
+                    TGUI_LAMBDA_CAPTURE_EQ_THIS{onAnimationFinished.emit(this, type, true); });
                 break;
             }
             case ShowAnimationType::SlideFromBottom:
             {
                 if (getParent())
                 {
-                    m_showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getPosition().x, getParent()->getSize().y + getWidgetOffset().y}, getPosition(), duration,
-                                                                                     TGUI_LAMBDA_CAPTURE_EQ_THIS{onAnimationFinished.emit(this, type, true); }));
-                    setPosition({getPosition().x, getParent()->getSize().y + getWidgetOffset().y});
+                    animateSlide(scheduler, {getPosition().x, getParent()->getSize().y + getWidgetOffset().y}, getPosition(), duration,
+                        TGUI_LAMBDA_CAPTURE_EQ_THIS{onAnimationFinished.emit(this, type, true); });
                 }
                 else
                 {
@@ -587,7 +604,12 @@ namespace tgui
         //const Vector2f startPosition = getPosition();
         //const Vector2f startSize = getSize();
 
-        finishExistingConflictingAnimations(m_showAnimations, type);
+        auto& scheduler = getAnimationScheduler();
+        finishExistingConflictingAnimations(scheduler, this, type);
+
+        // Animations that were started before the widget was added to a gui are still played by the widget itself
+        if (m_animationScheduler && (m_animationScheduler.get() != &scheduler))
+            finishExistingConflictingAnimations(*m_animationScheduler, this, type);
 
         const auto position = getPosition();
 
@@ -601,24 +623,31 @@ namespace tgui
                 if (startOpacity != endOpacity)
                     duration *= (startOpacity / endOpacity);
 
-                m_showAnimations.push_back(std::make_shared<priv::FadeAnimation>(shared_from_this(), startOpacity, 0.f, duration,
-                    TGUI_LAMBDA_CAPTURE_EQ_THIS{ setVisible(false); setInheritedOpacity(endOpacity); onAnimationFinished.emit(this, type, false); }));
+                scheduler.animateOpacity(shared_from_this(), startOpacity, 0.f, duration, EasingType::Linear,
+                    TGUI_LAMBDA_CAPTURE_EQ_THIS{ setVisible(false); setInheritedOpacity(endOpacity); onAnimationFinished.emit(this, type, false); });
                 break;
             }
             case ShowAnimationType::Scale:
             {
+                if (getTransformOnlyShowAnimations())
+                {
+                    scheduler.animateRenderScale(shared_from_this(), Vector2f{1, 1}, Vector2f{0, 0}, duration, EasingType::Linear,
+                        TGUI_LAMBDA_CAPTURE_EQ_THIS{ setVisible(false); m_renderScale = {1, 1}; onAnimationFinished.emit(this, type, false); });
+                    break;
+                }
+
                 const auto size = getSize();
-                m_showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), position, position + (size / 2.f), duration));
-                m_showAnimations.push_back(std::make_shared<priv::ResizeAnimation>(shared_from_this(), size, Vector2f{0, 0}, duration,
-                    TGUI_LAMBDA_CAPTURE_EQ_THIS{ setVisible(false); setPosition(position); setSize(size); onAnimationFinished.emit(this, type, false); }));
+                scheduler.animatePosition(shared_from_this(), position, position + (size / 2.f), duration);
+                scheduler.animateSize(shared_from_this(), size, Vector2f{0, 0}, duration, EasingType::Linear,
+                    TGUI_LAMBDA_CAPTURE_EQ_THIS{ setVisible(false); setPosition(position); setSize(size); onAnimationFinished.emit(this, type, false); });
                 break;
             }
             case ShowAnimationType::SlideToRight:
             {
                 if (getParent())
                 {
-                    m_showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{getParent()->getSize().x + getWidgetOffset().x, position.y}, duration,
-                        TGUI_LAMBDA_CAPTURE_EQ_THIS{ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); }));
+                    animateSlide(scheduler, position, {getParent()->getSize().x + getWidgetOffset().x, position.y}, duration,
+                        TGUI_LAMBDA_CAPTURE_EQ_THIS{ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); });
                 }
                 else
                 {
@@ -629,16 +658,16 @@ namespace tgui
             }
             case ShowAnimationType::SlideToLeft:
             {
-                m_showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{-getFullSize().x, position.y}, duration,
-                    TGUI_LAMBDA_CAPTURE_EQ_THIS{ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); }));
+                animateSlide(scheduler, position, {-getFullSize().x, position.y}, duration,
+                    TGUI_LAMBDA_CAPTURE_EQ_THIS{ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); });
                 break;
             }
             case ShowAnimationType::SlideToBottom:
             {
                 if (getParent())
                 {
-                    m_showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{position.x, getParent()->getSize().y + getWidgetOffset().y}, duration,
-                        TGUI_LAMBDA_CAPTURE_EQ_THIS{ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); }));
+                    animateSlide(scheduler, position, {position.x, getParent()->getSize().y + getWidgetOffset().y}, duration,
+                        TGUI_LAMBDA_CAPTURE_EQ_THIS{ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); });
                 }
                 else
                 {
@@ -649,8 +678,8 @@ namespace tgui
             }
             case ShowAnimationType::SlideToTop:
             {
-                m_showAnimations.push_back(std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{position.x, -getFullSize().y}, duration,
-                    TGUI_LAMBDA_CAPTURE_EQ_THIS{ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); }));
+                animateSlide(scheduler, position, {position.x, -getFullSize().y}, duration,
+                    TGUI_LAMBDA_CAPTURE_EQ_THIS{ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); });
                 break;
             }
         }
@@ -658,6 +687,30 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::moveWithAnimation(Vector2f position, sf::Time duration, EasingType easing)
+    {
+        auto& scheduler = getAnimationScheduler();
+        scheduler.finishAnimations(this, AnimationScheduler::Property::Position);
+        if (m_animationScheduler && (m_animationScheduler.get() != &scheduler))
+            m_animationScheduler->finishAnimations(this, AnimationScheduler::Property::Position);
+
+        scheduler.animatePosition(shared_from_this(), getPosition(), position, duration, easing);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::resizeWithAnimation(Vector2f size, sf::Time duration, EasingType easing)
+    {
+        auto& scheduler = getAnimationScheduler();
+        scheduler.finishAnimations(this, AnimationScheduler::Property::Size);
+        if (m_animationScheduler && (m_animationScheduler.get() != &scheduler))
+            m_animationScheduler->finishAnimations(this, AnimationScheduler::Property::Size);
+
+        scheduler.animateSize(shared_from_this(), getSize(), size, duration, easing);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::setVisible(bool visible)
     {
         m_visible = visible;
@@ -722,7 +775,15 @@ namespace tgui
 
     bool Widget::isAnimationPlaying() const
     {
-        return !m_showAnimations.empty();
+        if (m_animationScheduler && m_animationScheduler->hasAnimations(this))
+            return true;
+
+        const Widget* root = this;
+        while (root->getParent())
+            root = root->getParent();
+
+        const auto* guiContainer = dynamic_cast<const GuiContainer*>(root);
+        return guiContainer && guiContainer->getAnimationScheduler().hasAnimations(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -805,6 +866,9 @@ namespace tgui
     {
         if (m_name != name)
         {
+            if (m_parent)
+                m_parent->childWidgetNameChanged(this, m_name, name);
+
             m_name = name;
             if (m_parent)
             {
@@ -851,6 +915,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Widget::canBeHitOutsideBounds() const
+    {
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::setParent(Container* parent)
     {
         if (!parent)
@@ -869,6 +940,26 @@ namespace tgui
         m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
         m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
         m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
+
+        if (!parent)
+            return;
+
+        // The new gui has to call update on the widgets that requested it before they were part of the gui
+        Widget* root = parent;
+        while (root->getParent())
+            root = root->getParent();
+
+        if (auto* guiContainer = dynamic_cast<GuiContainer*>(root))
+            guiContainer->scheduleRequestedUpdates(*this);
+        else if (root->isContainer() && static_cast<Container*>(root)->m_ownerWidget)
+        {
+            // The children of a container may have requested updates as well, they are only found by updating them
+            if (m_updateRequestedWithoutGui || isContainer())
+            {
+                m_updateRequestedWithoutGui = false;
+                static_cast<Container*>(root)->m_ownerWidget->scheduleUpdate(sf::Time::Zero);
+            }
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -877,12 +968,11 @@ namespace tgui
     {
         m_animationTimeElapsed += elapsedTime;
 
-        for (unsigned int i = 0; i < m_showAnimations.size();)
+        if (m_animationScheduler && (m_animationScheduler->getAnimationCount() > 0))
         {
-            if (m_showAnimations[i]->update(elapsedTime))
-                m_showAnimations.erase(m_showAnimations.begin() + i);
-            else
-                i++;
+            m_animationScheduler->update(elapsedTime);
+            if (m_animationScheduler->getAnimationCount() > 0)
+                scheduleUpdate(sf::Time::Zero);
         }
     }
 
@@ -1051,28 +1141,37 @@ namespace tgui
 
     void Widget::rendererChanged(const std::string& property)
     {
-        if ((property == "opacity") || (property == "opacitydisabled"))
+        switch (propertyHash(property))
         {
-            if (!m_enabled && (getSharedRenderer()->getOpacityDisabled() != -1))
-                m_opacityCached = getSharedRenderer()->getOpacityDisabled() * m_inheritedOpacity;
-            else
-                m_opacityCached = getSharedRenderer()->getOpacity() * m_inheritedOpacity;
-        }
-        else if (property == "font")
-        {
-            if (getSharedRenderer()->getFont())
-                m_fontCached = getSharedRenderer()->getFont();
-            else if (m_inheritedFont)
-                m_fontCached = m_inheritedFont;
-            else
-                m_fontCached = getGlobalFont();
-        }
-        else if (property == "transparenttexture")
-        {
-            m_transparentTextureCached = getSharedRenderer()->getTransparentTexture();
+            TGUI_PROPERTY_CASE(property, "opacity", "opacitydisabled")
+            {
+                if (!m_enabled && (getSharedRenderer()->getOpacityDisabled() != -1))
+                    m_opacityCached = getSharedRenderer()->getOpacityDisabled() * m_inheritedOpacity;
+                else
+                    m_opacityCached = getSharedRenderer()->getOpacity() * m_inheritedOpacity;
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "font")
+            {
+                if (getSharedRenderer()->getFont())
+                    m_fontCached = getSharedRenderer()->getFont();
+                else if (m_inheritedFont)
+                    m_fontCached = m_inheritedFont;
+                else
+                    m_fontCached = getGlobalFont();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "transparenttexture")
+            {
+                m_transparentTextureCached = getSharedRenderer()->getTransparentTexture();
+                return;
+            }
         }
-        else
-            throw Exception{"Could not set property '" + property + "', widget of type '" + getWidgetType() + "' does not has this property."};
+
+        // The property isn't handled by this widget, or an unknown name only shares the hash of a known property
+        throw Exception{"Could not set property '" + property + "', widget of type '" + getWidgetType() + "' does not has this property."};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1169,13 +1268,13 @@ namespace tgui
     void Widget::load(const std::unique_ptr<DataIO::Node>& node, const LoadingRenderersMap& renderers)
     {
         if (node->propertyValuePairs["visible"])
-            setVisible(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["visible"]->value).getBool());
+            setVisible(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["visible"]).getBool());
         if (node->propertyValuePairs["enabled"])
-            setEnabled(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["enabled"]->value).getBool());
+            setEnabled(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["enabled"]).getBool());
         if (node->propertyValuePairs["position"])
-            setPosition(parseLayout(node->propertyValuePairs["position"]->value));
+            setPosition(parseLayout(*node->propertyValuePairs["position"]));
         if (node->propertyValuePairs["size"])
-            setSize(parseLayout(node->propertyValuePairs["size"]->value));
+            setSize(parseLayout(*node->propertyValuePairs["size"]));
         if (node->propertyValuePairs["userdata"])
         {
 #if TGUI_COMPILED_WITH_CPP_VER >= 17
@@ -1263,6 +1362,114 @@ namespace tgui
     void Widget::rendererChangedCallback(const std::string& property)
     {
         rendererChanged(property);
+
+        // Properties such as borders or the title bar height can change the full size of the widget
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::recalculateBoundLayouts(const std::unordered_set<Layout*>& layouts)
+    {
+        if (layouts.empty())
+            return;
+
+        // The gui container at the root of the widget tree decides whether the layouts are updated now or in the next layout pass
+        Widget* root = this;
+        while (root->getParent())
+            root = root->getParent();
+
+        auto* guiContainer = dynamic_cast<GuiContainer*>(root);
+        for (auto& layout : layouts)
+        {
+            if (!guiContainer || !guiContainer->scheduleLayoutUpdate(layout->getConnectedWidget()))
+                layout->recalculateValue();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    AnimationScheduler& Widget::getAnimationScheduler()
+    {
+        // Widgets inside a gui are animated by the gui, so that only the running animations have to be visited each frame
+        Widget* root = this;
+        while (root->getParent())
+            root = root->getParent();
+
+        if (auto* guiContainer = dynamic_cast<GuiContainer*>(root))
+            return guiContainer->getAnimationScheduler();
+
+        if (!m_animationScheduler)
+            m_animationScheduler = std::make_unique<AnimationScheduler>();
+
+        // The animations are played by update, which needs to be called once the widget gets added to a gui
+        scheduleUpdate(sf::Time::Zero);
+        return *m_animationScheduler;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::animateSlide(AnimationScheduler& scheduler, Vector2f start, Vector2f end, sf::Time duration, std::function<void()> finishedCallback)
+    {
+        if (getTransformOnlyShowAnimations())
+        {
+            // The offset is removed again when the animation ends, the callback decides where the widget ends up
+            m_renderOffset = start - getPosition();
+            scheduler.animateRenderOffset(shared_from_this(), start - getPosition(), end - getPosition(), duration, EasingType::Linear,
+                [this,finishedCallback]{
+                    m_renderOffset = {0, 0};
+                    if (finishedCallback)
+                        finishedCallback();
+                });
+        }
+        else
+        {
+            scheduler.animatePosition(shared_from_this(), start, end, duration, EasingType::Linear, std::move(finishedCallback));
+            if (start != getPosition())
+                setPosition(start);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::scheduleUpdate(sf::Time delay)
+    {
+        Widget* root = this;
+        while (root->getParent())
+            root = root->getParent();
+
+        if (auto* guiContainer = dynamic_cast<GuiContainer*>(root))
+            guiContainer->scheduleUpdate(this, delay);
+        else if (root->isContainer() && static_cast<Container*>(root)->m_ownerWidget)
+        {
+            // Widgets inside a SubwidgetContainer are updated by the widget that owns their container
+            static_cast<Container*>(root)->m_ownerWidget->scheduleUpdate(delay);
+        }
+        else
+            m_updateRequestedWithoutGui = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::restartAnimationTime(sf::Time nextUpdate)
+    {
+        m_animationTimeElapsed = {};
+
+        Widget* root = this;
+        while (root->getParent())
+            root = root->getParent();
+
+        // The time that passed before the restart no longer counts when the gui calls update
+        if (auto* guiContainer = dynamic_cast<GuiContainer*>(root))
+        {
+            m_lastUpdateTime = guiContainer->getCurrentTime();
+            guiContainer->scheduleUpdate(this, nextUpdate);
+        }
+        else if (root->isContainer() && static_cast<Container*>(root)->m_ownerWidget)
+            static_cast<Container*>(root)->m_ownerWidget->scheduleUpdate(nextUpdate);
+        else
+            m_updateRequestedWithoutGui = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
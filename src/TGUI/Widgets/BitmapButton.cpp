@@ -128,9 +128,9 @@ namespace tgui
         Button::load(node, renderers);
 
         if (node->propertyValuePairs["image"])
-            setImage(Deserializer::deserialize(ObjectConverter::Type::Texture, node->propertyValuePairs["image"]->value).getTexture());
+            setImage(Deserializer::deserialize(ObjectConverter::Type::Texture, *node->propertyValuePairs["image"]).getTexture());
         if (node->propertyValuePairs["imagescaling"])
-            setImageScaling(Deserializer::deserialize(ObjectConverter::Type::Number, node->propertyValuePairs["imagescaling"]->value).getNumber());
+            setImageScaling(Deserializer::deserialize(ObjectConverter::Type::Number, *node->propertyValuePairs["imagescaling"]).getNumber());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,6 +25,8 @@
 
 #include <TGUI/Widgets/BoxLayout.hpp>
 #include <TGUI/Widgets/ClickableWidget.hpp>
+#include <algorithm>
+#include <limits>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -71,7 +73,7 @@ namespace tgui
     {
         Container::setSize(size);
 
-        updateWidgets();
+        invalidateLayout();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -93,11 +95,45 @@ namespace tgui
             m_widgets.pop_back();
 
             m_widgets.insert(m_widgets.begin() + index, widget);
+            widgetOrderChanged();
         }
         else // Just add the widget to the back
             Group::add(widget, widgetName);
 
-        updateWidgets();
+        invalidateLayout(std::min(index, m_widgets.size() - 1));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BoxLayout::addWidgets(const std::vector<Widget::Ptr>& widgets)
+    {
+        insertWidgets(m_widgets.size(), widgets);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BoxLayout::insertWidgets(std::size_t index, const std::vector<Widget::Ptr>& widgets)
+    {
+        if (widgets.empty())
+            return;
+
+        // Adding a widget that is already in the layout would remove it first, so do that before counting the widgets
+        index = removeWidgetsBeforeInsert(index, widgets);
+
+        const std::size_t oldWidgetCount = m_widgets.size();
+        index = std::min(index, oldWidgetCount);
+
+        for (const auto& widget : widgets)
+            Group::add(widget);
+
+        // Move all new widgets to the right position at once
+        if (index < oldWidgetCount)
+        {
+            std::rotate(m_widgets.begin() + index, m_widgets.begin() + oldWidgetCount, m_widgets.end());
+            widgetOrderChanged();
+        }
+
+        invalidateLayout(index);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -122,7 +158,7 @@ namespace tgui
 
         Group::remove(m_widgets[index]);
 
-        updateWidgets();
+        invalidateLayout(index);
         return true;
     }
 
@@ -140,21 +176,70 @@ namespace tgui
 
     void BoxLayout::rendererChanged(const std::string& property)
     {
-        if (property == "spacebetweenwidgets")
+        switch (propertyHash(property))
         {
-            m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
-            updateWidgets();
+            TGUI_PROPERTY_CASE(property, "spacebetweenwidgets")
+            {
+                m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
+                invalidateLayout();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "padding")
+            {
+                Group::rendererChanged(property);
+
+                // Update the space between widgets as the padding is used when no space was explicitly set
+                m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
+                invalidateLayout();
+                return;
+            }
         }
-        else if (property == "padding")
+
+        // The property isn't handled by this widget, or an unknown name only shares the hash of a known property
+        Group::rendererChanged(property);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BoxLayout::removeWidgetsBeforeInsert(std::size_t index, const std::vector<Widget::Ptr>& widgets)
+    {
+        index = std::min(index, m_widgets.size());
+        for (const auto& widget : widgets)
         {
-            Group::rendererChanged(property);
+            if (widget->getParent() != this)
+                continue;
+
+            const auto it = std::find(m_widgets.begin(), m_widgets.end(), widget);
+            if (it == m_widgets.end())
+                continue;
 
-            // Update the space between widgets as the padding is used when no space was explicitly set
-            m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
-            updateWidgets();
+            const auto widgetIndex = static_cast<std::size_t>(it - m_widgets.begin());
+            if (widgetIndex < index)
+                --index;
+
+            remove(widgetIndex);
         }
-        else
-            Group::rendererChanged(property);
+
+        return index;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BoxLayout::invalidateLayout(std::size_t firstChangedWidget)
+    {
+        m_firstChangedWidget = std::min(m_firstChangedWidget, firstChangedWidget);
+
+        if (!scheduleChildLayoutUpdate())
+            updateChildLayout();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BoxLayout::updateChildLayout()
+    {
+        updateWidgets();
+        m_firstChangedWidget = std::numeric_limits<std::size_t>::max();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/BoxLayoutRatios.hpp>
+#include <algorithm>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -71,6 +72,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BoxLayoutRatios::insertWidgets(std::size_t index, const std::vector<Widget::Ptr>& widgets)
+    {
+        // Widgets that are moved within the layout have to lose their old ratio before the new ratios are inserted
+        index = removeWidgetsBeforeInsert(index, widgets);
+        m_ratios.insert(m_ratios.begin() + std::min(index, m_ratios.size()), widgets.size(), 1.f);
+
+        BoxLayout::insertWidgets(index, widgets);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool BoxLayoutRatios::remove(std::size_t index)
     {
         if (index < m_ratios.size())
@@ -122,7 +134,7 @@ namespace tgui
             return false;
 
         m_ratios[index] = ratio;
-        updateWidgets();
+        invalidateLayout();
         return true;
     }
 
@@ -261,105 +261,150 @@ namespace tgui
 
     void Button::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
+        switch (propertyHash(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            updateSize();
-        }
-        else if ((property == "textcolor") || (property == "textcolorhover") || (property == "textcolordown") || (property == "textcolordisabled") || (property == "textcolorfocused")
-              || (property == "textstyle") || (property == "textstylehover") || (property == "textstyledown") || (property == "textstyledisabled") || (property == "textstylefocused"))
-        {
-            updateTextColorAndStyle();
-        }
-        else if (property == "texture")
-        {
-            m_sprite.setTexture(getSharedRenderer()->getTexture());
-        }
-        else if (property == "texturehover")
-        {
-            m_spriteHover.setTexture(getSharedRenderer()->getTextureHover());
-        }
-        else if (property == "texturedown")
-        {
-            m_spriteDown.setTexture(getSharedRenderer()->getTextureDown());
-        }
-        else if (property == "texturedisabled")
-        {
-            m_spriteDisabled.setTexture(getSharedRenderer()->getTextureDisabled());
-        }
-        else if (property == "texturefocused")
-        {
-            m_spriteFocused.setTexture(getSharedRenderer()->getTextureFocused());
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "bordercolorhover")
-        {
-            m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
-        }
-        else if (property == "bordercolordown")
-        {
-            m_borderColorDownCached = getSharedRenderer()->getBorderColorDown();
-        }
-        else if (property == "bordercolordisabled")
-        {
-            m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
-        }
-        else if (property == "bordercolorfocused")
-        {
-            m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "backgroundcolorhover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == "backgroundcolordown")
-        {
-            m_backgroundColorDownCached = getSharedRenderer()->getBackgroundColorDown();
-        }
-        else if (property == "backgroundcolordisabled")
-        {
-            m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
-        }
-        else if (property == "backgroundcolorfocused")
-        {
-            m_backgroundColorFocusedCached = getSharedRenderer()->getBackgroundColorFocused();
-        }
-        else if (property == "textoutlinethickness")
-        {
-            m_text.setOutlineThickness(getSharedRenderer()->getTextOutlineThickness());
-        }
-        else if (property == "textoutlinecolor")
-        {
-            m_text.setOutlineColor(getSharedRenderer()->getTextOutlineColor());
-        }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
-        {
-            Widget::rendererChanged(property);
+            TGUI_PROPERTY_CASE(property, "borders")
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                updateSize();
+                return;
+            }
 
-            m_sprite.setOpacity(m_opacityCached);
-            m_spriteHover.setOpacity(m_opacityCached);
-            m_spriteDown.setOpacity(m_opacityCached);
-            m_spriteDisabled.setOpacity(m_opacityCached);
-            m_spriteFocused.setOpacity(m_opacityCached);
+            TGUI_PROPERTY_CASE(property, "textcolor", "textcolorhover", "textcolordown", "textcolordisabled", "textcolorfocused",
+                                         "textstyle", "textstylehover", "textstyledown", "textstyledisabled", "textstylefocused")
+            {
+                updateTextColorAndStyle();
+                return;
+            }
 
-            m_text.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
+            TGUI_PROPERTY_CASE(property, "texture")
+            {
+                m_sprite.setTexture(getSharedRenderer()->getTexture());
+                return;
+            }
 
-            m_text.setFont(m_fontCached);
-            setText(getText());
+            TGUI_PROPERTY_CASE(property, "texturehover")
+            {
+                m_spriteHover.setTexture(getSharedRenderer()->getTextureHover());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturedown")
+            {
+                m_spriteDown.setTexture(getSharedRenderer()->getTextureDown());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturedisabled")
+            {
+                m_spriteDisabled.setTexture(getSharedRenderer()->getTextureDisabled());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturefocused")
+            {
+                m_spriteFocused.setTexture(getSharedRenderer()->getTextureFocused());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "bordercolor")
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "bordercolorhover")
+            {
+                m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "bordercolordown")
+            {
+                m_borderColorDownCached = getSharedRenderer()->getBorderColorDown();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "bordercolordisabled")
+            {
+                m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "bordercolorfocused")
+            {
+                m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "backgroundcolor")
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "backgroundcolorhover")
+            {
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "backgroundcolordown")
+            {
+                m_backgroundColorDownCached = getSharedRenderer()->getBackgroundColorDown();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "backgroundcolordisabled")
+            {
+                m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "backgroundcolorfocused")
+            {
+                m_backgroundColorFocusedCached = getSharedRenderer()->getBackgroundColorFocused();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "textoutlinethickness")
+            {
+                m_text.setOutlineThickness(getSharedRenderer()->getTextOutlineThickness());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "textoutlinecolor")
+            {
+                m_text.setOutlineColor(getSharedRenderer()->getTextOutlineColor());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "opacity", "opacitydisabled")
+            {
+                Widget::rendererChanged(property);
+
+                m_sprite.setOpacity(m_opacityCached);
+                m_spriteHover.setOpacity(m_opacityCached);
+                m_spriteDown.setOpacity(m_opacityCached);
+                m_spriteDisabled.setOpacity(m_opacityCached);
+                m_spriteFocused.setOpacity(m_opacityCached);
+
+                m_text.setOpacity(m_opacityCached);
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "font")
+            {
+                Widget::rendererChanged(property);
+
+                m_text.setFont(m_fontCached);
+                setText(getText());
+                return;
+            }
         }
-        else
-            Widget::rendererChanged(property);
+
+        // The property isn't handled by this widget, or an unknown name only shares the hash of a known property
+        Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,11 +24,28 @@
 
 
 #include <TGUI/Widgets/Canvas.hpp>
+#include <algorithm>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Returns the part of the rectangle that lies inside a texture of the given size
+        sf::IntRect clipToTexture(const sf::IntRect& rect, sf::Vector2u size)
+        {
+            const int left = std::max(rect.left, 0);
+            const int top = std::max(rect.top, 0);
+            const int right = std::min(rect.left + rect.width, static_cast<int>(size.x));
+            const int bottom = std::min(rect.top + rect.height, static_cast<int>(size.y));
+            if ((left >= right) || (top >= bottom))
+                return {};
+
+            return {left, top, right - left, bottom - top};
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Canvas::Canvas(const Layout2d& size)
@@ -41,7 +58,8 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Canvas::Canvas(const Canvas& other) :
-        ClickableWidget{other}
+        ClickableWidget{other},
+        m_pixelBufferMode{other.m_pixelBufferMode}
     {
         setSize(other.getSize());
     }
@@ -49,7 +67,8 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Canvas::Canvas(Canvas&& other) :
-        ClickableWidget{std::move(other)}
+        ClickableWidget{std::move(other)},
+        m_pixelBufferMode{other.m_pixelBufferMode}
     {
         // sf::RenderTexture does not support move yet
         setSize(other.getSize());
@@ -62,6 +81,7 @@ namespace tgui
         if (this != &right)
         {
             ClickableWidget::operator=(right);
+            setPixelBufferMode(right.m_pixelBufferMode);
             setSize(right.getSize());
         }
 
@@ -77,6 +97,7 @@ namespace tgui
             ClickableWidget::operator=(std::move(right));
 
             // sf::RenderTexture does not support move yet
+            setPixelBufferMode(right.m_pixelBufferMode);
             setSize(right.getSize());
         }
 
@@ -119,6 +140,100 @@ namespace tgui
         }
 
         Widget::setSize(size);
+
+        if (m_pixelBufferMode != PixelBufferMode::None)
+            updatePixelBufferSize();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Canvas::setPixelBufferMode(PixelBufferMode mode)
+    {
+        if (m_pixelBufferMode == mode)
+            return;
+
+        m_pixelBufferMode = mode;
+        if (mode == PixelBufferMode::None)
+        {
+            m_pixelTexture = sf::Texture{};
+            std::vector<sf::Uint8>().swap(m_frontPixelBuffer);
+            std::vector<sf::Uint8>().swap(m_backPixelBuffer);
+            std::vector<sf::Uint8>().swap(m_uploadBuffer);
+
+            m_sprite.setTexture(m_renderTexture.getTexture());
+            m_sprite.setTextureRect(sf::IntRect{0, 0, static_cast<int>(getSize().x), static_cast<int>(getSize().y)});
+        }
+        else
+            updatePixelBufferSize();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Canvas::PixelBufferMode Canvas::getPixelBufferMode() const
+    {
+        return m_pixelBufferMode;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Canvas::updatePixels(const sf::Uint8* pixels, const sf::IntRect& rect, unsigned int pixelsPerRow)
+    {
+        if ((m_pixelBufferMode == PixelBufferMode::None) || !pixels)
+            return;
+
+        const sf::IntRect clippedRect = clipToTexture(rect, m_pixelTexture.getSize());
+        if ((clippedRect.width == 0) || (clippedRect.height == 0))
+            return;
+
+        if (pixelsPerRow == 0)
+            pixelsPerRow = static_cast<unsigned int>(rect.width);
+
+        const sf::Uint8* firstPixel = pixels
+            + ((static_cast<std::size_t>(clippedRect.top - rect.top) * pixelsPerRow) + static_cast<std::size_t>(clippedRect.left - rect.left)) * 4;
+
+        // Keep the front buffer identical to what is shown, it becomes the back buffer on the next swap
+        if (m_pixelBufferMode == PixelBufferMode::Double)
+        {
+            const std::size_t textureWidth = m_pixelTexture.getSize().x;
+            for (int y = 0; y < clippedRect.height; ++y)
+            {
+                const sf::Uint8* row = firstPixel + static_cast<std::size_t>(y) * pixelsPerRow * 4;
+                std::copy(row, row + clippedRect.width * 4,
+                          &m_frontPixelBuffer[((static_cast<std::size_t>(clippedRect.top + y) * textureWidth) + clippedRect.left) * 4]);
+            }
+        }
+
+        uploadPixels(firstPixel, clippedRect, pixelsPerRow);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Uint8* Canvas::getBackPixelBuffer()
+    {
+        if ((m_pixelBufferMode != PixelBufferMode::Double) || m_backPixelBuffer.empty())
+            return nullptr;
+
+        return m_backPixelBuffer.data();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Canvas::swapPixelBuffers(const sf::IntRect& changedRect)
+    {
+        if ((m_pixelBufferMode != PixelBufferMode::Double) || m_frontPixelBuffer.empty())
+            return;
+
+        m_frontPixelBuffer.swap(m_backPixelBuffer);
+
+        const sf::Vector2u textureSize = m_pixelTexture.getSize();
+        sf::IntRect rect = {0, 0, static_cast<int>(textureSize.x), static_cast<int>(textureSize.y)};
+        if ((changedRect.width > 0) && (changedRect.height > 0))
+            rect = clipToTexture(changedRect, textureSize);
+
+        if ((rect.width == 0) || (rect.height == 0))
+            return;
+
+        uploadPixels(&m_frontPixelBuffer[((static_cast<std::size_t>(rect.top) * textureSize.x) + rect.left) * 4], rect, textureSize.x);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -186,12 +301,75 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Canvas::updatePixelBufferSize()
+    {
+        const unsigned int width = static_cast<unsigned int>(getSize().x);
+        const unsigned int height = static_cast<unsigned int>(getSize().y);
+        if ((width == 0) || (height == 0))
+            return;
+
+        if ((m_pixelTexture.getSize().x != width) || (m_pixelTexture.getSize().y != height))
+            m_pixelTexture.create(width, height);
+
+        // The canvas starts out black, just like the render texture does after resizing
+        std::vector<sf::Uint8> blackPixels(static_cast<std::size_t>(width) * height * 4, 0);
+        for (std::size_t i = 3; i < blackPixels.size(); i += 4)
+            blackPixels[i] = 255;
+
+        m_pixelTexture.update(blackPixels.data());
+
+        if (m_pixelBufferMode == PixelBufferMode::Double)
+        {
+            m_frontPixelBuffer = blackPixels;
+            m_backPixelBuffer = std::move(blackPixels);
+        }
+        else
+        {
+            std::vector<sf::Uint8>().swap(m_frontPixelBuffer);
+            std::vector<sf::Uint8>().swap(m_backPixelBuffer);
+        }
+
+        m_sprite.setTexture(m_pixelTexture);
+        m_sprite.setTextureRect(sf::IntRect{0, 0, static_cast<int>(width), static_cast<int>(height)});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Canvas::uploadPixels(const sf::Uint8* pixels, const sf::IntRect& rect, unsigned int pixelsPerRow)
+    {
+        const unsigned int width = static_cast<unsigned int>(rect.width);
+        const unsigned int height = static_cast<unsigned int>(rect.height);
+
+        // Texture::update requires the rows to follow each other, so the rows of a tile are first gathered in one buffer
+        if ((pixelsPerRow == width) || (height == 1))
+            m_pixelTexture.update(pixels, width, height, static_cast<unsigned int>(rect.left), static_cast<unsigned int>(rect.top));
+        else
+        {
+            m_uploadBuffer.resize(static_cast<std::size_t>(width) * height * 4);
+            for (unsigned int y = 0; y < height; ++y)
+            {
+                const sf::Uint8* row = pixels + static_cast<std::size_t>(y) * pixelsPerRow * 4;
+                std::copy(row, row + width * 4, &m_uploadBuffer[static_cast<std::size_t>(y) * width * 4]);
+            }
+
+            m_pixelTexture.update(m_uploadBuffer.data(), width, height, static_cast<unsigned int>(rect.left), static_cast<unsigned int>(rect.top));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Canvas::rendererChanged(const std::string& property)
     {
         Widget::rendererChanged(property);
 
-        if ((property == "opacity") || (property == "opacitydisabled"))
-            m_sprite.setColor(Color::calcColorOpacity(Color::White, m_opacityCached));
+        switch (propertyHash(property))
+        {
+            TGUI_PROPERTY_CASE(property, "opacity", "opacitydisabled")
+            {
+                m_sprite.setColor(Color::calcColorOpacity(Color::White, m_opacityCached));
+                break;
+            }
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -458,66 +458,87 @@ namespace tgui
 
     void ChatBox::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
+        switch (propertyHash(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == "texturebackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == "scrollbar")
-        {
-            m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
+            TGUI_PROPERTY_CASE(property, "borders")
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                return;
+            }
 
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (!getSharedRenderer()->getScrollbarWidth())
+            TGUI_PROPERTY_CASE(property, "padding")
             {
-                m_scroll->setSize({m_scroll->getDefaultWidth(), m_scroll->getSize().y});
+                m_paddingCached = getSharedRenderer()->getPadding();
                 setSize(m_size);
+                return;
             }
-        }
-        else if (property == "scrollbarwidth")
-        {
-            const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
-            m_scroll->setSize({width, m_scroll->getSize().y});
-            setSize(m_size);
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
-        {
-            Widget::rendererChanged(property);
 
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_scroll->setInheritedOpacity(m_opacityCached);
+            TGUI_PROPERTY_CASE(property, "texturebackground")
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                return;
+            }
 
-            for (auto& line : m_lines)
-                line.text.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
+            TGUI_PROPERTY_CASE(property, "scrollbar")
+            {
+                m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
+
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (!getSharedRenderer()->getScrollbarWidth())
+                {
+                    m_scroll->setSize({m_scroll->getDefaultWidth(), m_scroll->getSize().y});
+                    setSize(m_size);
+                }
+                return;
+            }
 
-            for (auto& line : m_lines)
-                line.text.setFont(m_fontCached);
+            TGUI_PROPERTY_CASE(property, "scrollbarwidth")
+            {
+                const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
+                m_scroll->setSize({width, m_scroll->getSize().y});
+                setSize(m_size);
+                return;
+            }
 
-            recalculateAllLines();
+            TGUI_PROPERTY_CASE(property, "bordercolor")
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "backgroundcolor")
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "opacity", "opacitydisabled")
+            {
+                Widget::rendererChanged(property);
+
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_scroll->setInheritedOpacity(m_opacityCached);
+
+                for (auto& line : m_lines)
+                    line.text.setOpacity(m_opacityCached);
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "font")
+            {
+                Widget::rendererChanged(property);
+
+                for (auto& line : m_lines)
+                    line.text.setFont(m_fontCached);
+
+                recalculateAllLines();
+                return;
+            }
         }
-        else
-            Widget::rendererChanged(property);
+
+        // The property isn't handled by this widget, or an unknown name only shares the hash of a known property
+        Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -575,7 +596,7 @@ namespace tgui
         if (node->propertyValuePairs["textsize"])
             setTextSize(strToInt(node->propertyValuePairs["textsize"]->value));
         if (node->propertyValuePairs["textcolor"])
-            setTextColor(Deserializer::deserialize(ObjectConverter::Type::Color, node->propertyValuePairs["textcolor"]->value).getColor());
+            setTextColor(Deserializer::deserialize(ObjectConverter::Type::Color, *node->propertyValuePairs["textcolor"]).getColor());
         if (node->propertyValuePairs["textstyle"])
             setTextStyle(Deserializer::deserialize(ObjectConverter::Type::TextStyle, node->propertyValuePairs["textstyle"]->value).getTextStyle());
         if (node->propertyValuePairs["linelimit"])
@@ -587,7 +608,7 @@ namespace tgui
             {
                 Color lineTextColor = getTextColor();
                 if (childNode->propertyValuePairs["color"])
-                    lineTextColor = Deserializer::deserialize(ObjectConverter::Type::Color, childNode->propertyValuePairs["color"]->value).getColor();
+                    lineTextColor = Deserializer::deserialize(ObjectConverter::Type::Color, *childNode->propertyValuePairs["color"]).getColor();
 
                 TextStyle lineTextStyle = getTextStyle();
                 if (childNode->propertyValuePairs["style"])
@@ -601,11 +622,11 @@ namespace tgui
                                         [](const std::unique_ptr<DataIO::Node>& child){ return toLower(child->name) == "line"; }), node->children.end());
 
         if (node->propertyValuePairs["linesstartfromtop"])
-            setLinesStartFromTop(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["linesstartfromtop"]->value).getBool());
+            setLinesStartFromTop(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["linesstartfromtop"]).getBool());
 
         // This has to be parsed after the lines have been added
         if (node->propertyValuePairs["newlinesbelowothers"])
-            setNewLinesBelowOthers(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["newlinesbelowothers"]->value).getBool());
+            setNewLinesBelowOthers(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["newlinesbelowothers"]).getBool());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -154,11 +154,22 @@ namespace tgui
 
     void CheckBox::rendererChanged(const std::string& property)
     {
-        if (property == "textureunchecked")
-            m_textureUncheckedCached = getSharedRenderer()->getTextureUnchecked();
-        else if (property == "texturechecked")
-            m_textureCheckedCached = getSharedRenderer()->getTextureChecked();
+        switch (propertyHash(property))
+        {
+            TGUI_PROPERTY_CASE(property, "textureunchecked")
+            {
+                m_textureUncheckedCached = getSharedRenderer()->getTextureUnchecked();
+                break;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturechecked")
+            {
+                m_textureCheckedCached = getSharedRenderer()->getTextureChecked();
+                break;
+            }
+        }
 
+        // The textures are also used by the radio button, which handles all other properties as well
         RadioButton::rendererChanged(property);
     }
 
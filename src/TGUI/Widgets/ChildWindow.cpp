@@ -540,8 +540,7 @@ namespace tgui
         else
         {
             // Tell the widgets that the mouse was released
-            for (auto& widget : m_widgets)
-                widget->leftMouseButtonNoLongerDown();
+            notifyChildrenLeftMouseButtonNoLongerDown();
 
             // Check if the mouse is on top of the title bar
             if (FloatRect{m_bordersCached.getLeft(), m_bordersCached.getTop(), getSize().x, m_titleBarHeightCached}.contains(pos))
@@ -581,8 +580,7 @@ namespace tgui
         else
         {
             // Tell the widgets that the mouse was released
-            for (auto& widget : m_widgets)
-                widget->rightMouseButtonNoLongerDown();
+            notifyChildrenRightMouseButtonNoLongerDown();
         }
     }
 
@@ -779,134 +777,175 @@ namespace tgui
 
     void ChildWindow::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
+        switch (propertyHash(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "titlecolor")
-        {
-            m_titleText.setColor(getSharedRenderer()->getTitleColor());
-        }
-        else if (property == "texturetitlebar")
-        {
-            m_spriteTitleBar.setTexture(getSharedRenderer()->getTextureTitleBar());
+            TGUI_PROPERTY_CASE(property, "borders")
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "titlecolor")
+            {
+                m_titleText.setColor(getSharedRenderer()->getTitleColor());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturetitlebar")
+            {
+                m_spriteTitleBar.setTexture(getSharedRenderer()->getTextureTitleBar());
 
-            // If the title bar height is determined by the texture then update it (note that getTitleBarHeight has a non-trivial implementation)
-            m_titleBarHeightCached = getSharedRenderer()->getTitleBarHeight();
-            if (m_titleBarHeightCached == m_spriteTitleBar.getTexture().getImageSize().y)
+                // If the title bar height is determined by the texture then update it (note that getTitleBarHeight has a non-trivial implementation)
+                m_titleBarHeightCached = getSharedRenderer()->getTitleBarHeight();
+                if (m_titleBarHeightCached == m_spriteTitleBar.getTexture().getImageSize().y)
+                    updateTitleBarHeight();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturebackground")
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "titlebarheight")
+            {
+                m_titleBarHeightCached = getSharedRenderer()->getTitleBarHeight();
                 updateTitleBarHeight();
-        }
-        else if (property == "texturebackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == "titlebarheight")
-        {
-            m_titleBarHeightCached = getSharedRenderer()->getTitleBarHeight();
-            updateTitleBarHeight();
-        }
-        else if (property == "borderbelowtitlebar")
-        {
-            m_borderBelowTitleBarCached = getSharedRenderer()->getBorderBelowTitleBar();
-        }
-        else if (property == "distancetoside")
-        {
-            m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
-            setPosition(m_position);
-        }
-        else if (property == "paddingbetweenbuttons")
-        {
-            m_paddingBetweenButtonsCached = getSharedRenderer()->getPaddingBetweenButtons();
-            setPosition(m_position);
-        }
-        else if (property == "minimumresizableborderwidth")
-        {
-            m_minimumResizableBorderWidthCached = getSharedRenderer()->getMinimumResizableBorderWidth();
-        }
-        else if (property == "showtextontitlebuttons")
-        {
-            m_showTextOnTitleButtonsCached = getSharedRenderer()->getShowTextOnTitleButtons();
-            setTitleButtons(m_titleButtons);
-        }
-        else if (property == "closebutton")
-        {
-            if (m_closeButton->isVisible())
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "borderbelowtitlebar")
             {
-                m_closeButton->setRenderer(getSharedRenderer()->getCloseButton());
-                m_closeButton->setInheritedOpacity(m_opacityCached);
+                m_borderBelowTitleBarCached = getSharedRenderer()->getBorderBelowTitleBar();
+                return;
             }
 
-            updateTitleBarHeight();
-        }
-        else if (property == "maximizebutton")
-        {
-            if (m_maximizeButton->isVisible())
+            TGUI_PROPERTY_CASE(property, "distancetoside")
             {
-                m_maximizeButton->setRenderer(getSharedRenderer()->getMaximizeButton());
-                m_maximizeButton->setInheritedOpacity(m_opacityCached);
+                m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
+                setPosition(m_position);
+                return;
             }
 
-            updateTitleBarHeight();
-        }
-        else if (property == "minimizebutton")
-        {
-            if (m_minimizeButton->isVisible())
+            TGUI_PROPERTY_CASE(property, "paddingbetweenbuttons")
             {
-                m_minimizeButton->setRenderer(getSharedRenderer()->getMinimizeButton());
-                m_minimizeButton->setInheritedOpacity(m_opacityCached);
+                m_paddingBetweenButtonsCached = getSharedRenderer()->getPaddingBetweenButtons();
+                setPosition(m_position);
+                return;
             }
 
-            updateTitleBarHeight();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "titlebarcolor")
-        {
-            m_titleBarColorCached = getSharedRenderer()->getTitleBarColor();
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "bordercolorfocused")
-        {
-            m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
-        }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
-        {
-            Container::rendererChanged(property);
+            TGUI_PROPERTY_CASE(property, "minimumresizableborderwidth")
+            {
+                m_minimumResizableBorderWidthCached = getSharedRenderer()->getMinimumResizableBorderWidth();
+                return;
+            }
 
-            for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
+            TGUI_PROPERTY_CASE(property, "showtextontitlebuttons")
             {
-                if (button->isVisible())
-                    button->setInheritedOpacity(m_opacityCached);
+                m_showTextOnTitleButtonsCached = getSharedRenderer()->getShowTextOnTitleButtons();
+                setTitleButtons(m_titleButtons);
+                return;
             }
 
-            m_titleText.setOpacity(m_opacityCached);
-            m_spriteTitleBar.setOpacity(m_opacityCached);
-            m_spriteBackground.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Container::rendererChanged(property);
+            TGUI_PROPERTY_CASE(property, "closebutton")
+            {
+                if (m_closeButton->isVisible())
+                {
+                    m_closeButton->setRenderer(getSharedRenderer()->getCloseButton());
+                    m_closeButton->setInheritedOpacity(m_opacityCached);
+                }
 
-            for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
+                updateTitleBarHeight();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "maximizebutton")
             {
-                if (button->isVisible())
-                    button->setInheritedFont(m_fontCached);
+                if (m_maximizeButton->isVisible())
+                {
+                    m_maximizeButton->setRenderer(getSharedRenderer()->getMaximizeButton());
+                    m_maximizeButton->setInheritedOpacity(m_opacityCached);
+                }
+
+                updateTitleBarHeight();
+                return;
             }
 
-            m_titleText.setFont(m_fontCached);
-            if (m_titleTextSize == 0)
-                m_titleText.setCharacterSize(Text::findBestTextSize(m_fontCached, getSharedRenderer()->getTitleBarHeight() * 0.8f));
+            TGUI_PROPERTY_CASE(property, "minimizebutton")
+            {
+                if (m_minimizeButton->isVisible())
+                {
+                    m_minimizeButton->setRenderer(getSharedRenderer()->getMinimizeButton());
+                    m_minimizeButton->setInheritedOpacity(m_opacityCached);
+                }
 
-            setPosition(m_position);
+                updateTitleBarHeight();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "backgroundcolor")
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "titlebarcolor")
+            {
+                m_titleBarColorCached = getSharedRenderer()->getTitleBarColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "bordercolor")
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "bordercolorfocused")
+            {
+                m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "opacity", "opacitydisabled")
+            {
+                Container::rendererChanged(property);
+
+                for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
+                {
+                    if (button->isVisible())
+                        button->setInheritedOpacity(m_opacityCached);
+                }
+
+                m_titleText.setOpacity(m_opacityCached);
+                m_spriteTitleBar.setOpacity(m_opacityCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "font")
+            {
+                Container::rendererChanged(property);
+
+                for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
+                {
+                    if (button->isVisible())
+                        button->setInheritedFont(m_fontCached);
+                }
+
+                m_titleText.setFont(m_fontCached);
+                if (m_titleTextSize == 0)
+                    m_titleText.setCharacterSize(Text::findBestTextSize(m_fontCached, getSharedRenderer()->getTitleBarHeight() * 0.8f));
+
+                setPosition(m_position);
+                return;
+            }
         }
-        else
-            Container::rendererChanged(property);
+
+        // The property isn't handled by this widget, or an unknown name only shares the hash of a known property
+        Container::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -996,12 +1035,12 @@ namespace tgui
             setTitle(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["title"]->value).getString());
 
         if (node->propertyValuePairs["keepinparent"])
-            setKeepInParent(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["keepinparent"]->value).getBool());
+            setKeepInParent(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["keepinparent"]).getBool());
 
         if (node->propertyValuePairs["resizable"])
-            setResizable(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["resizable"]->value).getBool());
+            setResizable(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["resizable"]).getBool());
         if (node->propertyValuePairs["positionlocked"])
-            setPositionLocked(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["positionlocked"]->value).getBool());
+            setPositionLocked(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["positionlocked"]).getBool());
 
         if (node->propertyValuePairs["minimumsize"])
             setMinimumSize(Vector2f{node->propertyValuePairs["minimumsize"]->value});
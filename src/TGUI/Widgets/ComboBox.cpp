@@ -631,106 +631,145 @@ namespace tgui
 
     void ComboBox::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
+        switch (propertyHash(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == "textcolor")
-        {
-            m_text.setColor(getSharedRenderer()->getTextColor());
-            if (!getSharedRenderer()->getDefaultTextColor().isSet())
-                m_defaultText.setColor(getSharedRenderer()->getTextColor());
-        }
-        else if (property == "textstyle")
-        {
-            m_text.setStyle(getSharedRenderer()->getTextStyle());
-            if (!getSharedRenderer()->getDefaultTextStyle().isSet())
-                m_defaultText.setStyle(getSharedRenderer()->getTextStyle());
-        }
-        else if (property == "defaulttextcolor")
-        {
-            if (getSharedRenderer()->getDefaultTextColor().isSet())
-                m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
-            else
-                m_defaultText.setColor(getSharedRenderer()->getTextColor());
-        }
-        else if (property == "defaulttextstyle")
-        {
-            if (getSharedRenderer()->getDefaultTextStyle().isSet())
-                m_defaultText.setStyle(getSharedRenderer()->getDefaultTextStyle());
-            else
-                m_defaultText.setStyle(getSharedRenderer()->getTextStyle());
-        }
-        else if (property == "texturebackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == "texturearrow")
-        {
-            m_spriteArrow.setTexture(getSharedRenderer()->getTextureArrow());
-            setSize(m_size);
-        }
-        else if (property == "texturearrowhover")
-        {
-            m_spriteArrowHover.setTexture(getSharedRenderer()->getTextureArrowHover());
-        }
-        else if (property == "listbox")
-        {
-            m_listBox->setRenderer(getSharedRenderer()->getListBox());
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "arrowbackgroundcolor")
-        {
-            m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
-        }
-        else if (property == "arrowbackgroundcolorhover")
-        {
-            m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
-        }
-        else if (property == "arrowcolor")
-        {
-            m_arrowColorCached = getSharedRenderer()->getArrowColor();
-        }
-        else if (property == "arrowcolorhover")
-        {
-            m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
-        }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
-        {
-            Widget::rendererChanged(property);
+            TGUI_PROPERTY_CASE(property, "borders")
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                return;
+            }
 
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_spriteArrow.setOpacity(m_opacityCached);
-            m_spriteArrowHover.setOpacity(m_opacityCached);
+            TGUI_PROPERTY_CASE(property, "padding")
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                setSize(m_size);
+                return;
+            }
 
-            m_text.setOpacity(m_opacityCached);
-            m_defaultText.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
+            TGUI_PROPERTY_CASE(property, "textcolor")
+            {
+                m_text.setColor(getSharedRenderer()->getTextColor());
+                if (!getSharedRenderer()->getDefaultTextColor().isSet())
+                    m_defaultText.setColor(getSharedRenderer()->getTextColor());
+                return;
+            }
 
-            m_text.setFont(m_fontCached);
-            m_defaultText.setFont(m_fontCached);
-            m_listBox->setInheritedFont(m_fontCached);
+            TGUI_PROPERTY_CASE(property, "textstyle")
+            {
+                m_text.setStyle(getSharedRenderer()->getTextStyle());
+                if (!getSharedRenderer()->getDefaultTextStyle().isSet())
+                    m_defaultText.setStyle(getSharedRenderer()->getTextStyle());
+                return;
+            }
 
-            setSize(m_size);
+            TGUI_PROPERTY_CASE(property, "defaulttextcolor")
+            {
+                if (getSharedRenderer()->getDefaultTextColor().isSet())
+                    m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
+                else
+                    m_defaultText.setColor(getSharedRenderer()->getTextColor());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "defaulttextstyle")
+            {
+                if (getSharedRenderer()->getDefaultTextStyle().isSet())
+                    m_defaultText.setStyle(getSharedRenderer()->getDefaultTextStyle());
+                else
+                    m_defaultText.setStyle(getSharedRenderer()->getTextStyle());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturebackground")
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturearrow")
+            {
+                m_spriteArrow.setTexture(getSharedRenderer()->getTextureArrow());
+                setSize(m_size);
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturearrowhover")
+            {
+                m_spriteArrowHover.setTexture(getSharedRenderer()->getTextureArrowHover());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "listbox")
+            {
+                m_listBox->setRenderer(getSharedRenderer()->getListBox());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "bordercolor")
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "backgroundcolor")
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "arrowbackgroundcolor")
+            {
+                m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "arrowbackgroundcolorhover")
+            {
+                m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "arrowcolor")
+            {
+                m_arrowColorCached = getSharedRenderer()->getArrowColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "arrowcolorhover")
+            {
+                m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "opacity", "opacitydisabled")
+            {
+                Widget::rendererChanged(property);
+
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_spriteArrow.setOpacity(m_opacityCached);
+                m_spriteArrowHover.setOpacity(m_opacityCached);
+
+                m_text.setOpacity(m_opacityCached);
+                m_defaultText.setOpacity(m_opacityCached);
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "font")
+            {
+                Widget::rendererChanged(property);
+
+                m_text.setFont(m_fontCached);
+                m_defaultText.setFont(m_fontCached);
+                m_listBox->setInheritedFont(m_fontCached);
+
+                setSize(m_size);
+                return;
+            }
         }
-        else
-            Widget::rendererChanged(property);
+
+        // The property isn't handled by this widget, or an unknown name only shares the hash of a known property
+        Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -828,7 +867,7 @@ namespace tgui
         if (node->propertyValuePairs["selecteditemindex"])
             setSelectedItemByIndex(strToInt(node->propertyValuePairs["selecteditemindex"]->value));
         if (node->propertyValuePairs["changeitemonscroll"])
-            m_changeItemOnScroll = Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["changeitemonscroll"]->value).getBool();
+            m_changeItemOnScroll = Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["changeitemonscroll"]).getBool();
 
         if (node->propertyValuePairs["expanddirection"])
         {
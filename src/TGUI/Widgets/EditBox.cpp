@@ -477,7 +477,7 @@ namespace tgui
         if (focused)
         {
             m_caretVisible = true;
-            m_animationTimeElapsed = {};
+            restartAnimationTime(sf::milliseconds(500));
         }
         else // Unfocusing
         {
@@ -555,7 +555,7 @@ namespace tgui
 
         // The caret should be visible
         m_caretVisible = true;
-        m_animationTimeElapsed = {};
+        restartAnimationTime(sf::milliseconds(500));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -893,7 +893,7 @@ namespace tgui
 
         // The caret should be visible again
         m_caretVisible = true;
-        m_animationTimeElapsed = {};
+        restartAnimationTime(sf::milliseconds(500));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -961,7 +961,7 @@ namespace tgui
 
         // The caret should be visible again
         m_caretVisible = true;
-        m_animationTimeElapsed = {};
+        restartAnimationTime(sf::milliseconds(500));
 
         onTextChange.emit(this, m_text);
     }
@@ -982,145 +982,200 @@ namespace tgui
 
     void EditBox::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "padding")
+        switch (propertyHash(property))
         {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            m_paddingCached.updateParentSize(getSize());
+            TGUI_PROPERTY_CASE(property, "borders")
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                return;
+            }
 
-            setText(m_text);
+            TGUI_PROPERTY_CASE(property, "padding")
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                m_paddingCached.updateParentSize(getSize());
 
-            m_caret.setSize({m_caret.getSize().x, getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
-        }
-        else if (property == "caretwidth")
-        {
-            m_caret.setPosition({m_caret.getPosition().x + ((m_caret.getSize().x - getSharedRenderer()->getCaretWidth()) / 2.0f), m_caret.getPosition().y});
-            m_caret.setSize({getSharedRenderer()->getCaretWidth(), getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
-        }
-        else if ((property == "textcolor") || (property == "textcolordisabled") || (property == "textcolorfocused"))
-        {
-            updateTextColor();
-        }
-        else if (property == "selectedtextcolor")
-        {
-            m_textSelection.setColor(getSharedRenderer()->getSelectedTextColor());
-        }
-        else if (property == "defaulttextcolor")
-        {
-            m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
-        }
-        else if (property == "texture")
-        {
-            m_sprite.setTexture(getSharedRenderer()->getTexture());
-        }
-        else if (property == "texturehover")
-        {
-            m_spriteHover.setTexture(getSharedRenderer()->getTextureHover());
-        }
-        else if (property == "texturedisabled")
-        {
-            m_spriteDisabled.setTexture(getSharedRenderer()->getTextureDisabled());
-        }
-        else if (property == "texturefocused")
-        {
-            m_spriteFocused.setTexture(getSharedRenderer()->getTextureFocused());
-        }
-        else if (property == "textstyle")
-        {
-            const TextStyle style = getSharedRenderer()->getTextStyle();
-            m_textBeforeSelection.setStyle(style);
-            m_textAfterSelection.setStyle(style);
-            m_textSelection.setStyle(style);
-            m_textSuffix.setStyle(style);
-            m_textFull.setStyle(style);
-        }
-        else if (property == "defaulttextstyle")
-        {
-            m_defaultText.setStyle(getSharedRenderer()->getDefaultTextStyle());
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "bordercolorhover")
-        {
-            m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
-        }
-        else if (property == "bordercolordisabled")
-        {
-            m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
-        }
-        else if (property == "bordercolorfocused")
-        {
-            m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "backgroundcolorhover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == "backgroundcolordisabled")
-        {
-            m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
-        }
-        else if (property == "backgroundcolorfocused")
-        {
-            m_backgroundColorFocusedCached = getSharedRenderer()->getBackgroundColorFocused();
-        }
-        else if (property == "caretcolor")
-        {
-            m_caretColorCached = getSharedRenderer()->getCaretColor();
-        }
-        else if (property == "caretcolorhover")
-        {
-            m_caretColorHoverCached = getSharedRenderer()->getCaretColorHover();
-        }
-        else if (property == "caretcolorfocused")
-        {
-            m_caretColorFocusedCached = getSharedRenderer()->getCaretColorFocused();
-        }
-        else if (property == "selectedtextbackgroundcolor")
-        {
-            m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
-        }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
-        {
-            Widget::rendererChanged(property);
-
-            m_textBeforeSelection.setOpacity(m_opacityCached);
-            m_textAfterSelection.setOpacity(m_opacityCached);
-            m_textSelection.setOpacity(m_opacityCached);
-            m_defaultText.setOpacity(m_opacityCached);
-            m_textSuffix.setOpacity(m_opacityCached);
-
-            m_sprite.setOpacity(m_opacityCached);
-            m_spriteHover.setOpacity(m_opacityCached);
-            m_spriteDisabled.setOpacity(m_opacityCached);
-            m_spriteFocused.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
+                setText(m_text);
 
-            m_textBeforeSelection.setFont(m_fontCached);
-            m_textSelection.setFont(m_fontCached);
-            m_textAfterSelection.setFont(m_fontCached);
-            m_textSuffix.setFont(m_fontCached);
-            m_textFull.setFont(m_fontCached);
-            m_defaultText.setFont(m_fontCached);
+                m_caret.setSize({m_caret.getSize().x, getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
+                return;
+            }
 
-            // Recalculate the text size and position
-            setText(m_text);
+            TGUI_PROPERTY_CASE(property, "caretwidth")
+            {
+                m_caret.setPosition({m_caret.getPosition().x + ((m_caret.getSize().x - getSharedRenderer()->getCaretWidth()) / 2.0f), m_caret.getPosition().y});
+                m_caret.setSize({getSharedRenderer()->getCaretWidth(), getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "textcolor", "textcolordisabled", "textcolorfocused")
+            {
+                updateTextColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "selectedtextcolor")
+            {
+                m_textSelection.setColor(getSharedRenderer()->getSelectedTextColor());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "defaulttextcolor")
+            {
+                m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texture")
+            {
+                m_sprite.setTexture(getSharedRenderer()->getTexture());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturehover")
+            {
+                m_spriteHover.setTexture(getSharedRenderer()->getTextureHover());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturedisabled")
+            {
+                m_spriteDisabled.setTexture(getSharedRenderer()->getTextureDisabled());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturefocused")
+            {
+                m_spriteFocused.setTexture(getSharedRenderer()->getTextureFocused());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "textstyle")
+            {
+                const TextStyle style = getSharedRenderer()->getTextStyle();
+                m_textBeforeSelection.setStyle(style);
+                m_textAfterSelection.setStyle(style);
+                m_textSelection.setStyle(style);
+                m_textSuffix.setStyle(style);
+                m_textFull.setStyle(style);
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "defaulttextstyle")
+            {
+                m_defaultText.setStyle(getSharedRenderer()->getDefaultTextStyle());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "bordercolor")
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "bordercolorhover")
+            {
+                m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "bordercolordisabled")
+            {
+                m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "bordercolorfocused")
+            {
+                m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "backgroundcolor")
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "backgroundcolorhover")
+            {
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "backgroundcolordisabled")
+            {
+                m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "backgroundcolorfocused")
+            {
+                m_backgroundColorFocusedCached = getSharedRenderer()->getBackgroundColorFocused();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "caretcolor")
+            {
+                m_caretColorCached = getSharedRenderer()->getCaretColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "caretcolorhover")
+            {
+                m_caretColorHoverCached = getSharedRenderer()->getCaretColorHover();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "caretcolorfocused")
+            {
+                m_caretColorFocusedCached = getSharedRenderer()->getCaretColorFocused();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "selectedtextbackgroundcolor")
+            {
+                m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "opacity", "opacitydisabled")
+            {
+                Widget::rendererChanged(property);
+
+                m_textBeforeSelection.setOpacity(m_opacityCached);
+                m_textAfterSelection.setOpacity(m_opacityCached);
+                m_textSelection.setOpacity(m_opacityCached);
+                m_defaultText.setOpacity(m_opacityCached);
+                m_textSuffix.setOpacity(m_opacityCached);
+
+                m_sprite.setOpacity(m_opacityCached);
+                m_spriteHover.setOpacity(m_opacityCached);
+                m_spriteDisabled.setOpacity(m_opacityCached);
+                m_spriteFocused.setOpacity(m_opacityCached);
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "font")
+            {
+                Widget::rendererChanged(property);
+
+                m_textBeforeSelection.setFont(m_fontCached);
+                m_textSelection.setFont(m_fontCached);
+                m_textAfterSelection.setFont(m_fontCached);
+                m_textSuffix.setFont(m_fontCached);
+                m_textFull.setFont(m_fontCached);
+                m_defaultText.setFont(m_fontCached);
+
+                // Recalculate the text size and position
+                setText(m_text);
+                return;
+            }
         }
-        else
-            Widget::rendererChanged(property);
+
+        // The property isn't handled by this widget, or an unknown name only shares the hash of a known property
+        Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1184,9 +1239,9 @@ namespace tgui
         if (node->propertyValuePairs["maximumcharacters"])
             setMaximumCharacters(strToInt(node->propertyValuePairs["maximumcharacters"]->value));
         if (node->propertyValuePairs["textwidthlimited"])
-            limitTextWidth(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["textwidthlimited"]->value).getBool());
+            limitTextWidth(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["textwidthlimited"]).getBool());
         if (node->propertyValuePairs["readonly"])
-            setReadOnly(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["readonly"]->value).getBool());
+            setReadOnly(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["readonly"]).getBool());
         if (node->propertyValuePairs["suffix"])
             setSuffix(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["suffix"]->value).getString());
         if (node->propertyValuePairs["passwordcharacter"])
@@ -1504,6 +1559,10 @@ namespace tgui
             // Too slow for double clicking
             m_possibleDoubleClick = false;
         }
+
+        // Keep blinking the caret while the widget is focused
+        if (m_focused)
+            scheduleUpdate(sf::milliseconds(500) - m_animationTimeElapsed);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,11 +25,22 @@
 
 #include <TGUI/Widgets/Grid.hpp>
 #include <TGUI/SignalImpl.hpp>
+#include <algorithm>
+#include <limits>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    static Vector2f getCellSize(const Widget::Ptr& widget, const Padding& padding)
+    {
+        if (!widget)
+            return {0, 0};
+
+        return {widget->getFullSize().x + padding.getLeft() + padding.getRight(),
+                widget->getFullSize().y + padding.getTop() + padding.getBottom()};
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Grid::Grid()
@@ -43,18 +54,16 @@ namespace tgui
         Container {gridToCopy},
         m_autoSize{gridToCopy.m_autoSize}
     {
-        for (std::size_t row = 0; row < gridToCopy.m_gridWidgets.size(); ++row)
+        // The copied widgets are in the same order as the original ones
+        for (std::size_t i = 0; i < gridToCopy.m_widgets.size(); ++i)
         {
-            for (std::size_t col = 0; col < gridToCopy.m_gridWidgets[row].size(); ++col)
-            {
-                // Find the widget that belongs in this square
-                for (std::size_t i = 0; i < gridToCopy.m_widgets.size(); ++i)
-                {
-                    // If a widget matches then add it to the grid
-                    if (gridToCopy.m_widgets[i] == gridToCopy.m_gridWidgets[row][col])
-                        addWidget(m_widgets[i], row, col, gridToCopy.m_objPadding[row][col], gridToCopy.m_objAlignment[row][col]);
-                }
-            }
+            const auto locationIt = gridToCopy.m_widgetLocations.find(gridToCopy.m_widgets[i].get());
+            if (locationIt == gridToCopy.m_widgetLocations.end())
+                continue;
+
+            const auto& location = locationIt->second;
+            const auto& cell = gridToCopy.m_cells[location.row * gridToCopy.m_columnWidth.size() + location.column];
+            addWidget(m_widgets[i], location.row, location.column, cell.padding, cell.alignment);
         }
     }
 
@@ -63,18 +72,29 @@ namespace tgui
     Grid::Grid(Grid&& gridToMove) :
         Container           {std::move(gridToMove)},
         m_autoSize          {std::move(gridToMove.m_autoSize)},
-        m_gridWidgets       {std::move(gridToMove.m_gridWidgets)},
-        m_objPadding        {std::move(gridToMove.m_objPadding)},
-        m_objAlignment      {std::move(gridToMove.m_objAlignment)},
+        m_cells             {std::move(gridToMove.m_cells)},
         m_rowHeight         {std::move(gridToMove.m_rowHeight)},
         m_columnWidth       {std::move(gridToMove.m_columnWidth)},
-        m_connectedCallbacks{}
+        m_widgetLocations   {std::move(gridToMove.m_widgetLocations)},
+        m_rowHeightOutdated {std::move(gridToMove.m_rowHeightOutdated)},
+        m_columnWidthOutdated{std::move(gridToMove.m_columnWidthOutdated)},
+        m_firstChangedRow   {gridToMove.m_firstChangedRow},
+        m_firstChangedColumn{gridToMove.m_firstChangedColumn},
+        m_changedCells      {std::move(gridToMove.m_changedCells)},
+        m_prevStartPosition {gridToMove.m_prevStartPosition},
+        m_prevExtraOffset   {gridToMove.m_prevExtraOffset}
     {
-        for (auto& widget : m_widgets)
+        for (auto& pair : m_widgetLocations)
         {
-            widget->disconnect(gridToMove.m_connectedCallbacks[widget]);
-            m_connectedCallbacks[widget] = widget->connect("SizeChanged", [this](){ updateWidgets(); });
+            pair.first->disconnect(pair.second.callbackId);
+            pair.second.callbackId = pair.first->connect("SizeChanged", [this,widget=pair.first](){ widgetSizeChanged(widget); });
         }
+
+        gridToMove.m_cells.clear();
+        gridToMove.m_rowHeight.clear();
+        gridToMove.m_columnWidth.clear();
+        gridToMove.m_widgetLocations.clear();
+        gridToMove.m_gridWidgetsValid = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -84,22 +104,20 @@ namespace tgui
         // Make sure it is not the same widget
         if (this != &right)
         {
+            clearCells();
+
             Container::operator=(right);
             m_autoSize = right.m_autoSize;
-            m_connectedCallbacks.clear();
 
-            for (std::size_t row = 0; row < right.m_gridWidgets.size(); ++row)
+            for (std::size_t i = 0; i < right.m_widgets.size(); ++i)
             {
-                for (std::size_t col = 0; col < right.m_gridWidgets[row].size(); ++col)
-                {
-                    // Find the widget that belongs in this square
-                    for (std::size_t i = 0; i < right.m_widgets.size(); ++i)
-                    {
-                        // If a widget matches then add it to the grid
-                        if (right.m_widgets[i] == right.m_gridWidgets[row][col])
-                            addWidget(m_widgets[i], row, col, right.m_objPadding[row][col], right.m_objAlignment[row][col]);
-                    }
-                }
+                const auto locationIt = right.m_widgetLocations.find(right.m_widgets[i].get());
+                if (locationIt == right.m_widgetLocations.end())
+                    continue;
+
+                const auto& location = locationIt->second;
+                const auto& cell = right.m_cells[location.row * right.m_columnWidth.size() + location.column];
+                addWidget(m_widgets[i], location.row, location.column, cell.padding, cell.alignment);
             }
         }
 
@@ -112,20 +130,33 @@ namespace tgui
     {
         if (this != &right)
         {
+            clearCells();
+
             Container::operator=(std::move(right));
-            m_autoSize           = std::move(right.m_autoSize);
-            m_gridWidgets        = std::move(right.m_gridWidgets);
-            m_objPadding         = std::move(right.m_objPadding);
-            m_objAlignment       = std::move(right.m_objAlignment);
-            m_rowHeight          = std::move(right.m_rowHeight);
-            m_columnWidth        = std::move(right.m_columnWidth);
-            m_connectedCallbacks = std::move(right.m_connectedCallbacks);
-
-            for (auto& widget : m_widgets)
+            m_autoSize            = std::move(right.m_autoSize);
+            m_cells               = std::move(right.m_cells);
+            m_rowHeight           = std::move(right.m_rowHeight);
+            m_columnWidth         = std::move(right.m_columnWidth);
+            m_widgetLocations     = std::move(right.m_widgetLocations);
+            m_rowHeightOutdated   = std::move(right.m_rowHeightOutdated);
+            m_columnWidthOutdated = std::move(right.m_columnWidthOutdated);
+            m_firstChangedRow     = right.m_firstChangedRow;
+            m_firstChangedColumn  = right.m_firstChangedColumn;
+            m_changedCells        = std::move(right.m_changedCells);
+            m_prevStartPosition   = right.m_prevStartPosition;
+            m_prevExtraOffset     = right.m_prevExtraOffset;
+
+            for (auto& pair : m_widgetLocations)
             {
-                widget->disconnect(right.m_connectedCallbacks[widget]);
-                m_connectedCallbacks[widget] = widget->connect("SizeChanged", [this](){ updateWidgets(); });
+                pair.first->disconnect(pair.second.callbackId);
+                pair.second.callbackId = pair.first->connect("SizeChanged", [this,widget=pair.first](){ widgetSizeChanged(widget); });
             }
+
+            right.m_cells.clear();
+            right.m_rowHeight.clear();
+            right.m_columnWidth.clear();
+            right.m_widgetLocations.clear();
+            right.m_gridWidgetsValid = false;
         }
 
         return *this;
@@ -181,57 +212,14 @@ namespace tgui
 
     bool Grid::remove(const Widget::Ptr& widget)
     {
-        const auto callbackIt = m_connectedCallbacks.find(widget);
-        if (callbackIt != m_connectedCallbacks.end())
+        const auto locationIt = m_widgetLocations.find(widget.get());
+        if (locationIt != m_widgetLocations.end())
         {
-            widget->disconnect(callbackIt->second);
-            m_connectedCallbacks.erase(callbackIt);
-        }
-
-        // Find the widget in the grid
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
-        {
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col] == widget)
-                {
-                    // Remove the widget from the grid
-                    m_gridWidgets[row].erase(m_gridWidgets[row].begin() + col);
-                    m_objPadding[row].erase(m_objPadding[row].begin() + col);
-                    m_objAlignment[row].erase(m_objAlignment[row].begin() + col);
-
-                    // Check if this is the last column
-                    if (m_columnWidth.size() == m_gridWidgets[row].size() + 1)
-                    {
-                        // Check if there is another row with this many columns
-                        bool rowFound = false;
-                        for (std::size_t i = 0; i < m_gridWidgets.size(); ++i)
-                        {
-                            if (m_gridWidgets[i].size() >= m_columnWidth.size())
-                            {
-                                rowFound = true;
-                                break;
-                            }
-                        }
-
-                        // Erase the last column if no other row is using it
-                        if (!rowFound)
-                            m_columnWidth.erase(m_columnWidth.end()-1);
-                    }
-
-                    // If the row is empty then remove it as well
-                    if (m_gridWidgets[row].empty())
-                    {
-                        m_gridWidgets.erase(m_gridWidgets.begin() + row);
-                        m_objPadding.erase(m_objPadding.begin() + row);
-                        m_objAlignment.erase(m_objAlignment.begin() + row);
-                        m_rowHeight.erase(m_rowHeight.begin() + row);
-                    }
-
-                    // Update the positions of all remaining widgets
-                    updatePositionsOfAllWidgets();
-                }
-            }
+            const CellLocation location = locationIt->second;
+            removeWidgetFromCell(widget.get());
+            removeCell(location.row, location.column);
+            removeEmptyRowsAndColumns();
+            invalidateLayout();
         }
 
         return Container::remove(widget);
@@ -241,16 +229,9 @@ namespace tgui
 
     void Grid::removeAllWidgets()
     {
-        Container::removeAllWidgets();
-
-        m_gridWidgets.clear();
-        m_objPadding.clear();
-        m_objAlignment.clear();
-
-        m_rowHeight.clear();
-        m_columnWidth.clear();
+        clearCells();
 
-        m_connectedCallbacks.clear();
+        Container::removeAllWidgets();
 
         updateWidgets();
     }
@@ -260,51 +241,39 @@ namespace tgui
     void Grid::addWidget(const Widget::Ptr& widget, std::size_t row, std::size_t col, const Padding& padding, Alignment alignment)
     {
         // If the widget hasn't already been added then add it now
-        if (std::find(getWidgets().begin(), getWidgets().end(), widget) == getWidgets().end())
+        if (widget->getParent() != this)
             add(widget);
 
-        // Create the row if it did not exist yet
-        if (m_gridWidgets.size() < row + 1)
-        {
-            m_gridWidgets.resize(row + 1);
-            m_objPadding.resize(row + 1);
-            m_objAlignment.resize(row + 1);
-        }
-
-        // Create the column if it did not exist yet
-        if (m_gridWidgets[row].size() < col + 1)
-        {
-            m_gridWidgets[row].resize(col + 1, nullptr);
-            m_objPadding[row].resize(col + 1);
-            m_objAlignment[row].resize(col + 1);
-        }
-
-        // If this is a new row then reserve some space for it
-        if (m_rowHeight.size() < row + 1)
-            m_rowHeight.resize(row + 1, 0);
+        // A widget can only be placed in one cell
+        if (m_widgetLocations.find(widget.get()) != m_widgetLocations.end())
+            removeWidgetFromCell(widget.get());
 
-        // If this is the first row to have so many columns then reserve some space for it
-        if (m_columnWidth.size() < col + 1)
-            m_columnWidth.resize(col + 1, 0);
+        createCell(row, col);
 
-        // Add the widget to the grid
-        m_gridWidgets[row][col] = widget;
-        m_objPadding[row][col] = padding;
-        m_objAlignment[row][col] = alignment;
+        // If there was another widget in the cell then it is no longer part of the grid, although it remains a child widget
+        GridCell& cell = m_cells[row * m_columnWidth.size() + col];
+        if (cell.widget)
+            removeWidgetFromCell(cell.widget.get());
 
-        // Update the widgets
-        updateWidgets();
+        cell.widget = widget;
+        cell.padding = padding;
+        cell.alignment = alignment;
+        m_gridWidgetsValid = false;
 
         // Automatically update the widgets when their size changes
-        m_connectedCallbacks[widget] = widget->connect("SizeChanged", [this](){ updateWidgets(); });
+        const unsigned int callbackId = widget->connect("SizeChanged", [this,widget=widget.get()](){ widgetSizeChanged(widget); });
+        m_widgetLocations[widget.get()] = {row, col, callbackId};
+
+        cellChanged(row, col);
+        invalidateLayout();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Widget::Ptr Grid::getWidget(std::size_t row, std::size_t col) const
     {
-        if ((row < m_gridWidgets.size()) && (col < m_gridWidgets[row].size()))
-            return m_gridWidgets[row][col];
+        if ((row < m_rowHeight.size()) && (col < m_columnWidth.size()))
+            return m_cells[row * m_columnWidth.size() + col].widget;
         else
             return nullptr;
     }
@@ -314,15 +283,8 @@ namespace tgui
     std::map<Widget::Ptr, std::pair<std::size_t, std::size_t>> Grid::getWidgetLocations() const
     {
         std::map<Widget::Ptr, std::pair<std::size_t, std::size_t>> widgetsMap;
-
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
-        {
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col])
-                    widgetsMap[m_gridWidgets[row][col]] = {row, col};
-            }
-        }
+        for (const auto& pair : m_widgetLocations)
+            widgetsMap[m_cells[pair.second.row * m_columnWidth.size() + pair.second.column].widget] = {pair.second.row, pair.second.column};
 
         return widgetsMap;
     }
@@ -331,28 +293,23 @@ namespace tgui
 
     void Grid::setWidgetPadding(const Widget::Ptr& widget, const Padding& padding)
     {
-        // Find the widget in the grid
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
-        {
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col] == widget)
-                    setWidgetPadding(row, col, padding);
-            }
-        }
+        const auto locationIt = m_widgetLocations.find(widget.get());
+        if (locationIt != m_widgetLocations.end())
+            setWidgetPadding(locationIt->second.row, locationIt->second.column, padding);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Grid::setWidgetPadding(std::size_t row, std::size_t col, const Padding& padding)
     {
-        if (((row < m_gridWidgets.size()) && (col < m_gridWidgets[row].size())) && (m_gridWidgets[row][col] != nullptr))
+        if (getWidget(row, col) != nullptr)
         {
             // Change padding of the widget
-            m_objPadding[row][col] = padding;
+            m_cells[row * m_columnWidth.size() + col].padding = padding;
 
-            // Update all widgets
-            updateWidgets();
+            // Update the widgets in the affected row and column
+            cellChanged(row, col);
+            invalidateLayout();
         }
     }
 
@@ -360,15 +317,9 @@ namespace tgui
 
     Padding Grid::getWidgetPadding(const Widget::Ptr& widget) const
     {
-        // Find the widget in the grid
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
-        {
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col] == widget)
-                    return getWidgetPadding(row, col);
-            }
-        }
+        const auto locationIt = m_widgetLocations.find(widget.get());
+        if (locationIt != m_widgetLocations.end())
+            return getWidgetPadding(locationIt->second.row, locationIt->second.column);
 
         return {};
     }
@@ -377,8 +328,8 @@ namespace tgui
 
     Padding Grid::getWidgetPadding(std::size_t row, std::size_t col) const
     {
-        if (((row < m_gridWidgets.size()) && (col < m_gridWidgets[row].size())) && (m_gridWidgets[row][col] != nullptr))
-            return m_objPadding[row][col];
+        if (getWidget(row, col) != nullptr)
+            return m_cells[row * m_columnWidth.size() + col].padding;
         else
             return {};
     }
@@ -387,25 +338,21 @@ namespace tgui
 
     void Grid::setWidgetAlignment(const Widget::Ptr& widget, Alignment alignment)
     {
-        // Find the widget in the grid
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
-        {
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col] == widget)
-                    setWidgetAlignment(row, col, alignment);
-            }
-        }
+        const auto locationIt = m_widgetLocations.find(widget.get());
+        if (locationIt != m_widgetLocations.end())
+            setWidgetAlignment(locationIt->second.row, locationIt->second.column, alignment);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Grid::setWidgetAlignment(std::size_t row, std::size_t col, Alignment alignment)
     {
-        if (((row < m_gridWidgets.size()) && (col < m_gridWidgets[row].size())) && (m_gridWidgets[row][col] != nullptr))
+        if (getWidget(row, col) != nullptr)
         {
-            m_objAlignment[row][col] = alignment;
-            updatePositionsOfAllWidgets();
+            // The alignment doesn't influence the size of the row and column, only this widget has to be moved
+            m_cells[row * m_columnWidth.size() + col].alignment = alignment;
+            m_changedCells.emplace_back(row, col);
+            invalidateLayout();
         }
     }
 
@@ -413,14 +360,9 @@ namespace tgui
 
     Grid::Alignment Grid::getWidgetAlignment(const Widget::Ptr& widget) const
     {
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
-        {
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col] == widget)
-                    return getWidgetAlignment(row, col);
-            }
-        }
+        const auto locationIt = m_widgetLocations.find(widget.get());
+        if (locationIt != m_widgetLocations.end())
+            return getWidgetAlignment(locationIt->second.row, locationIt->second.column);
 
         return Alignment::Center;
     }
@@ -429,8 +371,8 @@ namespace tgui
 
     Grid::Alignment Grid::getWidgetAlignment(std::size_t row, std::size_t col) const
     {
-        if (((row < m_gridWidgets.size()) && (col < m_gridWidgets[row].size())) && (m_gridWidgets[row][col] != nullptr))
-            return m_objAlignment[row][col];
+        if (getWidget(row, col) != nullptr)
+            return m_cells[row * m_columnWidth.size() + col].alignment;
         else
             return Alignment::Center;
     }
@@ -439,6 +381,24 @@ namespace tgui
 
     const std::vector<std::vector<Widget::Ptr>>& Grid::getGridWidgets() const
     {
+        if (!m_gridWidgetsValid)
+        {
+            // Each row ends at the last widget in it
+            m_gridWidgets.clear();
+            m_gridWidgets.resize(m_rowHeight.size());
+            for (std::size_t row = 0; row < m_rowHeight.size(); ++row)
+            {
+                std::size_t rowLength = m_columnWidth.size();
+                while ((rowLength > 0) && !m_cells[row * m_columnWidth.size() + rowLength - 1].widget)
+                    --rowLength;
+
+                for (std::size_t col = 0; col < rowLength; ++col)
+                    m_gridWidgets[row].push_back(m_cells[row * m_columnWidth.size() + col].widget);
+            }
+
+            m_gridWidgetsValid = true;
+        }
+
         return m_gridWidgets;
     }
 
@@ -524,7 +484,7 @@ namespace tgui
         Container::load(node, renderers);
 
         if (node->propertyValuePairs["autosize"])
-            setAutoSize(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["autosize"]->value).getBool());
+            setAutoSize(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["autosize"]).getBool());
 
         if (node->propertyValuePairs["gridwidgets"])
         {
@@ -619,6 +579,8 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2f Grid::getMinimumSize() const
     {
         // Calculate the required space to have all widgets in the grid.
@@ -639,7 +601,71 @@ namespace tgui
 
     void Grid::updatePositionsOfAllWidgets()
     {
-        Vector2f position;
+        m_firstChangedRow = 0;
+        m_firstChangedColumn = 0;
+        invalidateLayout();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::updateWidgets()
+    {
+        const std::size_t columnCount = m_columnWidth.size();
+
+        // Recalculate the rows and columns that may have become smaller
+        for (std::size_t row = 0; row < m_rowHeight.size(); ++row)
+        {
+            if (!m_rowHeightOutdated[row])
+                continue;
+
+            float rowHeight = 0;
+            for (std::size_t col = 0; col < columnCount; ++col)
+            {
+                const GridCell& cell = m_cells[row * columnCount + col];
+                rowHeight = std::max(rowHeight, getCellSize(cell.widget, cell.padding).y);
+            }
+
+            if (m_rowHeight[row] != rowHeight)
+            {
+                m_rowHeight[row] = rowHeight;
+                m_firstChangedRow = std::min(m_firstChangedRow, row);
+            }
+
+            m_rowHeightOutdated[row] = false;
+        }
+
+        for (std::size_t col = 0; col < columnCount; ++col)
+        {
+            if (!m_columnWidthOutdated[col])
+                continue;
+
+            float columnWidth = 0;
+            for (std::size_t row = 0; row < m_rowHeight.size(); ++row)
+            {
+                const GridCell& cell = m_cells[row * columnCount + col];
+                columnWidth = std::max(columnWidth, getCellSize(cell.widget, cell.padding).x);
+            }
+
+            if (m_columnWidth[col] != columnWidth)
+            {
+                m_columnWidth[col] = columnWidth;
+                m_firstChangedColumn = std::min(m_firstChangedColumn, col);
+            }
+
+            m_columnWidthOutdated[col] = false;
+        }
+
+        if (m_autoSize)
+            Container::setSize(getMinimumSize());
+
+        positionWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::positionWidgets()
+    {
+        Vector2f startPosition;
 
         // Fill the entire space when a size was given
         Vector2f extraOffset;
@@ -651,7 +677,7 @@ namespace tgui
                 if (m_columnWidth.size() > 1)
                     extraOffset.x = (getSize().x - minimumSize.x) / (m_columnWidth.size() - 1);
                 else
-                    position.x += (getSize().x - minimumSize.x) / 2.f;
+                    startPosition.x += (getSize().x - minimumSize.x) / 2.f;
             }
 
             if (getSize().y > minimumSize.y)
@@ -659,127 +685,330 @@ namespace tgui
                 if (m_rowHeight.size() > 1)
                     extraOffset.y = (getSize().y - minimumSize.y) / (m_rowHeight.size() - 1);
                 else
-                    position.y += (getSize().y - minimumSize.y) / 2.f;
+                    startPosition.y += (getSize().y - minimumSize.y) / 2.f;
             }
         }
 
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
+        // When the space between the cells changes then all widgets move
+        if ((startPosition != m_prevStartPosition) || (extraOffset != m_prevExtraOffset))
         {
-            const Vector2f previousPosition = position;
+            m_firstChangedRow = 0;
+            m_firstChangedColumn = 0;
+            m_prevStartPosition = startPosition;
+            m_prevExtraOffset = extraOffset;
+        }
 
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
+        const std::size_t rowCount = m_rowHeight.size();
+        const std::size_t columnCount = m_columnWidth.size();
+        if ((m_firstChangedRow >= rowCount) && (m_firstChangedColumn >= columnCount) && m_changedCells.empty())
+            return;
+
+        std::vector<float> columnLeft(columnCount);
+        float left = startPosition.x;
+        for (std::size_t col = 0; col < columnCount; ++col)
+        {
+            columnLeft[col] = left;
+            left += m_columnWidth[col] + extraOffset.x;
+        }
+
+        std::vector<float> rowTop(rowCount);
+        float top = startPosition.y;
+        for (std::size_t row = 0; row < rowCount; ++row)
+        {
+            rowTop[row] = top;
+            top += m_rowHeight[row] + extraOffset.y;
+        }
+
+        const auto positionWidget = [&](std::size_t row, std::size_t col)
             {
-                if (m_gridWidgets[row][col].get() == nullptr)
-                {
-                    position.x += m_columnWidth[col] + extraOffset.x;
-                    continue;
-                }
+                const GridCell& cell = m_cells[row * columnCount + col];
+                if (!cell.widget)
+                    return;
 
-                Vector2f cellPosition = position;
-                switch (m_objAlignment[row][col])
+                const Vector2f widgetSize = cell.widget->getFullSize();
+                Vector2f cellPosition{columnLeft[col], rowTop[row]};
+                switch (cell.alignment)
                 {
                 case Alignment::UpperLeft:
-                    cellPosition.x += m_objPadding[row][col].getLeft();
-                    cellPosition.y += m_objPadding[row][col].getTop();
+                    cellPosition.x += cell.padding.getLeft();
+                    cellPosition.y += cell.padding.getTop();
                     break;
 
                 case Alignment::Up:
-                    cellPosition.x += m_objPadding[row][col].getLeft() + (((m_columnWidth[col] - m_objPadding[row][col].getLeft() - m_objPadding[row][col].getRight()) - m_gridWidgets[row][col]->getFullSize().x) / 2.f);
-                    cellPosition.y += m_objPadding[row][col].getTop();
+                    cellPosition.x += cell.padding.getLeft() + (((m_columnWidth[col] - cell.padding.getLeft() - cell.padding.getRight()) - widgetSize.x) / 2.f);
+                    cellPosition.y += cell.padding.getTop();
                     break;
 
                 case Alignment::UpperRight:
-                    cellPosition.x += m_columnWidth[col] - m_objPadding[row][col].getRight() - m_gridWidgets[row][col]->getFullSize().x;
-                    cellPosition.y += m_objPadding[row][col].getTop();
+                    cellPosition.x += m_columnWidth[col] - cell.padding.getRight() - widgetSize.x;
+                    cellPosition.y += cell.padding.getTop();
                     break;
 
                 case Alignment::Right:
-                    cellPosition.x += m_columnWidth[col] - m_objPadding[row][col].getRight() - m_gridWidgets[row][col]->getFullSize().x;
-                    cellPosition.y += m_objPadding[row][col].getTop() + (((m_rowHeight[row] - m_objPadding[row][col].getTop() - m_objPadding[row][col].getBottom()) - m_gridWidgets[row][col]->getFullSize().y) / 2.f);
+                    cellPosition.x += m_columnWidth[col] - cell.padding.getRight() - widgetSize.x;
+                    cellPosition.y += cell.padding.getTop() + (((m_rowHeight[row] - cell.padding.getTop() - cell.padding.getBottom()) - widgetSize.y) / 2.f);
                     break;
 
                 case Alignment::BottomRight:
-                    cellPosition.x += m_columnWidth[col] - m_objPadding[row][col].getRight() - m_gridWidgets[row][col]->getFullSize().x;
-                    cellPosition.y += m_rowHeight[row] - m_objPadding[row][col].getBottom() - m_gridWidgets[row][col]->getFullSize().y;
+                    cellPosition.x += m_columnWidth[col] - cell.padding.getRight() - widgetSize.x;
+                    cellPosition.y += m_rowHeight[row] - cell.padding.getBottom() - widgetSize.y;
                     break;
 
                 case Alignment::Bottom:
-                    cellPosition.x += m_objPadding[row][col].getLeft() + (((m_columnWidth[col] - m_objPadding[row][col].getLeft() - m_objPadding[row][col].getRight()) - m_gridWidgets[row][col]->getFullSize().x) / 2.f);
-                    cellPosition.y += m_rowHeight[row] - m_objPadding[row][col].getBottom() - m_gridWidgets[row][col]->getFullSize().y;
+                    cellPosition.x += cell.padding.getLeft() + (((m_columnWidth[col] - cell.padding.getLeft() - cell.padding.getRight()) - widgetSize.x) / 2.f);
+                    cellPosition.y += m_rowHeight[row] - cell.padding.getBottom() - widgetSize.y;
                     break;
 
                 case Alignment::BottomLeft:
-                    cellPosition.x += m_objPadding[row][col].getLeft();
-                    cellPosition.y += m_rowHeight[row] - m_objPadding[row][col].getBottom() - m_gridWidgets[row][col]->getFullSize().y;
+                    cellPosition.x += cell.padding.getLeft();
+                    cellPosition.y += m_rowHeight[row] - cell.padding.getBottom() - widgetSize.y;
                     break;
 
                 case Alignment::Left:
-                    cellPosition.x += m_objPadding[row][col].getLeft();
-                    cellPosition.y += m_objPadding[row][col].getTop() + (((m_rowHeight[row] - m_objPadding[row][col].getTop() - m_objPadding[row][col].getBottom()) - m_gridWidgets[row][col]->getFullSize().y) / 2.f);
+                    cellPosition.x += cell.padding.getLeft();
+                    cellPosition.y += cell.padding.getTop() + (((m_rowHeight[row] - cell.padding.getTop() - cell.padding.getBottom()) - widgetSize.y) / 2.f);
                     break;
 
                 case Alignment::Center:
-                    cellPosition.x += m_objPadding[row][col].getLeft() + (((m_columnWidth[col] - m_objPadding[row][col].getLeft() - m_objPadding[row][col].getRight()) - m_gridWidgets[row][col]->getFullSize().x) / 2.f);
-                    cellPosition.y += m_objPadding[row][col].getTop() + (((m_rowHeight[row] - m_objPadding[row][col].getTop() - m_objPadding[row][col].getBottom()) - m_gridWidgets[row][col]->getFullSize().y) / 2.f);
+                    cellPosition.x += cell.padding.getLeft() + (((m_columnWidth[col] - cell.padding.getLeft() - cell.padding.getRight()) - widgetSize.x) / 2.f);
+                    cellPosition.y += cell.padding.getTop() + (((m_rowHeight[row] - cell.padding.getTop() - cell.padding.getBottom()) - widgetSize.y) / 2.f);
                     break;
                 }
 
-                m_gridWidgets[row][col]->setPosition(cellPosition);
-                position.x += m_columnWidth[col] + extraOffset.x;
-            }
+                cell.widget->setPosition(cellPosition);
+            };
 
-            // Move to the next row
-            position = previousPosition;
-            position.y += m_rowHeight[row] + extraOffset.y;
+        // A row or column that changed size moves the widgets inside it and all widgets below or to the right of it
+        for (std::size_t row = 0; row < rowCount; ++row)
+        {
+            const std::size_t firstColumn = (row >= m_firstChangedRow) ? 0 : m_firstChangedColumn;
+            for (std::size_t col = firstColumn; col < columnCount; ++col)
+                positionWidget(row, col);
         }
+
+        // Widgets that changed inside a row and column that kept their size only have to be moved themselves
+        for (const auto& changedCell : m_changedCells)
+        {
+            if ((changedCell.first < std::min(m_firstChangedRow, rowCount)) && (changedCell.second < std::min(m_firstChangedColumn, columnCount)))
+                positionWidget(changedCell.first, changedCell.second);
+        }
+
+        m_firstChangedRow = std::numeric_limits<std::size_t>::max();
+        m_firstChangedColumn = std::numeric_limits<std::size_t>::max();
+        m_changedCells.clear();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Grid::updateWidgets()
+    void Grid::invalidateLayout()
     {
-        // Reset the column widths
-        for (float& width : m_columnWidth)
-            width = 0;
+        if (!scheduleChildLayoutUpdate())
+            updateWidgets();
+    }
 
-        // Loop through all widgets
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::updateChildLayout()
+    {
+        updateWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::widgetSizeChanged(Widget* widget)
+    {
+        const auto locationIt = m_widgetLocations.find(widget);
+        if (locationIt == m_widgetLocations.end())
+            return;
+
+        cellChanged(locationIt->second.row, locationIt->second.column);
+        invalidateLayout();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::cellChanged(std::size_t row, std::size_t col)
+    {
+        const GridCell& cell = m_cells[row * m_columnWidth.size() + col];
+        const Vector2f cellSize = getCellSize(cell.widget, cell.padding);
+
+        if (cellSize.x > m_columnWidth[col])
         {
-            // Reset the row height
-            m_rowHeight[row] = 0;
+            m_columnWidth[col] = cellSize.x;
+            m_firstChangedColumn = std::min(m_firstChangedColumn, col);
+        }
+        else if (cellSize.x < m_columnWidth[col]) // The cell might have been the widest one in the column
+            m_columnWidthOutdated[col] = true;
 
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col].get() == nullptr)
-                    continue;
+        if (cellSize.y > m_rowHeight[row])
+        {
+            m_rowHeight[row] = cellSize.y;
+            m_firstChangedRow = std::min(m_firstChangedRow, row);
+        }
+        else if (cellSize.y < m_rowHeight[row]) // The cell might have been the highest one in the row
+            m_rowHeightOutdated[row] = true;
+
+        m_changedCells.emplace_back(row, col);
+    }
 
-                // Remember the biggest column width
-                if (m_columnWidth[col] < m_gridWidgets[row][col]->getFullSize().x + m_objPadding[row][col].getLeft() + m_objPadding[row][col].getRight())
-                    m_columnWidth[col] = m_gridWidgets[row][col]->getFullSize().x + m_objPadding[row][col].getLeft() + m_objPadding[row][col].getRight();
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                // Remember the biggest row height
-                if (m_rowHeight[row] < m_gridWidgets[row][col]->getFullSize().y + m_objPadding[row][col].getTop() + m_objPadding[row][col].getBottom())
-                    m_rowHeight[row] = m_gridWidgets[row][col]->getFullSize().y + m_objPadding[row][col].getTop() + m_objPadding[row][col].getBottom();
+    void Grid::createCell(std::size_t row, std::size_t col)
+    {
+        const std::size_t columnCount = m_columnWidth.size();
+        if (col >= columnCount)
+        {
+            // The cells are stored row by row, so the existing cells have to be moved when the rows become longer
+            std::vector<GridCell> cells(m_rowHeight.size() * (col + 1));
+            for (std::size_t r = 0; r < m_rowHeight.size(); ++r)
+            {
+                for (std::size_t c = 0; c < columnCount; ++c)
+                    cells[r * (col + 1) + c] = std::move(m_cells[r * columnCount + c]);
             }
+
+            m_cells = std::move(cells);
+            m_columnWidth.resize(col + 1, 0);
+            m_columnWidthOutdated.resize(col + 1, false);
+            m_gridWidgetsValid = false;
         }
 
-        if (m_autoSize)
+        if (row >= m_rowHeight.size())
+        {
+            m_rowHeight.resize(row + 1, 0);
+            m_rowHeightOutdated.resize(row + 1, false);
+            m_cells.resize(m_rowHeight.size() * m_columnWidth.size());
+            m_gridWidgetsValid = false;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::removeWidgetFromCell(Widget* widget)
+    {
+        const auto locationIt = m_widgetLocations.find(widget);
+        if (locationIt == m_widgetLocations.end())
+            return;
+
+        const CellLocation location = locationIt->second;
+        widget->disconnect(location.callbackId);
+        m_widgetLocations.erase(locationIt);
+
+        m_cells[location.row * m_columnWidth.size() + location.column] = {};
+        m_gridWidgetsValid = false;
+
+        cellChanged(location.row, location.column);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::removeCell(std::size_t row, std::size_t col)
+    {
+        const std::size_t columnCount = m_columnWidth.size();
+
+        // The cells behind the removed one in the same row move one column to the left
+        for (std::size_t c = col; c + 1 < columnCount; ++c)
         {
-            Vector2f size;
-            for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
+            GridCell& cell = m_cells[row * columnCount + c];
+            cell = std::move(m_cells[row * columnCount + c + 1]);
+            if (cell.widget)
+                m_widgetLocations.find(cell.widget.get())->second.column = c;
+        }
+        m_cells[row * columnCount + columnCount - 1] = {};
+
+        // A row without any widgets left is removed and the rows below it move up
+        const auto rowBegin = m_cells.begin() + row * columnCount;
+        if (std::none_of(rowBegin, rowBegin + columnCount, [](const GridCell& cell){ return cell.widget != nullptr; }))
+        {
+            m_cells.erase(rowBegin, rowBegin + columnCount);
+            m_rowHeight.erase(m_rowHeight.begin() + row);
+            m_rowHeightOutdated.erase(m_rowHeightOutdated.begin() + row);
+            for (auto& pair : m_widgetLocations)
             {
-                float rowWidth = 0;
-                for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-                    rowWidth += m_columnWidth[col];
+                if (pair.second.row > row)
+                    --pair.second.row;
+            }
+
+            col = 0;
+        }
+        else
+            m_rowHeightOutdated[row] = true;
+
+        // The widths of the columns in which widgets moved may have changed and the moved widgets have to be repositioned
+        std::fill(m_columnWidthOutdated.begin() + col, m_columnWidthOutdated.end(), true);
+        m_firstChangedRow = std::min(m_firstChangedRow, row);
+        m_gridWidgetsValid = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::removeEmptyRowsAndColumns()
+    {
+        const std::size_t columnCount = m_columnWidth.size();
 
-                size.x = std::max(size.x, rowWidth);
-                size.y += m_rowHeight[row];
+        std::size_t rowCount = m_rowHeight.size();
+        while (rowCount > 0)
+        {
+            const auto rowBegin = m_cells.begin() + (rowCount - 1) * columnCount;
+            if (std::any_of(rowBegin, rowBegin + columnCount, [](const GridCell& cell){ return cell.widget != nullptr; }))
+                break;
+
+            --rowCount;
+        }
+
+        std::size_t newColumnCount = columnCount;
+        while (newColumnCount > 0)
+        {
+            bool columnEmpty = true;
+            for (std::size_t row = 0; (row < rowCount) && columnEmpty; ++row)
+                columnEmpty = (m_cells[row * columnCount + newColumnCount - 1].widget == nullptr);
+
+            if (!columnEmpty)
+                break;
+
+            --newColumnCount;
+        }
+
+        if ((rowCount == m_rowHeight.size()) && (newColumnCount == columnCount))
+            return;
+
+        if (newColumnCount != columnCount)
+        {
+            std::vector<GridCell> cells(rowCount * newColumnCount);
+            for (std::size_t row = 0; row < rowCount; ++row)
+            {
+                for (std::size_t col = 0; col < newColumnCount; ++col)
+                    cells[row * newColumnCount + col] = std::move(m_cells[row * columnCount + col]);
             }
 
-            Container::setSize(size);
+            m_cells = std::move(cells);
         }
+        else
+            m_cells.resize(rowCount * columnCount);
 
-        updatePositionsOfAllWidgets();
+        m_rowHeight.resize(rowCount);
+        m_rowHeightOutdated.resize(rowCount);
+        m_columnWidth.resize(newColumnCount);
+        m_columnWidthOutdated.resize(newColumnCount);
+        m_gridWidgetsValid = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::clearCells()
+    {
+        for (auto& pair : m_widgetLocations)
+            pair.first->disconnect(pair.second.callbackId);
+
+        m_widgetLocations.clear();
+        m_cells.clear();
+        m_rowHeight.clear();
+        m_columnWidth.clear();
+        m_rowHeightOutdated.clear();
+        m_columnWidthOutdated.clear();
+        m_changedCells.clear();
+        m_firstChangedRow = 0;
+        m_firstChangedColumn = 0;
+        m_gridWidgetsValid = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -789,16 +1018,10 @@ namespace tgui
         states.transform.translate(getPosition());
 
         // Draw all widgets
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
+        for (const auto& cell : m_cells)
         {
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col].get() != nullptr)
-                {
-                    if (m_gridWidgets[row][col]->isVisible())
-                        m_gridWidgets[row][col]->draw(target, states);
-                }
-            }
+            if (cell.widget && cell.widget->isVisible())
+                drawChildWidget(target, states, *cell.widget);
         }
     }
 
@@ -145,13 +145,18 @@ namespace tgui
 
     void Group::rendererChanged(const std::string& property)
     {
-        if (property == "padding")
+        switch (propertyHash(property))
         {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
+            TGUI_PROPERTY_CASE(property, "padding")
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                setSize(m_size);
+                return;
+            }
         }
-        else
-            Container::rendererChanged(property);
+
+        // The property isn't handled by this widget, or an unknown name only shares the hash of a known property
+        Container::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/HorizontalWrap.hpp>
+#include <algorithm>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -59,31 +60,146 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void HorizontalWrap::insert(std::size_t index, const Widget::Ptr& widget, const sf::String& widgetName)
+    {
+        widgetsInserted(index, 1);
+
+        BoxLayout::insert(index, widget, widgetName);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void HorizontalWrap::insertWidgets(std::size_t index, const std::vector<Widget::Ptr>& widgets)
+    {
+        // Widgets that are moved within the layout have to lose their old state before room is made for the new ones
+        index = removeWidgetsBeforeInsert(index, widgets);
+        widgetsInserted(index, widgets.size());
+
+        BoxLayout::insertWidgets(index, widgets);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool HorizontalWrap::remove(std::size_t index)
+    {
+        if (index < m_wrapStates.size())
+        {
+            m_wrapStates.erase(m_wrapStates.begin() + index);
+
+            // Widgets after the removed one could only stop the reflow early if they came after earlier changes
+            if (m_firstUnchangedWidget > index)
+                --m_firstUnchangedWidget;
+            m_firstUnchangedWidget = std::max(m_firstUnchangedWidget, index);
+        }
+
+        return BoxLayout::remove(index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void HorizontalWrap::removeAllWidgets()
+    {
+        m_wrapStates.clear();
+        m_firstUnchangedWidget = 0;
+
+        BoxLayout::removeAllWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void HorizontalWrap::widgetsInserted(std::size_t index, std::size_t count)
+    {
+        index = std::min(index, m_wrapStates.size());
+        m_wrapStates.insert(m_wrapStates.begin() + index, count, WrapState{});
+
+        if (m_firstUnchangedWidget > index)
+            m_firstUnchangedWidget += count;
+        m_firstUnchangedWidget = std::max(m_firstUnchangedWidget, index + count);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void HorizontalWrap::updateWidgets()
     {
         const Vector2f contentSize = {getSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight(),
                                           getSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()};
 
+        // The stored positions can't be reused when the line width or spacing changed or when widgets were added in another way
+        if ((m_wrapStates.size() != m_widgets.size()) || (m_wrapContentWidth != contentSize.x)
+         || (m_wrapSpaceBetweenWidgets != m_spaceBetweenWidgetsCached))
+        {
+            m_wrapStates.assign(m_widgets.size(), WrapState{});
+            m_wrapContentWidth = contentSize.x;
+            m_wrapSpaceBetweenWidgets = m_spaceBetweenWidgetsCached;
+            m_firstChangedWidget = 0;
+        }
+
+        std::size_t firstWidget = std::min(m_firstChangedWidget, m_widgets.size());
+        while ((firstWidget > 0) && !m_wrapStates[firstWidget - 1].valid)
+            --firstWidget;
+
+        // Only a partial update can stop early. The reflow can only stop after the last inserted or removed widget and after
+        // the last widget that changed size since the previous update, as the widgets behind it would otherwise be skipped.
+        const bool canStopEarly = (firstWidget > 0);
+        std::size_t firstUnchangedWidget = m_firstUnchangedWidget;
+        m_firstUnchangedWidget = 0;
+        if (canStopEarly)
+        {
+            for (std::size_t i = m_widgets.size(); i > std::max(firstWidget, firstUnchangedWidget); --i)
+            {
+                const WrapState& state = m_wrapStates[i - 1];
+                if (!state.valid || (state.size != m_widgets[i - 1]->getSize()))
+                {
+                    firstUnchangedWidget = i;
+                    break;
+                }
+            }
+        }
+
+        // Continue from where the previous widget was placed
         float currentHorizontalOffset = 0;
         float currentVerticalOffset = 0;
         float lineHeight = 0;
-        for (const auto& widget : m_widgets)
+        if (firstWidget > 0)
         {
+            const WrapState& prevState = m_wrapStates[firstWidget - 1];
+            currentHorizontalOffset = prevState.position.x + prevState.size.x + m_spaceBetweenWidgetsCached;
+            currentVerticalOffset = prevState.position.y;
+            lineHeight = prevState.lineHeight;
+        }
+
+        for (std::size_t i = firstWidget; i < m_widgets.size(); ++i)
+        {
+            const auto& widget = m_widgets[i];
             const auto size = widget->getSize();
 
+            bool lineStart = (i == 0);
             if (currentHorizontalOffset + size.x > contentSize.x)
             {
                 currentVerticalOffset += lineHeight + m_spaceBetweenWidgetsCached;
                 currentHorizontalOffset = 0;
                 lineHeight = 0;
+                lineStart = true;
             }
 
-            widget->setPosition({currentHorizontalOffset, currentVerticalOffset});
+            // When a line starts at the same place as before then the widgets after it don't move
+            const Vector2f position{currentHorizontalOffset, currentVerticalOffset};
+            WrapState& state = m_wrapStates[i];
+            if (canStopEarly && (i >= firstUnchangedWidget) && lineStart && state.valid && state.lineStart && (state.position == position) && (state.size == size))
+                break;
+
+            widget->setPosition(position);
 
             currentHorizontalOffset += size.x + m_spaceBetweenWidgetsCached;
 
             if (lineHeight < size.y)
                 lineHeight = size.y;
+
+            state.position = position;
+            state.size = size;
+            state.lineHeight = lineHeight;
+            state.lineStart = lineStart;
+            state.valid = true;
         }
     }
 
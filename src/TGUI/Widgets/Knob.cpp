@@ -474,46 +474,65 @@ namespace tgui
 
     void Knob::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
+        switch (propertyHash(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "texturebackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-            setSize(m_size);
-        }
-        else if (property == "textureforeground")
-        {
-            m_spriteForeground.setTexture(getSharedRenderer()->getTextureForeground());
-            setSize(m_size);
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "thumbcolor")
-        {
-            m_thumbColorCached = getSharedRenderer()->getThumbColor();
-        }
-        else if (property == "imagerotation")
-        {
-            m_imageRotationCached = getSharedRenderer()->getImageRotation();
-        }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
-        {
-            Widget::rendererChanged(property);
+            TGUI_PROPERTY_CASE(property, "borders")
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                return;
+            }
 
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_spriteForeground.setOpacity(m_opacityCached);
+            TGUI_PROPERTY_CASE(property, "texturebackground")
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                setSize(m_size);
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "textureforeground")
+            {
+                m_spriteForeground.setTexture(getSharedRenderer()->getTextureForeground());
+                setSize(m_size);
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "bordercolor")
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "backgroundcolor")
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "thumbcolor")
+            {
+                m_thumbColorCached = getSharedRenderer()->getThumbColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "imagerotation")
+            {
+                m_imageRotationCached = getSharedRenderer()->getImageRotation();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "opacity", "opacitydisabled")
+            {
+                Widget::rendererChanged(property);
+
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_spriteForeground.setOpacity(m_opacityCached);
+                return;
+            }
         }
-        else
-            Widget::rendererChanged(property);
+
+        // The property isn't handled by this widget, or an unknown name only shares the hash of a known property
+        Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -549,7 +568,7 @@ namespace tgui
         if (node->propertyValuePairs["value"])
             setValue(strToInt(node->propertyValuePairs["value"]->value));
         if (node->propertyValuePairs["clockwiseturning"])
-            setClockwiseTurning(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["clockwiseturning"]->value).getBool());
+            setClockwiseTurning(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["clockwiseturning"]).getBool());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
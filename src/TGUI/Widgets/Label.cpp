@@ -298,7 +298,7 @@ namespace tgui
                 }
                 else // This is the first click
                 {
-                    m_animationTimeElapsed = {};
+                    restartAnimationTime(sf::milliseconds(getDoubleClickTime()));
                     m_possibleDoubleClick = true;
                 }
             }
@@ -371,88 +371,117 @@ namespace tgui
 
     void Label::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
+        switch (propertyHash(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            m_bordersCached.updateParentSize(getSize());
-            m_spriteBackground.setSize({getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
-                                        getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()});
-            rearrangeText();
-        }
-        else if (property == "padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            m_paddingCached.updateParentSize(getSize());
-            rearrangeText();
-        }
-        else if (property == "textstyle")
-        {
-            m_textStyleCached = getSharedRenderer()->getTextStyle();
-            rearrangeText();
-        }
-        else if (property == "textcolor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            for (auto& line : m_lines)
-                line.setColor(m_textColorCached);
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "texturebackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == "textoutlinethickness")
-        {
-            m_textOutlineThicknessCached = getSharedRenderer()->getTextOutlineThickness();
-            for (auto& line : m_lines)
-                line.setOutlineThickness(m_textOutlineThicknessCached);
-        }
-        else if (property == "textoutlinecolor")
-        {
-            m_textOutlineColorCached = getSharedRenderer()->getTextOutlineColor();
-            for (auto& line : m_lines)
-                line.setOutlineColor(m_textOutlineColorCached);
-        }
-        else if (property == "scrollbar")
-        {
-            m_scrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+            TGUI_PROPERTY_CASE(property, "borders")
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                m_bordersCached.updateParentSize(getSize());
+                m_spriteBackground.setSize({getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
+                                            getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()});
+                rearrangeText();
+                return;
+            }
 
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (!getSharedRenderer()->getScrollbarWidth())
+            TGUI_PROPERTY_CASE(property, "padding")
             {
-                m_scrollbar->setSize({m_scrollbar->getDefaultWidth(), m_scrollbar->getSize().y});
+                m_paddingCached = getSharedRenderer()->getPadding();
+                m_paddingCached.updateParentSize(getSize());
                 rearrangeText();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "textstyle")
+            {
+                m_textStyleCached = getSharedRenderer()->getTextStyle();
+                rearrangeText();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "textcolor")
+            {
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                for (auto& line : m_lines)
+                    line.setColor(m_textColorCached);
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "bordercolor")
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "backgroundcolor")
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturebackground")
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "textoutlinethickness")
+            {
+                m_textOutlineThicknessCached = getSharedRenderer()->getTextOutlineThickness();
+                for (auto& line : m_lines)
+                    line.setOutlineThickness(m_textOutlineThicknessCached);
+                return;
             }
-        }
-        else if (property == "scrollbarwidth")
-        {
-            const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_scrollbar->getDefaultWidth();
-            m_scrollbar->setSize({width, m_scrollbar->getSize().y});
-            rearrangeText();
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
-            rearrangeText();
-        }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
-        {
-            Widget::rendererChanged(property);
 
-            m_spriteBackground.setOpacity(m_opacityCached);
+            TGUI_PROPERTY_CASE(property, "textoutlinecolor")
+            {
+                m_textOutlineColorCached = getSharedRenderer()->getTextOutlineColor();
+                for (auto& line : m_lines)
+                    line.setOutlineColor(m_textOutlineColorCached);
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "scrollbar")
+            {
+                m_scrollbar->setRenderer(getSharedRenderer()->getScrollbar());
 
-            for (auto& line : m_lines)
-                line.setOpacity(m_opacityCached);
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (!getSharedRenderer()->getScrollbarWidth())
+                {
+                    m_scrollbar->setSize({m_scrollbar->getDefaultWidth(), m_scrollbar->getSize().y});
+                    rearrangeText();
+                }
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "scrollbarwidth")
+            {
+                const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_scrollbar->getDefaultWidth();
+                m_scrollbar->setSize({width, m_scrollbar->getSize().y});
+                rearrangeText();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "font")
+            {
+                Widget::rendererChanged(property);
+                rearrangeText();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "opacity", "opacitydisabled")
+            {
+                Widget::rendererChanged(property);
+
+                m_spriteBackground.setOpacity(m_opacityCached);
+
+                for (auto& line : m_lines)
+                    line.setOpacity(m_opacityCached);
+                return;
+            }
         }
-        else
-            Widget::rendererChanged(property);
+
+        // The property isn't handled by this widget, or an unknown name only shares the hash of a known property
+        Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -540,10 +569,10 @@ namespace tgui
         if (node->propertyValuePairs["maximumtextwidth"])
             setMaximumTextWidth(strToFloat(node->propertyValuePairs["maximumtextwidth"]->value));
         if (node->propertyValuePairs["autosize"])
-            setAutoSize(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["autosize"]->value).getBool());
+            setAutoSize(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["autosize"]).getBool());
 
         if (node->propertyValuePairs["ignoremouseevents"])
-            ignoreMouseEvents(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["ignoremouseevents"]->value).getBool());
+            ignoreMouseEvents(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["ignoremouseevents"]).getBool());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -557,6 +586,8 @@ namespace tgui
             m_animationTimeElapsed = {};
             m_possibleDoubleClick = false;
         }
+        else if (m_possibleDoubleClick) // Check again once the time for a double click has passed
+            scheduleUpdate(sf::milliseconds(getDoubleClickTime()) - m_animationTimeElapsed);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -568,7 +568,7 @@ namespace tgui
             }
             else // This is the first click
             {
-                m_animationTimeElapsed = {};
+                restartAnimationTime(sf::milliseconds(getDoubleClickTime()));
                 m_possibleDoubleClick = true;
             }
         }
@@ -678,127 +678,166 @@ namespace tgui
 
     void ListBox::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
+        switch (propertyHash(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == "textcolor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            updateItemColorsAndStyle();
-        }
-        else if (property == "textcolorhover")
-        {
-            m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
-            updateItemColorsAndStyle();
-        }
-        else if (property == "selectedtextcolor")
-        {
-            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-            updateItemColorsAndStyle();
-        }
-        else if (property == "selectedtextcolorhover")
-        {
-            m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
-            updateItemColorsAndStyle();
-        }
-        else if (property == "texturebackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == "textstyle")
-        {
-            m_textStyleCached = getSharedRenderer()->getTextStyle();
+            TGUI_PROPERTY_CASE(property, "borders")
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                return;
+            }
 
-            for (auto& item : m_items)
-                item.setStyle(m_textStyleCached);
+            TGUI_PROPERTY_CASE(property, "padding")
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                setSize(m_size);
+                return;
+            }
 
-            if ((m_selectedItem >= 0) && m_selectedTextStyleCached.isSet())
-                m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
-        }
-        else if (property == "selectedtextstyle")
-        {
-            m_selectedTextStyleCached = getSharedRenderer()->getSelectedTextStyle();
+            TGUI_PROPERTY_CASE(property, "textcolor")
+            {
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                updateItemColorsAndStyle();
+                return;
+            }
 
-            if (m_selectedItem >= 0)
+            TGUI_PROPERTY_CASE(property, "textcolorhover")
+            {
+                m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
+                updateItemColorsAndStyle();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "selectedtextcolor")
+            {
+                m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+                updateItemColorsAndStyle();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "selectedtextcolorhover")
+            {
+                m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
+                updateItemColorsAndStyle();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturebackground")
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "textstyle")
             {
-                if (m_selectedTextStyleCached.isSet())
+                m_textStyleCached = getSharedRenderer()->getTextStyle();
+
+                for (auto& item : m_items)
+                    item.setStyle(m_textStyleCached);
+
+                if ((m_selectedItem >= 0) && m_selectedTextStyleCached.isSet())
                     m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
-                else
-                    m_items[m_selectedItem].setStyle(m_textStyleCached);
+                return;
             }
-        }
-        else if (property == "scrollbar")
-        {
-            m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
 
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (!getSharedRenderer()->getScrollbarWidth())
+            TGUI_PROPERTY_CASE(property, "selectedtextstyle")
             {
-                m_scroll->setSize({m_scroll->getDefaultWidth(), m_scroll->getSize().y});
+                m_selectedTextStyleCached = getSharedRenderer()->getSelectedTextStyle();
+
+                if (m_selectedItem >= 0)
+                {
+                    if (m_selectedTextStyleCached.isSet())
+                        m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
+                    else
+                        m_items[m_selectedItem].setStyle(m_textStyleCached);
+                }
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "scrollbar")
+            {
+                m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
+
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (!getSharedRenderer()->getScrollbarWidth())
+                {
+                    m_scroll->setSize({m_scroll->getDefaultWidth(), m_scroll->getSize().y});
+                    setSize(m_size);
+                }
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "scrollbarwidth")
+            {
+                const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
+                m_scroll->setSize({width, m_scroll->getSize().y});
                 setSize(m_size);
+                return;
             }
-        }
-        else if (property == "scrollbarwidth")
-        {
-            const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
-            m_scroll->setSize({width, m_scroll->getSize().y});
-            setSize(m_size);
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "backgroundcolorhover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == "selectedbackgroundcolor")
-        {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
-        }
-        else if (property == "selectedbackgroundcolorhover")
-        {
-            m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
-        }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
-        {
-            Widget::rendererChanged(property);
 
-            m_scroll->setInheritedOpacity(m_opacityCached);
-            m_spriteBackground.setOpacity(m_opacityCached);
-            for (auto& item : m_items)
-                item.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
+            TGUI_PROPERTY_CASE(property, "bordercolor")
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                return;
+            }
 
-            for (auto& item : m_items)
-                item.setFont(m_fontCached);
+            TGUI_PROPERTY_CASE(property, "backgroundcolor")
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "backgroundcolorhover")
+            {
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "selectedbackgroundcolor")
+            {
+                m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "selectedbackgroundcolorhover")
+            {
+                m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
+                return;
+            }
 
-            // Recalculate the text size with the new font
-            if (m_requestedTextSize == 0)
+            TGUI_PROPERTY_CASE(property, "opacity", "opacitydisabled")
             {
-                m_textSize = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
+                Widget::rendererChanged(property);
+
+                m_scroll->setInheritedOpacity(m_opacityCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
                 for (auto& item : m_items)
-                    item.setCharacterSize(m_textSize);
+                    item.setOpacity(m_opacityCached);
+                return;
             }
 
-            setPosition(m_position);
+            TGUI_PROPERTY_CASE(property, "font")
+            {
+                Widget::rendererChanged(property);
+
+                for (auto& item : m_items)
+                    item.setFont(m_fontCached);
+
+                // Recalculate the text size with the new font
+                if (m_requestedTextSize == 0)
+                {
+                    m_textSize = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
+                    for (auto& item : m_items)
+                        item.setCharacterSize(m_textSize);
+                }
+
+                setPosition(m_position);
+                return;
+            }
         }
-        else
-            Widget::rendererChanged(property);
+
+        // The property isn't handled by this widget, or an unknown name only shares the hash of a known property
+        Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -882,7 +921,7 @@ namespace tgui
         }
 
         if (node->propertyValuePairs["autoscroll"])
-            setAutoScroll(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["autoscroll"]->value).getBool());
+            setAutoScroll(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["autoscroll"]).getBool());
         if (node->propertyValuePairs["textsize"])
             setTextSize(strToInt(node->propertyValuePairs["textsize"]->value));
         if (node->propertyValuePairs["itemheight"])
@@ -993,6 +1032,8 @@ namespace tgui
             m_animationTimeElapsed = {};
             m_possibleDoubleClick = false;
         }
+        else if (m_possibleDoubleClick) // Check again once the time for a double click has passed
+            scheduleUpdate(sf::milliseconds(getDoubleClickTime()) - m_animationTimeElapsed);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1040,7 +1040,7 @@ namespace tgui
             }
             else // This is the first click
             {
-                m_animationTimeElapsed = {};
+                restartAnimationTime(sf::milliseconds(getDoubleClickTime()));
                 m_possibleDoubleClick = m_hoveredItem;
             }
         }
@@ -1241,154 +1241,195 @@ namespace tgui
 
     void ListView::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
+        switch (propertyHash(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == "textcolor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            updateItemColors();
+            TGUI_PROPERTY_CASE(property, "borders")
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                return;
+            }
 
-            if (!m_headerTextColorCached.isSet())
-                updateHeaderTextsColor();
-        }
-        else if (property == "textcolorhover")
-        {
-            m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
-            updateItemColors();
-        }
-        else if (property == "selectedtextcolor")
-        {
-            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-            updateItemColors();
-        }
-        else if (property == "selectedtextcolorhover")
-        {
-            m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
-            updateItemColors();
-        }
-        else if (property == "scrollbar")
-        {
-            m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
-            m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+            TGUI_PROPERTY_CASE(property, "padding")
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                setSize(m_size);
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "textcolor")
+            {
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                updateItemColors();
+
+                if (!m_headerTextColorCached.isSet())
+                    updateHeaderTextsColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "textcolorhover")
+            {
+                m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
+                updateItemColors();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "selectedtextcolor")
+            {
+                m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+                updateItemColors();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "selectedtextcolorhover")
+            {
+                m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
+                updateItemColors();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "scrollbar")
+            {
+                m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+                m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
 
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (!getSharedRenderer()->getScrollbarWidth())
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (!getSharedRenderer()->getScrollbarWidth())
+                {
+                    m_verticalScrollbar->setSize({m_verticalScrollbar->getDefaultWidth(), m_verticalScrollbar->getSize().y});
+                    m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, m_horizontalScrollbar->getDefaultWidth()});
+                    setSize(m_size);
+                }
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "scrollbarwidth")
             {
-                m_verticalScrollbar->setSize({m_verticalScrollbar->getDefaultWidth(), m_verticalScrollbar->getSize().y});
-                m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, m_horizontalScrollbar->getDefaultWidth()});
+                const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
+                m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
+                m_horizontalScrollbar->setSize({m_verticalScrollbar->getSize().x, width});
                 setSize(m_size);
+                return;
             }
-        }
-        else if (property == "scrollbarwidth")
-        {
-            const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
-            m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
-            m_horizontalScrollbar->setSize({m_verticalScrollbar->getSize().x, width});
-            setSize(m_size);
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "separatorcolor")
-        {
-            m_separatorColorCached = getSharedRenderer()->getSeparatorColor();
-        }
-        else if (property == "gridlinescolor")
-        {
-            m_gridLinesColorCached = getSharedRenderer()->getGridLinesColor();
-        }
-        else if (property == "headertextcolor")
-        {
-            m_headerTextColorCached = getSharedRenderer()->getHeaderTextColor();
-            updateHeaderTextsColor();
-        }
-        else if (property == "headerbackgroundcolor")
-        {
-            m_headerBackgroundColorCached = getSharedRenderer()->getHeaderBackgroundColor();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "backgroundcolorhover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == "selectedbackgroundcolor")
-        {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
-        }
-        else if (property == "selectedbackgroundcolorhover")
-        {
-            m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
-        }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
-        {
-            Widget::rendererChanged(property);
 
-            m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
-            m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
+            TGUI_PROPERTY_CASE(property, "bordercolor")
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                return;
+            }
 
-            for (auto& column : m_columns)
-                column.text.setOpacity(m_opacityCached);
+            TGUI_PROPERTY_CASE(property, "separatorcolor")
+            {
+                m_separatorColorCached = getSharedRenderer()->getSeparatorColor();
+                return;
+            }
 
-            for (auto& item : m_items)
+            TGUI_PROPERTY_CASE(property, "gridlinescolor")
             {
-                for (auto& text : item.texts)
-                    text.setOpacity(m_opacityCached);
+                m_gridLinesColorCached = getSharedRenderer()->getGridLinesColor();
+                return;
+            }
 
-                item.icon.setOpacity(m_opacityCached);
+            TGUI_PROPERTY_CASE(property, "headertextcolor")
+            {
+                m_headerTextColorCached = getSharedRenderer()->getHeaderTextColor();
+                updateHeaderTextsColor();
+                return;
             }
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
 
-            for (auto& column : m_columns)
-                column.text.setFont(m_fontCached);
+            TGUI_PROPERTY_CASE(property, "headerbackgroundcolor")
+            {
+                m_headerBackgroundColorCached = getSharedRenderer()->getHeaderBackgroundColor();
+                return;
+            }
 
-            for (auto& item : m_items)
+            TGUI_PROPERTY_CASE(property, "backgroundcolor")
             {
-                for (auto& text : item.texts)
-                    text.setFont(m_fontCached);
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "backgroundcolorhover")
+            {
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "selectedbackgroundcolor")
+            {
+                m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+                return;
             }
 
-            // Recalculate the text size with the new font
-            if (m_requestedTextSize == 0)
+            TGUI_PROPERTY_CASE(property, "selectedbackgroundcolorhover")
             {
-                m_textSize = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
+                m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "opacity", "opacitydisabled")
+            {
+                Widget::rendererChanged(property);
+
+                m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
+                m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
+
+                for (auto& column : m_columns)
+                    column.text.setOpacity(m_opacityCached);
+
                 for (auto& item : m_items)
                 {
                     for (auto& text : item.texts)
-                        text.setCharacterSize(m_textSize);
-                }
+                        text.setOpacity(m_opacityCached);
 
-                if (!m_headerTextSize)
-                {
-                    for (auto& column : m_columns)
-                        column.text.setCharacterSize(m_textSize);
+                    item.icon.setOpacity(m_opacityCached);
                 }
+                return;
             }
 
-            // Recalculate the width of the columns if they depended on the header text
-            for (auto& column : m_columns)
+            TGUI_PROPERTY_CASE(property, "font")
             {
-                if (column.designWidth == 0)
-                    column.width = calculateAutoColumnWidth(column.text);
+                Widget::rendererChanged(property);
+
+                for (auto& column : m_columns)
+                    column.text.setFont(m_fontCached);
+
+                for (auto& item : m_items)
+                {
+                    for (auto& text : item.texts)
+                        text.setFont(m_fontCached);
+                }
+
+                // Recalculate the text size with the new font
+                if (m_requestedTextSize == 0)
+                {
+                    m_textSize = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
+                    for (auto& item : m_items)
+                    {
+                        for (auto& text : item.texts)
+                            text.setCharacterSize(m_textSize);
+                    }
+
+                    if (!m_headerTextSize)
+                    {
+                        for (auto& column : m_columns)
+                            column.text.setCharacterSize(m_textSize);
+                    }
+                }
+
+                // Recalculate the width of the columns if they depended on the header text
+                for (auto& column : m_columns)
+                {
+                    if (column.designWidth == 0)
+                        column.width = calculateAutoColumnWidth(column.text);
+                }
+                updateHorizontalScrollbarMaximum();
+                return;
             }
-            updateHorizontalScrollbarMaximum();
         }
-        else
-            Widget::rendererChanged(property);
+
+        // The property isn't handled by this widget, or an unknown name only shares the hash of a known property
+        Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1507,7 +1548,7 @@ namespace tgui
             if (childNode->propertyValuePairs["text"])
                 text = Deserializer::deserialize(ObjectConverter::Type::String, childNode->propertyValuePairs["text"]->value).getString();
             if (childNode->propertyValuePairs["width"])
-                width = Deserializer::deserialize(ObjectConverter::Type::Number, childNode->propertyValuePairs["width"]->value).getNumber();
+                width = Deserializer::deserialize(ObjectConverter::Type::Number, *childNode->propertyValuePairs["width"]).getNumber();
 
             if (childNode->propertyValuePairs["alignment"])
             {
@@ -1542,9 +1583,9 @@ namespace tgui
         }
 
         if (node->propertyValuePairs["autoscroll"])
-            setAutoScroll(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["autoscroll"]->value).getBool());
+            setAutoScroll(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["autoscroll"]).getBool());
         if (node->propertyValuePairs["headervisible"])
-            setHeaderVisible(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["headervisible"]->value).getBool());
+            setHeaderVisible(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["headervisible"]).getBool());
         if (node->propertyValuePairs["headerheight"])
             setHeaderHeight(strToFloat(node->propertyValuePairs["headerheight"]->value));
         if (node->propertyValuePairs["headertextsize"])
@@ -1558,7 +1599,7 @@ namespace tgui
         if (node->propertyValuePairs["itemheight"])
             setItemHeight(strToInt(node->propertyValuePairs["itemheight"]->value));
         if (node->propertyValuePairs["multiselect"])
-            setMultiSelect(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["multiselect"]->value).getBool());
+            setMultiSelect(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["multiselect"]).getBool());
 #ifndef TGUI_NEXT
         if (node->propertyValuePairs["selecteditemindex"])
             setSelectedItem(strToInt(node->propertyValuePairs["selecteditemindex"]->value));
@@ -1574,11 +1615,11 @@ namespace tgui
         if (node->propertyValuePairs["gridlineswidth"])
             setGridLinesWidth(strToInt(node->propertyValuePairs["gridlineswidth"]->value));
         if (node->propertyValuePairs["showhorizontalgridlines"])
-            setShowHorizontalGridLines(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["showhorizontalgridlines"]->value).getBool());
+            setShowHorizontalGridLines(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["showhorizontalgridlines"]).getBool());
         if (node->propertyValuePairs["showverticalgridlines"])
-            setShowVerticalGridLines(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["showverticalgridlines"]->value).getBool());
+            setShowVerticalGridLines(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["showverticalgridlines"]).getBool());
         if (node->propertyValuePairs["expandlastcolumn"])
-            setExpandLastColumn(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["expandlastcolumn"]->value).getBool());
+            setExpandLastColumn(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["expandlastcolumn"]).getBool());
 
         if (node->propertyValuePairs["verticalscrollbarpolicy"])
         {
@@ -2036,6 +2077,8 @@ namespace tgui
             m_animationTimeElapsed = {};
             m_possibleDoubleClick = -1;
         }
+        else if (m_possibleDoubleClick >= 0) // Check again once the time for a double click has passed
+            scheduleUpdate(sf::milliseconds(getDoubleClickTime()) - m_animationTimeElapsed);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -187,6 +187,7 @@ namespace tgui
     MenuBar::MenuBar()
     {
         m_type = "MenuBar";
+        m_notifiedOfAllMouseReleases = true;
         m_distanceToSideCached = Text::getLineHeight(m_fontCached, getGlobalTextSize()) * 0.4f;
 
         m_renderer = aurora::makeCopied<MenuBarRenderer>();
@@ -569,6 +570,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool MenuBar::canBeHitOutsideBounds() const
+    {
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void MenuBar::leftMousePressed(Vector2f pos)
     {
         // Check if a menu should be opened or closed
@@ -794,58 +802,83 @@ namespace tgui
 
     void MenuBar::rendererChanged(const std::string& property)
     {
-        if (property == "textcolor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            updateTextColors(m_menus, m_visibleMenu);
-        }
-        else if (property == "selectedtextcolor")
-        {
-            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-            updateTextColors(m_menus, m_visibleMenu);
-        }
-        else if (property == "textcolordisabled")
-        {
-            m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
-            updateTextColors(m_menus, m_visibleMenu);
-        }
-        else if (property == "texturebackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == "textureitembackground")
-        {
-            m_spriteItemBackground.setTexture(getSharedRenderer()->getTextureItemBackground());
-        }
-        else if (property == "textureselecteditembackground")
-        {
-            m_spriteSelectedItemBackground.setTexture(getSharedRenderer()->getTextureSelectedItemBackground());
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "selectedbackgroundcolor")
-        {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
-        }
-        else if (property == "distancetoside")
+        switch (propertyHash(property))
         {
-            m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
-        }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
-        {
-            Widget::rendererChanged(property);
-            updateTextOpacity(m_menus);
-            m_spriteBackground.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
-            updateTextFont(m_menus);
+            TGUI_PROPERTY_CASE(property, "textcolor")
+            {
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                updateTextColors(m_menus, m_visibleMenu);
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "selectedtextcolor")
+            {
+                m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+                updateTextColors(m_menus, m_visibleMenu);
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "textcolordisabled")
+            {
+                m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
+                updateTextColors(m_menus, m_visibleMenu);
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturebackground")
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "textureitembackground")
+            {
+                m_spriteItemBackground.setTexture(getSharedRenderer()->getTextureItemBackground());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "textureselecteditembackground")
+            {
+                m_spriteSelectedItemBackground.setTexture(getSharedRenderer()->getTextureSelectedItemBackground());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "backgroundcolor")
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "selectedbackgroundcolor")
+            {
+                m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "distancetoside")
+            {
+                m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "opacity", "opacitydisabled")
+            {
+                Widget::rendererChanged(property);
+                updateTextOpacity(m_menus);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "font")
+            {
+                Widget::rendererChanged(property);
+                updateTextFont(m_menus);
+                return;
+            }
         }
-        else
-            Widget::rendererChanged(property);
+
+        // The property isn't handled by this widget, or an unknown name only shares the hash of a known property
+        Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1037,7 +1070,7 @@ namespace tgui
         #endif
 
             if (childNode->propertyValuePairs["enabled"])
-                menus.back().enabled = Deserializer::deserialize(ObjectConverter::Type::Bool, childNode->propertyValuePairs["enabled"]->value).getBool();
+                menus.back().enabled = Deserializer::deserialize(ObjectConverter::Type::Bool, *childNode->propertyValuePairs["enabled"]).getBool();
 
             // Recursively handle the menu nodes
             if (!childNode->children.empty())
@@ -294,29 +294,38 @@ namespace tgui
 
     void MessageBox::rendererChanged(const std::string& property)
     {
-        if (property == "textcolor")
+        switch (propertyHash(property))
         {
-            m_label->getRenderer()->setTextColor(getSharedRenderer()->getTextColor());
-        }
-        else if (property == "button")
-        {
-            const auto& renderer = getSharedRenderer()->getButton();
-            for (auto& button : m_buttons)
-                button->setRenderer(renderer);
-        }
-        else if (property == "font")
-        {
-            ChildWindow::rendererChanged(property);
+            TGUI_PROPERTY_CASE(property, "textcolor")
+            {
+                m_label->getRenderer()->setTextColor(getSharedRenderer()->getTextColor());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "button")
+            {
+                const auto& renderer = getSharedRenderer()->getButton();
+                for (auto& button : m_buttons)
+                    button->setRenderer(renderer);
+                return;
+            }
 
-            m_label->setInheritedFont(m_fontCached);
+            TGUI_PROPERTY_CASE(property, "font")
+            {
+                ChildWindow::rendererChanged(property);
 
-            for (auto& button : m_buttons)
-                button->setInheritedFont(m_fontCached);
+                m_label->setInheritedFont(m_fontCached);
 
-            rearrange();
+                for (auto& button : m_buttons)
+                    button->setInheritedFont(m_fontCached);
+
+                rearrange();
+                return;
+            }
         }
-        else
-            ChildWindow::rendererChanged(property);
+
+        // The property isn't handled by this widget, or an unknown name only shares the hash of a known property
+        ChildWindow::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
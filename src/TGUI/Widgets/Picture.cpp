@@ -157,7 +157,7 @@ namespace tgui
             }
             else // This is the first click
             {
-                m_animationTimeElapsed = {};
+                restartAnimationTime(sf::milliseconds(getDoubleClickTime()));
                 m_possibleDoubleClick = true;
             }
         }
@@ -177,22 +177,29 @@ namespace tgui
 
     void Picture::rendererChanged(const std::string& property)
     {
-        if (property == "texture")
+        switch (propertyHash(property))
         {
-            const auto& texture = getSharedRenderer()->getTexture();
+            TGUI_PROPERTY_CASE(property, "texture")
+            {
+                const auto& texture = getSharedRenderer()->getTexture();
 
-            if (!m_sprite.isSet() && (getSize() == Vector2f{0,0}))
-                setSize(texture.getImageSize());
+                if (!m_sprite.isSet() && (getSize() == Vector2f{0,0}))
+                    setSize(texture.getImageSize());
 
-            m_sprite.setTexture(texture);
-        }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
-        {
-            Widget::rendererChanged(property);
-            m_sprite.setOpacity(m_opacityCached);
+                m_sprite.setTexture(texture);
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "opacity", "opacitydisabled")
+            {
+                Widget::rendererChanged(property);
+                m_sprite.setOpacity(m_opacityCached);
+                return;
+            }
         }
-        else
-            Widget::rendererChanged(property);
+
+        // The property isn't handled by this widget, or an unknown name only shares the hash of a known property
+        Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -214,7 +221,7 @@ namespace tgui
         Widget::load(node, renderers);
 
         if (node->propertyValuePairs["ignoremouseevents"])
-            ignoreMouseEvents(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["ignoremouseevents"]->value).getBool());
+            ignoreMouseEvents(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["ignoremouseevents"]).getBool());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -228,6 +235,8 @@ namespace tgui
             m_animationTimeElapsed = {};
             m_possibleDoubleClick = false;
         }
+        else if (m_possibleDoubleClick) // Check again once the time for a double click has passed
+            scheduleUpdate(sf::milliseconds(getDoubleClickTime()) - m_animationTimeElapsed);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -303,66 +303,89 @@ namespace tgui
 
     void ProgressBar::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
+        switch (propertyHash(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if ((property == "textcolor") || (property == "textcolorfilled"))
-        {
-            m_textBack.setColor(getSharedRenderer()->getTextColor());
+            TGUI_PROPERTY_CASE(property, "borders")
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                return;
+            }
 
-            if (getSharedRenderer()->getTextColorFilled().isSet())
-                m_textFront.setColor(getSharedRenderer()->getTextColorFilled());
-            else
-                m_textFront.setColor(getSharedRenderer()->getTextColor());
-        }
-        else if (property == "texturebackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == "texturefill")
-        {
-            m_spriteFill.setTexture(getSharedRenderer()->getTextureFill());
-            recalculateFillSize();
-        }
-        else if (property == "textstyle")
-        {
-            m_textBack.setStyle(getSharedRenderer()->getTextStyle());
-            m_textFront.setStyle(getSharedRenderer()->getTextStyle());
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "fillcolor")
-        {
-            m_fillColorCached = getSharedRenderer()->getFillColor();
-        }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
-        {
-            Widget::rendererChanged(property);
+            TGUI_PROPERTY_CASE(property, "textcolor", "textcolorfilled")
+            {
+                m_textBack.setColor(getSharedRenderer()->getTextColor());
 
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_spriteFill.setOpacity(m_opacityCached);
+                if (getSharedRenderer()->getTextColorFilled().isSet())
+                    m_textFront.setColor(getSharedRenderer()->getTextColorFilled());
+                else
+                    m_textFront.setColor(getSharedRenderer()->getTextColor());
+                return;
+            }
 
-            m_textBack.setOpacity(m_opacityCached);
-            m_textFront.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
+            TGUI_PROPERTY_CASE(property, "texturebackground")
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                return;
+            }
 
-            m_textBack.setFont(m_fontCached);
-            m_textFront.setFont(m_fontCached);
-            setText(getText());
+            TGUI_PROPERTY_CASE(property, "texturefill")
+            {
+                m_spriteFill.setTexture(getSharedRenderer()->getTextureFill());
+                recalculateFillSize();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "textstyle")
+            {
+                m_textBack.setStyle(getSharedRenderer()->getTextStyle());
+                m_textFront.setStyle(getSharedRenderer()->getTextStyle());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "bordercolor")
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "backgroundcolor")
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "fillcolor")
+            {
+                m_fillColorCached = getSharedRenderer()->getFillColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "opacity", "opacitydisabled")
+            {
+                Widget::rendererChanged(property);
+
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_spriteFill.setOpacity(m_opacityCached);
+
+                m_textBack.setOpacity(m_opacityCached);
+                m_textFront.setOpacity(m_opacityCached);
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "font")
+            {
+                Widget::rendererChanged(property);
+
+                m_textBack.setFont(m_fontCached);
+                m_textFront.setFont(m_fontCached);
+                setText(getText());
+                return;
+            }
         }
-        else
-            Widget::rendererChanged(property);
+
+        // The property isn't handled by this widget, or an unknown name only shares the hash of a known property
+        Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
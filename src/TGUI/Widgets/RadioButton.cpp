@@ -167,6 +167,10 @@ namespace tgui
             m_text.setCharacterSize(Text::findBestTextSize(m_fontCached, getSize().y * 0.8f));
         else
             m_text.setCharacterSize(m_textSize);
+
+        // The text is part of the full size of the widget
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -291,165 +295,232 @@ namespace tgui
 
     void RadioButton::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            m_bordersCached.updateParentSize(getSize());
-            updateTextureSizes();
-        }
-        else if ((property == "textcolor") || (property == "textcolorhover") || (property == "textcolordisabled")
-              || (property == "textcolorchecked") || (property == "textcolorcheckedhover") || (property == "textcolorcheckeddisabled"))
+        switch (propertyHash(property))
         {
-            updateTextColor();
-        }
-        else if (property == "textstyle")
-        {
-            m_textStyleCached = getSharedRenderer()->getTextStyle();
+            TGUI_PROPERTY_CASE(property, "borders")
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                m_bordersCached.updateParentSize(getSize());
+                updateTextureSizes();
+                return;
+            }
 
-            if (m_checked && m_textStyleCheckedCached.isSet())
-                m_text.setStyle(m_textStyleCheckedCached);
-            else
-                m_text.setStyle(m_textStyleCached);
-        }
-        else if (property == "textstylechecked")
-        {
-            m_textStyleCheckedCached = getSharedRenderer()->getTextStyleChecked();
+            TGUI_PROPERTY_CASE(property, "textcolor", "textcolorhover", "textcolordisabled", "textcolorchecked",
+                                         "textcolorcheckedhover", "textcolorcheckeddisabled")
+            {
+                updateTextColor();
+                return;
+            }
 
-            if (m_checked && m_textStyleCheckedCached.isSet())
-                m_text.setStyle(m_textStyleCheckedCached);
-            else
-                m_text.setStyle(m_textStyleCached);
-        }
-        else if (property == "textureunchecked")
-        {
-            m_spriteUnchecked.setTexture(getSharedRenderer()->getTextureUnchecked());
-            updateTextureSizes();
-        }
-        else if (property == "texturechecked")
-        {
-            m_spriteChecked.setTexture(getSharedRenderer()->getTextureChecked());
-            updateTextureSizes();
-        }
-        else if (property == "textureuncheckedhover")
-        {
-            m_spriteUncheckedHover.setTexture(getSharedRenderer()->getTextureUncheckedHover());
-        }
-        else if (property == "texturecheckedhover")
-        {
-            m_spriteCheckedHover.setTexture(getSharedRenderer()->getTextureCheckedHover());
-        }
-        else if (property == "textureuncheckeddisabled")
-        {
-            m_spriteUncheckedDisabled.setTexture(getSharedRenderer()->getTextureUncheckedDisabled());
-        }
-        else if (property == "texturecheckeddisabled")
-        {
-            m_spriteCheckedDisabled.setTexture(getSharedRenderer()->getTextureCheckedDisabled());
-        }
-        else if (property == "textureuncheckedfocused")
-        {
-            m_spriteUncheckedFocused.setTexture(getSharedRenderer()->getTextureUncheckedFocused());
-        }
-        else if (property == "texturecheckedfocused")
-        {
-            m_spriteCheckedFocused.setTexture(getSharedRenderer()->getTextureCheckedFocused());
-        }
-        else if (property == "checkcolor")
-        {
-            m_checkColorCached = getSharedRenderer()->getCheckColor();
-        }
-        else if (property == "checkcolorhover")
-        {
-            m_checkColorHoverCached = getSharedRenderer()->getCheckColorHover();
-        }
-        else if (property == "checkcolordisabled")
-        {
-            m_checkColorDisabledCached = getSharedRenderer()->getCheckColorDisabled();
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "bordercolorhover")
-        {
-            m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
-        }
-        else if (property == "bordercolordisabled")
-        {
-            m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
-        }
-        else if (property == "bordercolorfocused")
-        {
-            m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
-        }
-        else if (property == "bordercolorchecked")
-        {
-            m_borderColorCheckedCached = getSharedRenderer()->getBorderColorChecked();
-        }
-        else if (property == "bordercolorcheckedhover")
-        {
-            m_borderColorCheckedHoverCached = getSharedRenderer()->getBorderColorCheckedHover();
-        }
-        else if (property == "bordercolorcheckeddisabled")
-        {
-            m_borderColorCheckedDisabledCached = getSharedRenderer()->getBorderColorCheckedDisabled();
-        }
-        else if (property == "bordercolorcheckedfocused")
-        {
-            m_borderColorCheckedFocusedCached = getSharedRenderer()->getBorderColorCheckedFocused();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "backgroundcolorhover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == "backgroundcolordisabled")
-        {
-            m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
-        }
-        else if (property == "backgroundcolorchecked")
-        {
-            m_backgroundColorCheckedCached = getSharedRenderer()->getBackgroundColorChecked();
-        }
-        else if (property == "backgroundcolorcheckedhover")
-        {
-            m_backgroundColorCheckedHoverCached = getSharedRenderer()->getBackgroundColorCheckedHover();
-        }
-        else if (property == "backgroundcolorcheckeddisabled")
-        {
-            m_backgroundColorCheckedDisabledCached = getSharedRenderer()->getBackgroundColorCheckedDisabled();
-        }
-        else if (property == "textdistanceratio")
-        {
-            m_textDistanceRatioCached = getSharedRenderer()->getTextDistanceRatio();
-        }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
-        {
-            Widget::rendererChanged(property);
-
-            m_spriteUnchecked.setOpacity(m_opacityCached);
-            m_spriteChecked.setOpacity(m_opacityCached);
-            m_spriteUncheckedHover.setOpacity(m_opacityCached);
-            m_spriteCheckedHover.setOpacity(m_opacityCached);
-            m_spriteUncheckedDisabled.setOpacity(m_opacityCached);
-            m_spriteCheckedDisabled.setOpacity(m_opacityCached);
-            m_spriteUncheckedFocused.setOpacity(m_opacityCached);
-            m_spriteCheckedFocused.setOpacity(m_opacityCached);
-
-            m_text.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
+            TGUI_PROPERTY_CASE(property, "textstyle")
+            {
+                m_textStyleCached = getSharedRenderer()->getTextStyle();
 
-            m_text.setFont(m_fontCached);
-            setText(getText());
+                if (m_checked && m_textStyleCheckedCached.isSet())
+                    m_text.setStyle(m_textStyleCheckedCached);
+                else
+                    m_text.setStyle(m_textStyleCached);
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "textstylechecked")
+            {
+                m_textStyleCheckedCached = getSharedRenderer()->getTextStyleChecked();
+
+                if (m_checked && m_textStyleCheckedCached.isSet())
+                    m_text.setStyle(m_textStyleCheckedCached);
+                else
+                    m_text.setStyle(m_textStyleCached);
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "textureunchecked")
+            {
+                m_spriteUnchecked.setTexture(getSharedRenderer()->getTextureUnchecked());
+                updateTextureSizes();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturechecked")
+            {
+                m_spriteChecked.setTexture(getSharedRenderer()->getTextureChecked());
+                updateTextureSizes();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "textureuncheckedhover")
+            {
+                m_spriteUncheckedHover.setTexture(getSharedRenderer()->getTextureUncheckedHover());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturecheckedhover")
+            {
+                m_spriteCheckedHover.setTexture(getSharedRenderer()->getTextureCheckedHover());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "textureuncheckeddisabled")
+            {
+                m_spriteUncheckedDisabled.setTexture(getSharedRenderer()->getTextureUncheckedDisabled());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturecheckeddisabled")
+            {
+                m_spriteCheckedDisabled.setTexture(getSharedRenderer()->getTextureCheckedDisabled());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "textureuncheckedfocused")
+            {
+                m_spriteUncheckedFocused.setTexture(getSharedRenderer()->getTextureUncheckedFocused());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturecheckedfocused")
+            {
+                m_spriteCheckedFocused.setTexture(getSharedRenderer()->getTextureCheckedFocused());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "checkcolor")
+            {
+                m_checkColorCached = getSharedRenderer()->getCheckColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "checkcolorhover")
+            {
+                m_checkColorHoverCached = getSharedRenderer()->getCheckColorHover();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "checkcolordisabled")
+            {
+                m_checkColorDisabledCached = getSharedRenderer()->getCheckColorDisabled();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "bordercolor")
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "bordercolorhover")
+            {
+                m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "bordercolordisabled")
+            {
+                m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "bordercolorfocused")
+            {
+                m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "bordercolorchecked")
+            {
+                m_borderColorCheckedCached = getSharedRenderer()->getBorderColorChecked();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "bordercolorcheckedhover")
+            {
+                m_borderColorCheckedHoverCached = getSharedRenderer()->getBorderColorCheckedHover();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "bordercolorcheckeddisabled")
+            {
+                m_borderColorCheckedDisabledCached = getSharedRenderer()->getBorderColorCheckedDisabled();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "bordercolorcheckedfocused")
+            {
+                m_borderColorCheckedFocusedCached = getSharedRenderer()->getBorderColorCheckedFocused();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "backgroundcolor")
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "backgroundcolorhover")
+            {
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "backgroundcolordisabled")
+            {
+                m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "backgroundcolorchecked")
+            {
+                m_backgroundColorCheckedCached = getSharedRenderer()->getBackgroundColorChecked();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "backgroundcolorcheckedhover")
+            {
+                m_backgroundColorCheckedHoverCached = getSharedRenderer()->getBackgroundColorCheckedHover();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "backgroundcolorcheckeddisabled")
+            {
+                m_backgroundColorCheckedDisabledCached = getSharedRenderer()->getBackgroundColorCheckedDisabled();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "textdistanceratio")
+            {
+                m_textDistanceRatioCached = getSharedRenderer()->getTextDistanceRatio();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "opacity", "opacitydisabled")
+            {
+                Widget::rendererChanged(property);
+
+                m_spriteUnchecked.setOpacity(m_opacityCached);
+                m_spriteChecked.setOpacity(m_opacityCached);
+                m_spriteUncheckedHover.setOpacity(m_opacityCached);
+                m_spriteCheckedHover.setOpacity(m_opacityCached);
+                m_spriteUncheckedDisabled.setOpacity(m_opacityCached);
+                m_spriteCheckedDisabled.setOpacity(m_opacityCached);
+                m_spriteUncheckedFocused.setOpacity(m_opacityCached);
+                m_spriteCheckedFocused.setOpacity(m_opacityCached);
+
+                m_text.setOpacity(m_opacityCached);
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "font")
+            {
+                Widget::rendererChanged(property);
+
+                m_text.setFont(m_fontCached);
+                setText(getText());
+                return;
+            }
         }
-        else
-            Widget::rendererChanged(property);
+
+        // The property isn't handled by this widget, or an unknown name only shares the hash of a known property
+        Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -480,9 +551,9 @@ namespace tgui
         if (node->propertyValuePairs["textsize"])
             setTextSize(strToInt(node->propertyValuePairs["textsize"]->value));
         if (node->propertyValuePairs["textclickable"])
-            setTextClickable(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["textclickable"]->value).getBool());
+            setTextClickable(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["textclickable"]).getBool());
         if (node->propertyValuePairs["checked"])
-            setChecked(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["checked"]->value).getBool());
+            setChecked(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["checked"]).getBool());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
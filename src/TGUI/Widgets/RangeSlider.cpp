@@ -495,78 +495,109 @@ namespace tgui
 
     void RangeSlider::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
+        switch (propertyHash(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "texturetrack")
-        {
-            m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
+            TGUI_PROPERTY_CASE(property, "borders")
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                return;
+            }
 
-            if (m_spriteTrack.getTexture().getImageSize().x < m_spriteTrack.getTexture().getImageSize().y)
-                m_verticalImage = true;
-            else
-                m_verticalImage = false;
+            TGUI_PROPERTY_CASE(property, "texturetrack")
+            {
+                m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
 
-            setSize(m_size);
-        }
-        else if (property == "texturetrackhover")
-        {
-            m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
-        }
-        else if (property == "texturethumb")
-        {
-            m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
-            setSize(m_size);
-        }
-        else if (property == "texturethumbhover")
-        {
-            m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
-        }
-        else if (property == "trackcolor")
-        {
-            m_trackColorCached = getSharedRenderer()->getTrackColor();
-        }
-        else if (property == "trackcolorhover")
-        {
-            m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
-        }
-        else if (property == "selectedtrackcolor")
-        {
-            m_selectedTrackColorCached = getSharedRenderer()->getSelectedTrackColor();
-        }
-        else if (property == "selectedtrackcolorhover")
-        {
-            m_selectedTrackColorHoverCached = getSharedRenderer()->getSelectedTrackColorHover();
-        }
-        else if (property == "thumbcolor")
-        {
-            m_thumbColorCached = getSharedRenderer()->getThumbColor();
-        }
-        else if (property == "thumbcolorhover")
-        {
-            m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "bordercolorhover")
-        {
-            m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
-        }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
-        {
-            Widget::rendererChanged(property);
+                if (m_spriteTrack.getTexture().getImageSize().x < m_spriteTrack.getTexture().getImageSize().y)
+                    m_verticalImage = true;
+                else
+                    m_verticalImage = false;
+
+                setSize(m_size);
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturetrackhover")
+            {
+                m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
+                return;
+            }
 
-            m_spriteTrack.setOpacity(m_opacityCached);
-            m_spriteTrackHover.setOpacity(m_opacityCached);
-            m_spriteThumb.setOpacity(m_opacityCached);
-            m_spriteThumbHover.setOpacity(m_opacityCached);
+            TGUI_PROPERTY_CASE(property, "texturethumb")
+            {
+                m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
+                setSize(m_size);
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturethumbhover")
+            {
+                m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "trackcolor")
+            {
+                m_trackColorCached = getSharedRenderer()->getTrackColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "trackcolorhover")
+            {
+                m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "selectedtrackcolor")
+            {
+                m_selectedTrackColorCached = getSharedRenderer()->getSelectedTrackColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "selectedtrackcolorhover")
+            {
+                m_selectedTrackColorHoverCached = getSharedRenderer()->getSelectedTrackColorHover();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "thumbcolor")
+            {
+                m_thumbColorCached = getSharedRenderer()->getThumbColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "thumbcolorhover")
+            {
+                m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "bordercolor")
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "bordercolorhover")
+            {
+                m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "opacity", "opacitydisabled")
+            {
+                Widget::rendererChanged(property);
+
+                m_spriteTrack.setOpacity(m_opacityCached);
+                m_spriteTrackHover.setOpacity(m_opacityCached);
+                m_spriteThumb.setOpacity(m_opacityCached);
+                m_spriteThumbHover.setOpacity(m_opacityCached);
+                return;
+            }
         }
-        else
-            Widget::rendererChanged(property);
+
+        // The property isn't handled by this widget, or an unknown name only shares the hash of a known property
+        Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
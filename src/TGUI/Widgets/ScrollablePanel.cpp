@@ -59,14 +59,10 @@ namespace tgui
         m_verticalScrollbar        {other.m_verticalScrollbar},
         m_horizontalScrollbar      {other.m_horizontalScrollbar},
         m_verticalScrollbarPolicy  {other.m_verticalScrollbarPolicy},
-        m_horizontalScrollbarPolicy{other.m_horizontalScrollbarPolicy},
-        m_connectedCallbacks       {}
+        m_horizontalScrollbarPolicy{other.m_horizontalScrollbarPolicy}
     {
         if (m_contentSize == Vector2f{0, 0})
-        {
-            for (auto& widget : m_widgets)
-                connectPositionAndSize(widget);
-        }
+            recalculateMostBottomRightPosition();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -79,15 +75,10 @@ namespace tgui
         m_horizontalScrollbar      {std::move(other.m_horizontalScrollbar)},
         m_verticalScrollbarPolicy  {std::move(other.m_verticalScrollbarPolicy)},
         m_horizontalScrollbarPolicy{std::move(other.m_horizontalScrollbarPolicy)},
-        m_connectedCallbacks       {std::move(other.m_connectedCallbacks)}
+        m_childBottomRightPositions{std::move(other.m_childBottomRightPositions)},
+        m_mostBottomRightPositionOutdated{other.m_mostBottomRightPositionOutdated}
     {
-        disconnectAllChildWidgets();
-
-        if (m_contentSize == Vector2f{0, 0})
-        {
-            for (auto& widget : m_widgets)
-                connectPositionAndSize(widget);
-        }
+        other.m_childBottomRightPositions.clear();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -104,13 +95,9 @@ namespace tgui
             m_verticalScrollbarPolicy   = other.m_verticalScrollbarPolicy;
             m_horizontalScrollbarPolicy = other.m_horizontalScrollbarPolicy;
 
-            disconnectAllChildWidgets();
-
+            m_childBottomRightPositions.clear();
             if (m_contentSize == Vector2f{0, 0})
-            {
-                for (auto& widget : m_widgets)
-                    connectPositionAndSize(widget);
-            }
+                recalculateMostBottomRightPosition();
         }
 
         return *this;
@@ -129,14 +116,10 @@ namespace tgui
             m_horizontalScrollbar       = std::move(other.m_horizontalScrollbar);
             m_verticalScrollbarPolicy   = std::move(other.m_verticalScrollbarPolicy);
             m_horizontalScrollbarPolicy = std::move(other.m_horizontalScrollbarPolicy);
+            m_childBottomRightPositions = std::move(other.m_childBottomRightPositions);
+            m_mostBottomRightPositionOutdated = other.m_mostBottomRightPositionOutdated;
 
-            disconnectAllChildWidgets();
-
-            if (m_contentSize == Vector2f{0, 0})
-            {
-                for (auto& widget : m_widgets)
-                    connectPositionAndSize(widget);
-            }
+            other.m_childBottomRightPositions.clear();
         }
 
         return *this;
@@ -210,15 +193,8 @@ namespace tgui
 
         if (m_contentSize == Vector2f{0, 0})
         {
-            const Vector2f bottomRight = widget->getPosition() + widget->getFullSize();
-            if (bottomRight.x > m_mostBottomRightPosition.x)
-                m_mostBottomRightPosition.x = bottomRight.x;
-            if (bottomRight.y > m_mostBottomRightPosition.y)
-                m_mostBottomRightPosition.y = bottomRight.y;
-
-            updateScrollbars();
-
-            connectPositionAndSize(widget);
+            updateChildBottomRightPosition(widget.get(), widget->getPosition() + widget->getFullSize());
+            contentBoundsChanged();
         }
     }
 
@@ -226,23 +202,19 @@ namespace tgui
 
     bool ScrollablePanel::remove(const Widget::Ptr& widget)
     {
-        const auto callbackIt = m_connectedCallbacks.find(widget);
-        if (callbackIt != m_connectedCallbacks.end())
-        {
-            widget->disconnect(callbackIt->second-1);
-            widget->disconnect(callbackIt->second);
-            m_connectedCallbacks.erase(callbackIt);
-        }
-
         const bool ret = Panel::remove(widget);
 
-        if (m_contentSize == Vector2f{0, 0})
+        const auto bottomRightIt = m_childBottomRightPositions.find(widget.get());
+        if (bottomRightIt != m_childBottomRightPositions.end())
         {
-            const Vector2f bottomRight = widget->getPosition() + widget->getFullSize();
+            const Vector2f bottomRight = bottomRightIt->second;
+            m_childBottomRightPositions.erase(bottomRightIt);
+
+            // Only when the removed widget was at the edge of the content do the bounds have to be recalculated
             if ((bottomRight.x == m_mostBottomRightPosition.x) || (bottomRight.y == m_mostBottomRightPosition.y))
             {
-                recalculateMostBottomRightPosition();
-                updateScrollbars();
+                m_mostBottomRightPositionOutdated = true;
+                contentBoundsChanged();
             }
         }
 
@@ -253,14 +225,14 @@ namespace tgui
 
     void ScrollablePanel::removeAllWidgets()
     {
-        disconnectAllChildWidgets();
-
         Panel::removeAllWidgets();
 
+        m_childBottomRightPositions.clear();
         if (m_contentSize == Vector2f{0, 0})
         {
-            recalculateMostBottomRightPosition();
-            updateScrollbars();
+            m_mostBottomRightPosition = {0, 0};
+            m_mostBottomRightPositionOutdated = false;
+            contentBoundsChanged();
         }
     }
 
@@ -270,17 +242,11 @@ namespace tgui
     {
         m_contentSize = size;
 
-        disconnectAllChildWidgets();
-
+        // The bottom right position is only tracked when the content size depends on the child widgets
+        m_childBottomRightPositions.clear();
         if (m_contentSize == Vector2f{0, 0})
-        {
             recalculateMostBottomRightPosition();
 
-            // Automatically recalculate the bottom right position when the position or size of a widget changes
-            for (auto& widget : m_widgets)
-                connectPositionAndSize(widget);
-        }
-
         updateScrollbars();
     }
 
@@ -647,29 +613,36 @@ namespace tgui
 
     void ScrollablePanel::rendererChanged(const std::string& property)
     {
-        if (property == "scrollbar")
+        switch (propertyHash(property))
         {
-            m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
-            m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+            TGUI_PROPERTY_CASE(property, "scrollbar")
+            {
+                m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+                m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (!getSharedRenderer()->getScrollbarWidth())
+                {
+                    const float width = m_verticalScrollbar->getDefaultWidth();
+                    m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
+                    m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
+                    updateScrollbars();
+                }
+                return;
+            }
 
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (!getSharedRenderer()->getScrollbarWidth())
+            TGUI_PROPERTY_CASE(property, "scrollbarwidth")
             {
-                const float width = m_verticalScrollbar->getDefaultWidth();
+                const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
                 m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
                 m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
                 updateScrollbars();
+                return;
             }
         }
-        else if (property == "scrollbarwidth")
-        {
-            const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
-            m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
-            m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
-            updateScrollbars();
-        }
-        else
-            Panel::rendererChanged(property);
+
+        // The property isn't handled by this widget, or an unknown name only shares the hash of a known property
+        Panel::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -795,10 +768,14 @@ namespace tgui
     void ScrollablePanel::recalculateMostBottomRightPosition()
     {
         m_mostBottomRightPosition = {0, 0};
+        m_mostBottomRightPositionOutdated = false;
+        m_childBottomRightPositions.clear();
 
         for (const auto& widget : m_widgets)
         {
             const Vector2f bottomRight = widget->getPosition() + widget->getFullSize();
+            m_childBottomRightPositions[widget.get()] = bottomRight;
+
             if (bottomRight.x > m_mostBottomRightPosition.x)
                 m_mostBottomRightPosition.x = bottomRight.x;
             if (bottomRight.y > m_mostBottomRightPosition.y)
@@ -808,22 +785,70 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ScrollablePanel::connectPositionAndSize(Widget::Ptr widget)
+    bool ScrollablePanel::updateChildBottomRightPosition(const Widget* widget, Vector2f bottomRight)
     {
-        m_connectedCallbacks[widget] = widget->connect({"PositionChanged", "SizeChanged"}, [this](){ recalculateMostBottomRightPosition(); updateScrollbars(); });
+        bool recalculationNeeded = false;
+
+        const auto bottomRightIt = m_childBottomRightPositions.find(widget);
+        if (bottomRightIt != m_childBottomRightPositions.end())
+        {
+            const Vector2f oldBottomRight = bottomRightIt->second;
+            if ((oldBottomRight.x == m_mostBottomRightPosition.x) && (bottomRight.x < oldBottomRight.x))
+                recalculationNeeded = true;
+            if ((oldBottomRight.y == m_mostBottomRightPosition.y) && (bottomRight.y < oldBottomRight.y))
+                recalculationNeeded = true;
+
+            bottomRightIt->second = bottomRight;
+        }
+        else
+            m_childBottomRightPositions[widget] = bottomRight;
+
+        if (bottomRight.x > m_mostBottomRightPosition.x)
+            m_mostBottomRightPosition.x = bottomRight.x;
+        if (bottomRight.y > m_mostBottomRightPosition.y)
+            m_mostBottomRightPosition.y = bottomRight.y;
+
+        return recalculationNeeded;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ScrollablePanel::disconnectAllChildWidgets()
+    void ScrollablePanel::contentBoundsChanged()
     {
-        for (const auto& pair : m_connectedCallbacks)
-        {
-            pair.first->disconnect(pair.second-1);
-            pair.first->disconnect(pair.second);
-        }
+        if (!scheduleChildLayoutUpdate())
+            updateChildLayout();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::updateChildLayout()
+    {
+        if (m_mostBottomRightPositionOutdated)
+            recalculateMostBottomRightPosition();
+
+        updateScrollbars();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::childWidgetBoundsChanged(const Widget* child)
+    {
+        Panel::childWidgetBoundsChanged(child);
+
+        if (m_contentSize != Vector2f{0, 0})
+            return;
+
+        // Widgets that are still being added are handled by the add function
+        if (m_childBottomRightPositions.find(child) == m_childBottomRightPositions.end())
+            return;
+
+        const Vector2f oldMostBottomRightPosition = m_mostBottomRightPosition;
+        if (updateChildBottomRightPosition(child, child->getPosition() + child->getFullSize()))
+            m_mostBottomRightPositionOutdated = true;
 
-        m_connectedCallbacks.clear();
+        // The scrollbars only change when the content became larger or when it may have become smaller
+        if (m_mostBottomRightPositionOutdated || (m_mostBottomRightPosition != oldMostBottomRightPosition))
+            contentBoundsChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
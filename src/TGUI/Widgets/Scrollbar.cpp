@@ -784,99 +784,136 @@ namespace tgui
 
     void Scrollbar::rendererChanged(const std::string& property)
     {
-        if (property == "texturetrack")
+        switch (propertyHash(property))
         {
-            m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
-            if (m_sizeSet)
-                updateSize();
-            else
+            TGUI_PROPERTY_CASE(property, "texturetrack")
             {
-                if (m_verticalScroll)
-                    setSize({getDefaultWidth(), getSize().y});
+                m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
+                if (m_sizeSet)
+                    updateSize();
                 else
-                    setSize({getSize().x, getDefaultWidth()});
+                {
+                    if (m_verticalScroll)
+                        setSize({getDefaultWidth(), getSize().y});
+                    else
+                        setSize({getSize().x, getDefaultWidth()});
 
-                m_sizeSet = false;
+                    m_sizeSet = false;
+                }
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturetrackhover")
+            {
+                m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturethumb")
+            {
+                m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
+                updateSize();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturethumbhover")
+            {
+                m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturearrowup")
+            {
+                m_spriteArrowUp.setTexture(getSharedRenderer()->getTextureArrowUp());
+                updateSize();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturearrowuphover")
+            {
+                m_spriteArrowUpHover.setTexture(getSharedRenderer()->getTextureArrowUpHover());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturearrowdown")
+            {
+                m_spriteArrowDown.setTexture(getSharedRenderer()->getTextureArrowDown());
+                updateSize();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturearrowdownhover")
+            {
+                m_spriteArrowDownHover.setTexture(getSharedRenderer()->getTextureArrowDownHover());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "trackcolor")
+            {
+                m_trackColorCached = getSharedRenderer()->getTrackColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "trackcolorhover")
+            {
+                m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "thumbcolor")
+            {
+                m_thumbColorCached = getSharedRenderer()->getThumbColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "thumbcolorhover")
+            {
+                m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "arrowbackgroundcolor")
+            {
+                m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "arrowbackgroundcolorhover")
+            {
+                m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "arrowcolor")
+            {
+                m_arrowColorCached = getSharedRenderer()->getArrowColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "arrowcolorhover")
+            {
+                m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "opacity", "opacitydisabled")
+            {
+                Widget::rendererChanged(property);
+
+                m_spriteTrack.setOpacity(m_opacityCached);
+                m_spriteTrackHover.setOpacity(m_opacityCached);
+                m_spriteThumb.setOpacity(m_opacityCached);
+                m_spriteThumbHover.setOpacity(m_opacityCached);
+                m_spriteArrowUp.setOpacity(m_opacityCached);
+                m_spriteArrowUpHover.setOpacity(m_opacityCached);
+                m_spriteArrowDown.setOpacity(m_opacityCached);
+                m_spriteArrowDownHover.setOpacity(m_opacityCached);
+                return;
             }
         }
-        else if (property == "texturetrackhover")
-        {
-            m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
-        }
-        else if (property == "texturethumb")
-        {
-            m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
-            updateSize();
-        }
-        else if (property == "texturethumbhover")
-        {
-            m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
-        }
-        else if (property == "texturearrowup")
-        {
-            m_spriteArrowUp.setTexture(getSharedRenderer()->getTextureArrowUp());
-            updateSize();
-        }
-        else if (property == "texturearrowuphover")
-        {
-            m_spriteArrowUpHover.setTexture(getSharedRenderer()->getTextureArrowUpHover());
-        }
-        else if (property == "texturearrowdown")
-        {
-            m_spriteArrowDown.setTexture(getSharedRenderer()->getTextureArrowDown());
-            updateSize();
-        }
-        else if (property == "texturearrowdownhover")
-        {
-            m_spriteArrowDownHover.setTexture(getSharedRenderer()->getTextureArrowDownHover());
-        }
-        else if (property == "trackcolor")
-        {
-            m_trackColorCached = getSharedRenderer()->getTrackColor();
-        }
-        else if (property == "trackcolorhover")
-        {
-            m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
-        }
-        else if (property == "thumbcolor")
-        {
-            m_thumbColorCached = getSharedRenderer()->getThumbColor();
-        }
-        else if (property == "thumbcolorhover")
-        {
-            m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
-        }
-        else if (property == "arrowbackgroundcolor")
-        {
-            m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
-        }
-        else if (property == "arrowbackgroundcolorhover")
-        {
-            m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
-        }
-        else if (property == "arrowcolor")
-        {
-            m_arrowColorCached = getSharedRenderer()->getArrowColor();
-        }
-        else if (property == "arrowcolorhover")
-        {
-            m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
-        }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
-        {
-            Widget::rendererChanged(property);
-
-            m_spriteTrack.setOpacity(m_opacityCached);
-            m_spriteTrackHover.setOpacity(m_opacityCached);
-            m_spriteThumb.setOpacity(m_opacityCached);
-            m_spriteThumbHover.setOpacity(m_opacityCached);
-            m_spriteArrowUp.setOpacity(m_opacityCached);
-            m_spriteArrowUpHover.setOpacity(m_opacityCached);
-            m_spriteArrowDown.setOpacity(m_opacityCached);
-            m_spriteArrowDownHover.setOpacity(m_opacityCached);
-        }
-        else
-            Widget::rendererChanged(property);
+
+        // The property isn't handled by this widget, or an unknown name only shares the hash of a known property
+        Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -909,7 +946,7 @@ namespace tgui
         if (node->propertyValuePairs["scrollamount"])
             setScrollAmount(strToInt(node->propertyValuePairs["scrollamount"]->value));
         if (node->propertyValuePairs["autohide"])
-            setAutoHide(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["autohide"]->value).getBool());
+            setAutoHide(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["autohide"]).getBool());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
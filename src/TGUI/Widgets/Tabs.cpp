@@ -554,113 +554,156 @@ namespace tgui
 
     void Tabs::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
+        switch (propertyHash(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            recalculateTabsWidth();
-        }
-        else if (property == "textcolor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            updateTextColors();
-        }
-        else if (property == "textcolorhover")
-        {
-            m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
-            updateTextColors();
-        }
-        else if (property == "textcolordisabled")
-        {
-            m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
-            updateTextColors();
-        }
-        else if (property == "selectedtextcolor")
-        {
-            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-            updateTextColors();
-        }
-        else if (property == "selectedtextcolorhover")
-        {
-            m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
-            updateTextColors();
-        }
-        else if (property == "texturetab")
-        {
-            m_spriteTab.setTexture(getSharedRenderer()->getTextureTab());
-        }
-        else if (property == "texturetabhover")
-        {
-            m_spriteTabHover.setTexture(getSharedRenderer()->getTextureTabHover());
-        }
-        else if (property == "textureselectedtab")
-        {
-            m_spriteSelectedTab.setTexture(getSharedRenderer()->getTextureSelectedTab());
-        }
-        else if (property == "textureselectedtabhover")
-        {
-            m_spriteSelectedTabHover.setTexture(getSharedRenderer()->getTextureSelectedTabHover());
-        }
-        else if (property == "texturedisabledtab")
-        {
-            m_spriteDisabledTab.setTexture(getSharedRenderer()->getTextureDisabledTab());
-        }
-        else if (property == "distancetoside")
-        {
-            m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
-            recalculateTabsWidth();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "backgroundcolorhover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == "backgroundcolordisabled")
-        {
-            m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
-        }
-        else if (property == "selectedbackgroundcolor")
-        {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
-        }
-        else if (property == "selectedbackgroundcolorhover")
-        {
-            m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
-        {
-            Widget::rendererChanged(property);
+            TGUI_PROPERTY_CASE(property, "borders")
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                recalculateTabsWidth();
+                return;
+            }
 
-            m_spriteTab.setOpacity(m_opacityCached);
-            m_spriteTabHover.setOpacity(m_opacityCached);
-            m_spriteSelectedTab.setOpacity(m_opacityCached);
-            m_spriteSelectedTabHover.setOpacity(m_opacityCached);
-            m_spriteDisabledTab.setOpacity(m_opacityCached);
+            TGUI_PROPERTY_CASE(property, "textcolor")
+            {
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                updateTextColors();
+                return;
+            }
 
-            for (auto& tab : m_tabs)
-                tab.text.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
+            TGUI_PROPERTY_CASE(property, "textcolorhover")
+            {
+                m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
+                updateTextColors();
+                return;
+            }
 
-            for (auto& tab : m_tabs)
-                tab.text.setFont(m_fontCached);
+            TGUI_PROPERTY_CASE(property, "textcolordisabled")
+            {
+                m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
+                updateTextColors();
+                return;
+            }
 
-            // Recalculate the size when the text is auto sizing
-            if (m_requestedTextSize == 0)
-                setTextSize(0);
-            else
+            TGUI_PROPERTY_CASE(property, "selectedtextcolor")
+            {
+                m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+                updateTextColors();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "selectedtextcolorhover")
+            {
+                m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
+                updateTextColors();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturetab")
+            {
+                m_spriteTab.setTexture(getSharedRenderer()->getTextureTab());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturetabhover")
+            {
+                m_spriteTabHover.setTexture(getSharedRenderer()->getTextureTabHover());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "textureselectedtab")
+            {
+                m_spriteSelectedTab.setTexture(getSharedRenderer()->getTextureSelectedTab());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "textureselectedtabhover")
+            {
+                m_spriteSelectedTabHover.setTexture(getSharedRenderer()->getTextureSelectedTabHover());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturedisabledtab")
+            {
+                m_spriteDisabledTab.setTexture(getSharedRenderer()->getTextureDisabledTab());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "distancetoside")
+            {
+                m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
                 recalculateTabsWidth();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "backgroundcolor")
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "backgroundcolorhover")
+            {
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "backgroundcolordisabled")
+            {
+                m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "selectedbackgroundcolor")
+            {
+                m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "selectedbackgroundcolorhover")
+            {
+                m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "bordercolor")
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "opacity", "opacitydisabled")
+            {
+                Widget::rendererChanged(property);
+
+                m_spriteTab.setOpacity(m_opacityCached);
+                m_spriteTabHover.setOpacity(m_opacityCached);
+                m_spriteSelectedTab.setOpacity(m_opacityCached);
+                m_spriteSelectedTabHover.setOpacity(m_opacityCached);
+                m_spriteDisabledTab.setOpacity(m_opacityCached);
+
+                for (auto& tab : m_tabs)
+                    tab.text.setOpacity(m_opacityCached);
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "font")
+            {
+                Widget::rendererChanged(property);
+
+                for (auto& tab : m_tabs)
+                    tab.text.setFont(m_fontCached);
+
+                // Recalculate the size when the text is auto sizing
+                if (m_requestedTextSize == 0)
+                    setTextSize(0);
+                else
+                    recalculateTabsWidth();
+                return;
+            }
         }
-        else
-            Widget::rendererChanged(property);
+
+        // The property isn't handled by this widget, or an unknown name only shares the hash of a known property
+        Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -408,7 +408,7 @@ namespace tgui
         if (focused)
         {
             m_caretVisible = true;
-            m_animationTimeElapsed = {};
+            restartAnimationTime(sf::milliseconds(500));
         }
         else // Unfocusing
         {
@@ -561,7 +561,7 @@ namespace tgui
 
             // The caret should be visible
             m_caretVisible = true;
-            m_animationTimeElapsed = {};
+            restartAnimationTime(sf::milliseconds(500));
         }
     }
 
@@ -985,7 +985,7 @@ namespace tgui
 
                 // The caret should be visible again
                 m_caretVisible = true;
-                m_animationTimeElapsed = {};
+                restartAnimationTime(sf::milliseconds(500));
 
                 onTextChange.emit(this, m_text);
                 break;
@@ -1082,7 +1082,7 @@ namespace tgui
 
         // The caret should be visible again
         m_caretVisible = true;
-        m_animationTimeElapsed = {};
+        restartAnimationTime(sf::milliseconds(500));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1143,7 +1143,7 @@ namespace tgui
 
         // The caret should be visible again
         m_caretVisible = true;
-        m_animationTimeElapsed = {};
+        restartAnimationTime(sf::milliseconds(500));
 
         onTextChange.emit(this, m_text);
     }
@@ -1622,6 +1622,10 @@ namespace tgui
             // Too slow for double clicking
             m_possibleDoubleClick = false;
         }
+
+        // Keep blinking the caret while the widget is focused
+        if (m_focused)
+            scheduleUpdate(sf::milliseconds(500) - m_animationTimeElapsed);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1770,103 +1774,136 @@ namespace tgui
 
     void TextBox::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == "textcolor")
-        {
-            m_textBeforeSelection.setColor(getSharedRenderer()->getTextColor());
-            m_textAfterSelection1.setColor(getSharedRenderer()->getTextColor());
-            m_textAfterSelection2.setColor(getSharedRenderer()->getTextColor());
-        }
-        else if (property == "selectedtextcolor")
-        {
-            m_textSelection1.setColor(getSharedRenderer()->getSelectedTextColor());
-            m_textSelection2.setColor(getSharedRenderer()->getSelectedTextColor());
-        }
-        else if (property == "defaulttextcolor")
-        {
-            m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
-        }
-        else if (property == "texturebackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == "scrollbar")
+        switch (propertyHash(property))
         {
-            m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
-            m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+            TGUI_PROPERTY_CASE(property, "borders")
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                return;
+            }
 
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (!getSharedRenderer()->getScrollbarWidth())
+            TGUI_PROPERTY_CASE(property, "padding")
             {
-                m_verticalScrollbar->setSize({m_verticalScrollbar->getDefaultWidth(), m_verticalScrollbar->getSize().y});
-                m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, m_horizontalScrollbar->getDefaultWidth()});
+                m_paddingCached = getSharedRenderer()->getPadding();
                 setSize(m_size);
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "textcolor")
+            {
+                m_textBeforeSelection.setColor(getSharedRenderer()->getTextColor());
+                m_textAfterSelection1.setColor(getSharedRenderer()->getTextColor());
+                m_textAfterSelection2.setColor(getSharedRenderer()->getTextColor());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "selectedtextcolor")
+            {
+                m_textSelection1.setColor(getSharedRenderer()->getSelectedTextColor());
+                m_textSelection2.setColor(getSharedRenderer()->getSelectedTextColor());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "defaulttextcolor")
+            {
+                m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturebackground")
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "scrollbar")
+            {
+                m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+                m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (!getSharedRenderer()->getScrollbarWidth())
+                {
+                    m_verticalScrollbar->setSize({m_verticalScrollbar->getDefaultWidth(), m_verticalScrollbar->getSize().y});
+                    m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, m_horizontalScrollbar->getDefaultWidth()});
+                    setSize(m_size);
+                }
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "scrollbarwidth")
+            {
+                const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
+                m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
+                m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
+                setSize(m_size);
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "backgroundcolor")
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "selectedtextbackgroundcolor")
+            {
+                m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "bordercolor")
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "caretcolor")
+            {
+                m_caretColorCached = getSharedRenderer()->getCaretColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "caretwidth")
+            {
+                m_caretWidthCached = getSharedRenderer()->getCaretWidth();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "opacity", "opacitydisabled")
+            {
+                Widget::rendererChanged(property);
+
+                m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
+                m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_textBeforeSelection.setOpacity(m_opacityCached);
+                m_textAfterSelection1.setOpacity(m_opacityCached);
+                m_textAfterSelection2.setOpacity(m_opacityCached);
+                m_textSelection1.setOpacity(m_opacityCached);
+                m_textSelection2.setOpacity(m_opacityCached);
+                m_defaultText.setOpacity(m_opacityCached);
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "font")
+            {
+                Widget::rendererChanged(property);
+
+                m_textBeforeSelection.setFont(m_fontCached);
+                m_textSelection1.setFont(m_fontCached);
+                m_textSelection2.setFont(m_fontCached);
+                m_textAfterSelection1.setFont(m_fontCached);
+                m_textAfterSelection2.setFont(m_fontCached);
+                m_defaultText.setFont(m_fontCached);
+                setTextSize(getTextSize());
+                return;
             }
         }
-        else if (property == "scrollbarwidth")
-        {
-            const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
-            m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
-            m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
-            setSize(m_size);
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "selectedtextbackgroundcolor")
-        {
-            m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "caretcolor")
-        {
-            m_caretColorCached = getSharedRenderer()->getCaretColor();
-        }
-        else if (property == "caretwidth")
-        {
-            m_caretWidthCached = getSharedRenderer()->getCaretWidth();
-        }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
-        {
-            Widget::rendererChanged(property);
-
-            m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
-            m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_textBeforeSelection.setOpacity(m_opacityCached);
-            m_textAfterSelection1.setOpacity(m_opacityCached);
-            m_textAfterSelection2.setOpacity(m_opacityCached);
-            m_textSelection1.setOpacity(m_opacityCached);
-            m_textSelection2.setOpacity(m_opacityCached);
-            m_defaultText.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
-
-            m_textBeforeSelection.setFont(m_fontCached);
-            m_textSelection1.setFont(m_fontCached);
-            m_textSelection2.setFont(m_fontCached);
-            m_textAfterSelection1.setFont(m_fontCached);
-            m_textAfterSelection2.setFont(m_fontCached);
-            m_defaultText.setFont(m_fontCached);
-            setTextSize(getTextSize());
-        }
-        else
-            Widget::rendererChanged(property);
+
+        // The property isn't handled by this widget, or an unknown name only shares the hash of a known property
+        Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1917,7 +1954,7 @@ namespace tgui
         if (node->propertyValuePairs["maximumcharacters"])
             setMaximumCharacters(strToInt(node->propertyValuePairs["maximumcharacters"]->value));
         if (node->propertyValuePairs["readonly"])
-            setReadOnly(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["readonly"]->value).getBool());
+            setReadOnly(Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["readonly"]).getBool());
 
         if (node->propertyValuePairs["verticalscrollbarpolicy"])
         {
@@ -1948,12 +1985,12 @@ namespace tgui
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
         if (node->propertyValuePairs["verticalscrollbarpresent"])
         {
-            const bool present = Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["verticalscrollbarpresent"]->value).getBool();
+            const bool present = Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["verticalscrollbarpresent"]).getBool();
             setVerticalScrollbarPolicy(present ? Scrollbar::Policy::Automatic : Scrollbar::Policy::Never);
         }
         if (node->propertyValuePairs["horizontalscrollbarpresent"])
         {
-            const bool present = Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["horizontalscrollbarpresent"]->value).getBool();
+            const bool present = Deserializer::deserialize(ObjectConverter::Type::Bool, *node->propertyValuePairs["horizontalscrollbarpresent"]).getBool();
             setHorizontalScrollbarPolicy(present ? Scrollbar::Policy::Automatic : Scrollbar::Policy::Never);
         }
 #endif
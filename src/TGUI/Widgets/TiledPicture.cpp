@@ -0,0 +1,349 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/Widgets/TiledPicture.hpp>
+#include <TGUI/Clipping.hpp>
+#include <TGUI/to_string.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <algorithm>
+#include <cmath>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        void replaceAll(std::string& str, const std::string& from, const std::string& to)
+        {
+            std::size_t pos = 0;
+            while ((pos = str.find(from, pos)) != std::string::npos)
+            {
+                str.replace(pos, from.length(), to);
+                pos += to.length();
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TiledPicture::TiledPicture()
+    {
+        m_type = "TiledPicture";
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TiledPicture::TiledPicture(const TiledPicture& other) :
+        ClickableWidget{other},
+        m_tileLoader   {other.m_tileLoader},
+        m_imageSize    {other.m_imageSize},
+        m_tileSize     {other.m_tileSize},
+        m_levelCount   {other.m_levelCount},
+        m_visibleRect  {other.m_visibleRect},
+        m_cacheBudget  {other.m_cacheBudget}
+    {
+        updateVisibleTiles();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TiledPicture& TiledPicture::operator= (const TiledPicture& other)
+    {
+        if (this != &other)
+        {
+            ClickableWidget::operator=(other);
+            m_tileLoader = other.m_tileLoader;
+            m_imageSize = other.m_imageSize;
+            m_tileSize = other.m_tileSize;
+            m_levelCount = other.m_levelCount;
+            m_visibleRect = other.m_visibleRect;
+            m_cacheBudget = other.m_cacheBudget;
+
+            clearTiles();
+            updateVisibleTiles();
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TiledPicture::Ptr TiledPicture::create()
+    {
+        return std::make_shared<TiledPicture>();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TiledPicture::Ptr TiledPicture::copy(TiledPicture::ConstPtr picture)
+    {
+        if (picture)
+            return std::static_pointer_cast<TiledPicture>(picture->clone());
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TiledPicture::setSource(sf::Vector2u imageSize, unsigned int tileSize, unsigned int levelCount, TileLoader loader)
+    {
+        m_tileLoader = std::move(loader);
+        m_imageSize = imageSize;
+        m_tileSize = std::max(tileSize, 1u);
+        m_levelCount = std::max(levelCount, 1u);
+        m_visibleRect = {0, 0, static_cast<float>(imageSize.x), static_cast<float>(imageSize.y)};
+
+        clearTiles();
+        updateVisibleTiles();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TiledPicture::setSource(const std::string& filenamePattern, sf::Vector2u imageSize, unsigned int tileSize, unsigned int levelCount)
+    {
+        setSource(imageSize, tileSize, levelCount,
+            [filenamePattern](unsigned int level, unsigned int column, unsigned int row, sf::Image& tile)
+            {
+                std::string filename = filenamePattern;
+                replaceAll(filename, "{level}", to_string(level));
+                replaceAll(filename, "{column}", to_string(column));
+                replaceAll(filename, "{row}", to_string(row));
+                return tile.loadFromFile(filename);
+            });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Vector2u TiledPicture::getImageSize() const
+    {
+        return m_imageSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TiledPicture::getTileSize() const
+    {
+        return m_tileSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TiledPicture::getLevelCount() const
+    {
+        return m_levelCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TiledPicture::setVisibleRect(const FloatRect& rect)
+    {
+        m_visibleRect = rect;
+        updateVisibleTiles();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FloatRect TiledPicture::getVisibleRect() const
+    {
+        return m_visibleRect;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TiledPicture::getVisibleLevel() const
+    {
+        return m_visibleLevel;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TiledPicture::setCacheBudget(std::size_t bytes)
+    {
+        m_cacheBudget = bytes;
+        updateVisibleTiles();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TiledPicture::getCacheBudget() const
+    {
+        return m_cacheBudget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TiledPicture::getCacheMemoryUsage() const
+    {
+        return m_cacheMemoryUsage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TiledPicture::getCachedTileCount() const
+    {
+        return m_tiles.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TiledPicture::setSize(const Layout2d& size)
+    {
+        Widget::setSize(size);
+        updateVisibleTiles();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TiledPicture::updateVisibleTiles()
+    {
+        for (auto& tileIt : m_visibleTiles)
+            tileIt->visible = false;
+        m_visibleTiles.clear();
+
+        const Vector2f size = getSize();
+        if (m_tileLoader && (m_imageSize.x > 0) && (m_imageSize.y > 0) && (size.x > 0) && (size.y > 0)
+         && (m_visibleRect.width > 0) && (m_visibleRect.height > 0))
+        {
+            // Pick the most detailed level that still has at least one pixel per pixel on the screen
+            const float imagePixelsPerPixel = std::max(m_visibleRect.width / size.x, m_visibleRect.height / size.y);
+            m_visibleLevel = 0;
+            while ((m_visibleLevel + 1 < m_levelCount) && (m_visibleLevel + 1 < 32)
+                && (imagePixelsPerPixel >= static_cast<float>(2u << m_visibleLevel)))
+            {
+                ++m_visibleLevel;
+            }
+
+            const unsigned int levelScale = 1u << m_visibleLevel;
+            const unsigned int levelWidth = (m_imageSize.x + levelScale - 1) / levelScale;
+            const unsigned int levelHeight = (m_imageSize.y + levelScale - 1) / levelScale;
+            const unsigned int columnCount = (levelWidth + m_tileSize - 1) / m_tileSize;
+            const unsigned int rowCount = (levelHeight + m_tileSize - 1) / m_tileSize;
+
+            const float tileSizeInImage = static_cast<float>(m_tileSize) * levelScale;
+            const auto firstTile = [](float pos, float tileSize) {
+                return static_cast<unsigned int>(std::max(0.f, std::floor(pos / tileSize)));
+            };
+            const auto lastTile = [](float pos, float tileSize, unsigned int count) {
+                return std::min(count, static_cast<unsigned int>(std::max(0.f, std::ceil(pos / tileSize))));
+            };
+
+            const unsigned int firstColumn = firstTile(m_visibleRect.left, tileSizeInImage);
+            const unsigned int endColumn = lastTile(m_visibleRect.left + m_visibleRect.width, tileSizeInImage, columnCount);
+            const unsigned int firstRow = firstTile(m_visibleRect.top, tileSizeInImage);
+            const unsigned int endRow = lastTile(m_visibleRect.top + m_visibleRect.height, tileSizeInImage, rowCount);
+
+            for (unsigned int row = firstRow; row < endRow; ++row)
+            {
+                for (unsigned int column = firstColumn; column < endColumn; ++column)
+                {
+                    const std::uint64_t key = (static_cast<std::uint64_t>(m_visibleLevel) << 56)
+                                            | (static_cast<std::uint64_t>(column) << 28)
+                                            | static_cast<std::uint64_t>(row);
+
+                    const auto it = m_tileLookup.find(key);
+                    if (it != m_tileLookup.end())
+                    {
+                        // Move the tile to the front of the list, it was used most recently
+                        m_tiles.splice(m_tiles.begin(), m_tiles, it->second);
+                    }
+                    else
+                    {
+                        Tile tile;
+                        tile.key = key;
+                        tile.level = m_visibleLevel;
+                        tile.column = column;
+                        tile.row = row;
+
+                        sf::Image image;
+                        if (m_tileLoader(m_visibleLevel, column, row, image) && (image.getSize().x > 0) && (image.getSize().y > 0))
+                        {
+                            tile.loaded = tile.texture.loadFromImage(image);
+                            if (tile.loaded)
+                                tile.memory = static_cast<std::size_t>(image.getSize().x) * image.getSize().y * 4;
+                        }
+
+                        m_cacheMemoryUsage += tile.memory;
+                        m_tiles.push_front(std::move(tile));
+                        m_tileLookup[key] = m_tiles.begin();
+                    }
+
+                    m_tiles.front().visible = true;
+                    m_visibleTiles.push_back(m_tiles.begin());
+                }
+            }
+        }
+
+        // The visible tiles are at the front of the list, so only tiles that aren't visible are removed
+        while ((m_cacheMemoryUsage > m_cacheBudget) && !m_tiles.empty() && !m_tiles.back().visible)
+        {
+            m_cacheMemoryUsage -= m_tiles.back().memory;
+            m_tileLookup.erase(m_tiles.back().key);
+            m_tiles.pop_back();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TiledPicture::clearTiles()
+    {
+        m_visibleTiles.clear();
+        m_tileLookup.clear();
+        m_tiles.clear();
+        m_cacheMemoryUsage = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TiledPicture::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        if ((getSize().x <= 0) || (getSize().y <= 0) || (m_visibleRect.width <= 0) || (m_visibleRect.height <= 0))
+            return;
+
+        states.transform.translate(getPosition());
+        const Clipping clipping{target, states, {}, getSize()};
+
+        const Vector2f scale{getSize().x / m_visibleRect.width, getSize().y / m_visibleRect.height};
+        const float levelScale = static_cast<float>(1u << m_visibleLevel);
+        const float tileSizeInImage = static_cast<float>(m_tileSize) * levelScale;
+        for (const auto& tileIt : m_visibleTiles)
+        {
+            const Tile& tile = *tileIt;
+            if (!tile.loaded)
+                continue;
+
+            sf::Sprite sprite{tile.texture};
+            sprite.setPosition({((tile.column * tileSizeInImage) - m_visibleRect.left) * scale.x,
+                                ((tile.row * tileSizeInImage) - m_visibleRect.top) * scale.y});
+            sprite.setScale({levelScale * scale.x, levelScale * scale.y});
+            sprite.setColor(Color::calcColorOpacity(Color::White, m_opacityCached));
+            target.draw(sprite, states);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -748,7 +748,7 @@ namespace tgui
             }
             else if (!iconPressed)
             {
-                m_animationTimeElapsed = {};
+                restartAnimationTime(sf::milliseconds(getDoubleClickTime()));
                 m_possibleDoubleClick = true;
                 m_doubleClickNodeIndex = selectedIndex;
             }
@@ -862,119 +862,158 @@ namespace tgui
 
     void TreeView::rendererChanged(const std::string& property)
     {
-        if (property == "borders")
+        switch (propertyHash(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "selectedbackgroundcolor")
-        {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
-        }
-        else if (property == "backgroundcolorhover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == "selectedbackgroundcolorhover")
-        {
-            m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "texturebranchexpanded")
-        {
-            m_spriteBranchExpanded.setTexture(getSharedRenderer()->getTextureBranchExpanded());
-            updateIconBounds();
-            markNodesDirty();
-        }
-        else if (property == "texturebranchcollapsed")
-        {
-            m_spriteBranchCollapsed.setTexture(getSharedRenderer()->getTextureBranchCollapsed());
-            updateIconBounds();
-            markNodesDirty();
-        }
-        else if (property == "textureleaf")
-        {
-            m_spriteLeaf.setTexture(getSharedRenderer()->getTextureLeaf());
-            updateIconBounds();
-            markNodesDirty();
-        }
-        else if (property == "textcolor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            updateTextColors(m_nodes);
-            updateSelectedAndHoveringItemColors();
-        }
-        else if (property == "textcolorhover")
-        {
-            m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
-            updateTextColors(m_nodes);
-            updateSelectedAndHoveringItemColors();
-        }
-        else if (property == "selectedtextcolor")
-        {
-            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-            updateTextColors(m_nodes);
-            updateSelectedAndHoveringItemColors();
-        }
-        else if (property == "selectedtextcolorhover")
-        {
-            m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
-            updateTextColors(m_nodes);
-            updateSelectedAndHoveringItemColors();
-        }
-        else if (property == "scrollbar")
-        {
-            m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
-            m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+            TGUI_PROPERTY_CASE(property, "borders")
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                return;
+            }
 
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (!getSharedRenderer()->getScrollbarWidth())
+            TGUI_PROPERTY_CASE(property, "padding")
             {
-                const float width = m_verticalScrollbar->getDefaultWidth();
+                m_paddingCached = getSharedRenderer()->getPadding();
+                setSize(m_size);
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "backgroundcolor")
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "selectedbackgroundcolor")
+            {
+                m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "backgroundcolorhover")
+            {
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "selectedbackgroundcolorhover")
+            {
+                m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "bordercolor")
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturebranchexpanded")
+            {
+                m_spriteBranchExpanded.setTexture(getSharedRenderer()->getTextureBranchExpanded());
+                updateIconBounds();
+                markNodesDirty();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "texturebranchcollapsed")
+            {
+                m_spriteBranchCollapsed.setTexture(getSharedRenderer()->getTextureBranchCollapsed());
+                updateIconBounds();
+                markNodesDirty();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "textureleaf")
+            {
+                m_spriteLeaf.setTexture(getSharedRenderer()->getTextureLeaf());
+                updateIconBounds();
+                markNodesDirty();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "textcolor")
+            {
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                updateTextColors(m_nodes);
+                updateSelectedAndHoveringItemColors();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "textcolorhover")
+            {
+                m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
+                updateTextColors(m_nodes);
+                updateSelectedAndHoveringItemColors();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "selectedtextcolor")
+            {
+                m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+                updateTextColors(m_nodes);
+                updateSelectedAndHoveringItemColors();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "selectedtextcolorhover")
+            {
+                m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
+                updateTextColors(m_nodes);
+                updateSelectedAndHoveringItemColors();
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "scrollbar")
+            {
+                m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+                m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (!getSharedRenderer()->getScrollbarWidth())
+                {
+                    const float width = m_verticalScrollbar->getDefaultWidth();
+                    m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
+                    m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
+                    markNodesDirty();
+                }
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "scrollbarwidth")
+            {
+                const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
                 m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
                 m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
                 markNodesDirty();
+                return;
             }
-        }
-        else if (property == "scrollbarwidth")
-        {
-            const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
-            m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
-            m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
-            markNodesDirty();
-        }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
-        {
-            Widget::rendererChanged(property);
 
-            setTextOpacityImpl(m_nodes, m_opacityCached);
+            TGUI_PROPERTY_CASE(property, "opacity", "opacitydisabled")
+            {
+                Widget::rendererChanged(property);
+
+                setTextOpacityImpl(m_nodes, m_opacityCached);
 
-            m_spriteBranchExpanded.setOpacity(m_opacityCached);
-            m_spriteBranchCollapsed.setOpacity(m_opacityCached);
-            m_spriteLeaf.setOpacity(m_opacityCached);
+                m_spriteBranchExpanded.setOpacity(m_opacityCached);
+                m_spriteBranchCollapsed.setOpacity(m_opacityCached);
+                m_spriteLeaf.setOpacity(m_opacityCached);
 
-            m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
-            m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
-            setTextFontImpl(m_nodes, m_fontCached);
+                m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
+                m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
+                return;
+            }
+
+            TGUI_PROPERTY_CASE(property, "font")
+            {
+                Widget::rendererChanged(property);
+                setTextFontImpl(m_nodes, m_fontCached);
+                return;
+            }
         }
-        else
-            Widget::rendererChanged(property);
+
+        // The property isn't handled by this widget, or an unknown name only shares the hash of a known property
+        Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1017,6 +1056,8 @@ namespace tgui
             m_animationTimeElapsed = {};
             m_possibleDoubleClick = false;
         }
+        else if (m_possibleDoubleClick) // Check again once the time for a double click has passed
+            scheduleUpdate(sf::milliseconds(getDoubleClickTime()) - m_animationTimeElapsed);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,499 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Widgets/VirtualListPanel.hpp>
+#include <algorithm>
+#include <cmath>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    VirtualListPanel::VirtualListPanel(const Layout2d& size) :
+        ScrollablePanel{size}
+    {
+        m_type = "VirtualListPanel";
+
+        setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    VirtualListPanel::VirtualListPanel(const VirtualListPanel& other) :
+        ScrollablePanel  {other},
+        m_createItemFunc {other.m_createItemFunc},
+        m_bindItemFunc   {other.m_bindItemFunc},
+        m_itemHeightFunc {other.m_itemHeightFunc},
+        m_itemCount      {other.m_itemCount},
+        m_itemHeight     {other.m_itemHeight},
+        m_itemPositions  {other.m_itemPositions},
+        m_bufferItemCount{other.m_bufferItemCount}
+    {
+        removeCopiedItemWidgets(other);
+        updateVisibleItems();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    VirtualListPanel& VirtualListPanel::operator= (const VirtualListPanel& other)
+    {
+        if (this != &other)
+        {
+            ScrollablePanel::operator=(other);
+            m_createItemFunc = other.m_createItemFunc;
+            m_bindItemFunc = other.m_bindItemFunc;
+            m_itemHeightFunc = other.m_itemHeightFunc;
+            m_itemCount = other.m_itemCount;
+            m_itemHeight = other.m_itemHeight;
+            m_itemPositions = other.m_itemPositions;
+            m_bufferItemCount = other.m_bufferItemCount;
+
+            // The old item widgets were already removed when the widgets of the other panel were copied
+            m_itemWidgets.clear();
+            m_unusedWidgets.clear();
+            m_firstItemWithWidget = 0;
+            m_itemsOutdated = true;
+
+            removeCopiedItemWidgets(other);
+            updateVisibleItems();
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    VirtualListPanel::Ptr VirtualListPanel::create(Layout2d size)
+    {
+        return std::make_shared<VirtualListPanel>(size);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    VirtualListPanel::Ptr VirtualListPanel::copy(VirtualListPanel::ConstPtr panel)
+    {
+        if (panel)
+            return std::static_pointer_cast<VirtualListPanel>(panel->clone());
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VirtualListPanel::setSize(const Layout2d& size)
+    {
+        ScrollablePanel::setSize(size);
+        updateVisibleItems();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VirtualListPanel::setItemCreator(const CreateItemFunc& func)
+    {
+        m_createItemFunc = func;
+
+        // Widgets made by the previous function might not be able to show the items anymore
+        removeItemWidgets();
+        updateVisibleItems();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VirtualListPanel::setItemBinder(const BindItemFunc& func)
+    {
+        m_bindItemFunc = func;
+        refreshItems();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VirtualListPanel::setItemCount(std::size_t itemCount)
+    {
+        m_itemCount = itemCount;
+        updateItemPositions();
+        updateVisibleItems();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t VirtualListPanel::getItemCount() const
+    {
+        return m_itemCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VirtualListPanel::setItemHeight(float itemHeight)
+    {
+        m_itemHeight = std::max(itemHeight, 1.f);
+        m_itemHeightFunc = nullptr;
+
+        updateItemPositions();
+        updateVisibleItems();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float VirtualListPanel::getItemHeight() const
+    {
+        return m_itemHeight;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VirtualListPanel::setItemHeightFunction(const ItemHeightFunc& func)
+    {
+        m_itemHeightFunc = func;
+
+        updateItemPositions();
+        updateVisibleItems();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VirtualListPanel::setBufferItemCount(std::size_t itemCount)
+    {
+        m_bufferItemCount = itemCount;
+        updateVisibleItems();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t VirtualListPanel::getBufferItemCount() const
+    {
+        return m_bufferItemCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VirtualListPanel::refreshItems()
+    {
+        m_itemsOutdated = true;
+        updateVisibleItems();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VirtualListPanel::refreshItem(std::size_t index)
+    {
+        const Widget::Ptr widget = getItemWidget(index);
+        if (widget && m_bindItemFunc)
+            m_bindItemFunc(widget, index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::Ptr VirtualListPanel::getItemWidget(std::size_t index) const
+    {
+        if ((index < m_firstItemWithWidget) || (index >= m_firstItemWithWidget + m_itemWidgets.size()))
+            return nullptr;
+
+        return m_itemWidgets[index - m_firstItemWithWidget];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VirtualListPanel::scrollToItem(std::size_t index)
+    {
+        if (index >= m_itemCount)
+            return;
+
+        setVerticalScrollbarValue(static_cast<unsigned int>(getItemTop(index)));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VirtualListPanel::setVerticalScrollbarValue(unsigned int value)
+    {
+        ScrollablePanel::setVerticalScrollbarValue(value);
+        updateVisibleItems();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VirtualListPanel::leftMousePressed(Vector2f pos)
+    {
+        ScrollablePanel::leftMousePressed(pos);
+        updateVisibleItems();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VirtualListPanel::mouseMoved(Vector2f pos)
+    {
+        ScrollablePanel::mouseMoved(pos);
+        updateVisibleItems();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool VirtualListPanel::mouseWheelScrolled(float delta, Vector2f pos)
+    {
+        const bool handled = ScrollablePanel::mouseWheelScrolled(delta, pos);
+        updateVisibleItems();
+        return handled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VirtualListPanel::update(sf::Time elapsedTime)
+    {
+        // The panel can also be scrolled in ways that aren't passed through this class (e.g. through a ScrollablePanel pointer)
+        updateVisibleItems();
+
+        ScrollablePanel::update(elapsedTime);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> VirtualListPanel::save(SavingRenderersMap& renderers) const
+    {
+        auto node = ScrollablePanel::save(renderers);
+
+        // The item widgets are created by the item functions, so they aren't saved. The nodes of the child widgets are
+        // stored in the same order as m_widgets, followed by the nodes of widgets that haven't been loaded yet.
+        const std::size_t firstWidgetNode = node->children.size() - m_pendingWidgetNodes.size() - m_widgets.size();
+        const auto itemWidgetIndices = getItemWidgetIndices();
+        for (auto it = itemWidgetIndices.rbegin(); it != itemWidgetIndices.rend(); ++it)
+            node->children.erase(node->children.begin() + static_cast<std::ptrdiff_t>(firstWidgetNode + *it));
+
+        // The content size depends on the items
+        node->propertyValuePairs.erase("ContentSize");
+
+        node->propertyValuePairs["ItemHeight"] = std::make_unique<DataIO::ValueNode>(to_string(m_itemHeight));
+        node->propertyValuePairs["BufferItemCount"] = std::make_unique<DataIO::ValueNode>(to_string(m_bufferItemCount));
+        return node;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VirtualListPanel::load(const std::unique_ptr<DataIO::Node>& node, const LoadingRenderersMap& renderers)
+    {
+        ScrollablePanel::load(node, renderers);
+
+        // Widgets that were loaded from the file don't belong to any item, only the old item widgets are replaced
+        removeItemWidgets();
+
+        if (node->propertyValuePairs["itemheight"])
+            setItemHeight(strToFloat(node->propertyValuePairs["itemheight"]->value));
+        if (node->propertyValuePairs["bufferitemcount"])
+            setBufferItemCount(static_cast<std::size_t>(strToInt(node->propertyValuePairs["bufferitemcount"]->value)));
+
+        updateItemPositions();
+        updateVisibleItems();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float VirtualListPanel::getItemTop(std::size_t index) const
+    {
+        if (m_itemHeightFunc)
+            return m_itemPositions[index];
+        else
+            return static_cast<float>(index) * m_itemHeight;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float VirtualListPanel::getItemHeightAt(std::size_t index) const
+    {
+        if (m_itemHeightFunc)
+            return m_itemPositions[index + 1] - m_itemPositions[index];
+        else
+            return m_itemHeight;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t VirtualListPanel::getItemAtPosition(float y) const
+    {
+        if (m_itemCount == 0)
+            return 0;
+
+        std::size_t index;
+        if (m_itemHeightFunc)
+        {
+            // The positions are sorted, so the item can be found with a binary search
+            const auto it = std::upper_bound(m_itemPositions.begin(), m_itemPositions.end() - 1, y);
+            index = (it == m_itemPositions.begin()) ? 0 : static_cast<std::size_t>(it - m_itemPositions.begin()) - 1;
+        }
+        else
+            index = (y > 0) ? static_cast<std::size_t>(y / m_itemHeight) : 0;
+
+        return std::min(index, m_itemCount - 1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VirtualListPanel::updateItemPositions()
+    {
+        float totalHeight;
+        if (m_itemHeightFunc)
+        {
+            m_itemPositions.resize(m_itemCount + 1);
+            m_itemPositions[0] = 0;
+            for (std::size_t i = 0; i < m_itemCount; ++i)
+                m_itemPositions[i + 1] = m_itemPositions[i] + std::max(m_itemHeightFunc(i), 0.f);
+
+            totalHeight = m_itemPositions.back();
+        }
+        else
+        {
+            m_itemPositions.clear();
+            totalHeight = static_cast<float>(m_itemCount) * m_itemHeight;
+        }
+
+        // The items may have moved
+        m_itemsOutdated = true;
+
+        setContentSize({0, totalHeight});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VirtualListPanel::updateVisibleItems()
+    {
+        // Find out which items lie near the visible area
+        std::size_t firstItem = 0;
+        std::size_t lastItem = 0;
+        if ((m_itemCount > 0) && m_createItemFunc)
+        {
+            const float top = getContentOffset().y;
+            firstItem = getItemAtPosition(top);
+            lastItem = getItemAtPosition(top + getInnerSize().y) + 1;
+
+            firstItem = (firstItem > m_bufferItemCount) ? firstItem - m_bufferItemCount : 0;
+            lastItem = std::min(lastItem + m_bufferItemCount, m_itemCount);
+        }
+
+        // The items don't fill the area below the vertical scrollbar
+        const float contentHeight = getContentSize().y;
+        const bool verticalScrollbarShown = (getVerticalScrollbarPolicy() == Scrollbar::Policy::Always)
+            || ((getVerticalScrollbarPolicy() == Scrollbar::Policy::Automatic) && (contentHeight > getInnerSize().y));
+        const float itemWidth = std::max(0.f, getInnerSize().x - (verticalScrollbarShown ? getScrollbarWidth() : 0));
+
+        if (!m_itemsOutdated && (firstItem == m_firstItemWithWidget) && (lastItem == m_firstItemWithWidget + m_itemWidgets.size())
+         && (itemWidth == m_itemWidth))
+            return;
+
+        const bool rebindAll = m_itemsOutdated || (itemWidth != m_itemWidth);
+        m_itemsOutdated = false;
+        m_itemWidth = itemWidth;
+
+        // Widgets of items that remain near the visible area are kept, the others become available for other items
+        std::vector<Widget::Ptr> itemWidgets(lastItem - firstItem);
+        for (std::size_t i = 0; i < m_itemWidgets.size(); ++i)
+        {
+            const std::size_t index = m_firstItemWithWidget + i;
+            if ((index >= firstItem) && (index < lastItem))
+                itemWidgets[index - firstItem] = std::move(m_itemWidgets[i]);
+            else
+            {
+                ScrollablePanel::remove(m_itemWidgets[i]);
+                m_unusedWidgets.push_back(std::move(m_itemWidgets[i]));
+            }
+        }
+
+        for (std::size_t i = 0; i < itemWidgets.size(); ++i)
+        {
+            const std::size_t index = firstItem + i;
+            Widget::Ptr& widget = itemWidgets[i];
+
+            const bool newWidget = !widget;
+            if (newWidget)
+            {
+                if (!m_unusedWidgets.empty())
+                {
+                    widget = std::move(m_unusedWidgets.back());
+                    m_unusedWidgets.pop_back();
+                }
+                else
+                    widget = m_createItemFunc();
+
+                ScrollablePanel::add(widget);
+            }
+
+            if (newWidget || rebindAll)
+            {
+                widget->setSize({itemWidth, getItemHeightAt(index)});
+                widget->setPosition({0, getItemTop(index)});
+
+                if (m_bindItemFunc)
+                    m_bindItemFunc(widget, index);
+            }
+        }
+
+        // Don't keep more unused widgets around than needed to fill the visible area
+        if (m_unusedWidgets.size() > itemWidgets.size())
+            m_unusedWidgets.resize(itemWidgets.size());
+
+        m_firstItemWithWidget = firstItem;
+        m_itemWidgets = std::move(itemWidgets);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VirtualListPanel::removeItemWidgets()
+    {
+        for (const auto& widget : m_itemWidgets)
+            ScrollablePanel::remove(widget);
+
+        m_itemWidgets.clear();
+        m_unusedWidgets.clear();
+        m_firstItemWithWidget = 0;
+        m_itemsOutdated = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VirtualListPanel::removeCopiedItemWidgets(const VirtualListPanel& other)
+    {
+        // The copied widgets are stored in the same order as the widgets of the other panel
+        const auto itemWidgetIndices = other.getItemWidgetIndices();
+        for (auto it = itemWidgetIndices.rbegin(); it != itemWidgetIndices.rend(); ++it)
+            ScrollablePanel::remove(m_widgets[*it]);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::size_t> VirtualListPanel::getItemWidgetIndices() const
+    {
+        std::vector<std::size_t> indices;
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        {
+            if (std::find(m_itemWidgets.begin(), m_itemWidgets.end(), m_widgets[i]) != m_itemWidgets.end())
+                indices.push_back(i);
+        }
+
+        return indices;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
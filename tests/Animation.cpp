@@ -220,6 +220,165 @@ TEST_CASE("[Animation]") {
             REQUIRE(!widget->isAnimationPlaying());
         }
 
+        SECTION("Transform-only animations") {
+            tgui::setTransformOnlyShowAnimations(true);
+
+            unsigned int boundLayoutChanges = 0;
+            auto label = tgui::Label::create();
+            label->setPosition({bindRight(widget), bindBottom(widget)});
+            label->connect("PositionChanged", [&]{ boundLayoutChanges++; });
+            parent->add(label);
+
+            // The geometry of the widget doesn't change while the animation plays
+            widget->showWithEffect(tgui::ShowAnimationType::Scale, sf::milliseconds(300));
+            widget->update(sf::milliseconds(100));
+            REQUIRE(widget->getPosition() == sf::Vector2f(30, 15));
+            REQUIRE(widget->getSize() == sf::Vector2f(120, 30));
+            REQUIRE(widget->isAnimationPlaying());
+            widget->update(sf::milliseconds(200));
+            REQUIRE(!widget->isAnimationPlaying());
+
+            widget->hideWithEffect(tgui::ShowAnimationType::SlideToLeft, sf::milliseconds(300));
+            widget->update(sf::milliseconds(100));
+            REQUIRE(widget->getPosition() == sf::Vector2f(30, 15));
+            REQUIRE(widget->isVisible());
+            widget->update(sf::milliseconds(200));
+            REQUIRE(widget->getPosition() == sf::Vector2f(30, 15));
+            REQUIRE(!widget->isVisible());
+
+            widget->showWithEffect(tgui::ShowAnimationType::SlideFromBottom, sf::milliseconds(300));
+            widget->update(sf::milliseconds(150));
+            REQUIRE(widget->getPosition() == sf::Vector2f(30, 15));
+            REQUIRE(widget->isVisible());
+
+            // Starting a new animation finishes the old one
+            widget->hideWithEffect(tgui::ShowAnimationType::Scale, sf::milliseconds(300));
+            widget->update(sf::milliseconds(300));
+            REQUIRE(widget->getPosition() == sf::Vector2f(30, 15));
+            REQUIRE(widget->getSize() == sf::Vector2f(120, 30));
+            REQUIRE(!widget->isVisible());
+            REQUIRE(!widget->isAnimationPlaying());
+
+            // Layouts bound to the widget were never recalculated
+            REQUIRE(boundLayoutChanges == 0);
+            REQUIRE(label->getPosition() == sf::Vector2f(150, 45));
+
+            tgui::setTransformOnlyShowAnimations(false);
+        }
+
         // TODO: Add tests for simultaneous animations (tests for both same type and different types)
     }
+
+    SECTION("Move and resize with animation") {
+        widget->moveWithAnimation({130, 65}, sf::milliseconds(200));
+        widget->resizeWithAnimation({60, 90}, sf::milliseconds(200), tgui::EasingType::EaseIn);
+        REQUIRE(widget->isAnimationPlaying());
+        widget->update(sf::milliseconds(100));
+        REQUIRE(compareVector2f(widget->getPosition(), {80, 40}));
+        REQUIRE(compareVector2f(widget->getSize(), {105, 45}));
+
+        // Starting a new animation finishes the old one first
+        widget->moveWithAnimation({0, 0}, sf::milliseconds(200));
+        REQUIRE(compareVector2f(widget->getPosition(), {130, 65}));
+        widget->update(sf::milliseconds(200));
+        REQUIRE(widget->getPosition() == sf::Vector2f(0, 0));
+        REQUIRE(widget->getSize() == sf::Vector2f(60, 90));
+        REQUIRE(!widget->isAnimationPlaying());
+    }
+
+    SECTION("AnimationScheduler") {
+        tgui::AnimationScheduler scheduler;
+
+        SECTION("Easing") {
+            REQUIRE(tgui::AnimationScheduler::applyEasing(tgui::EasingType::Linear, 0.25f) == 0.25f);
+            REQUIRE(tgui::AnimationScheduler::applyEasing(tgui::EasingType::EaseIn, 0.5f) == 0.25f);
+            REQUIRE(tgui::AnimationScheduler::applyEasing(tgui::EasingType::EaseOut, 0.5f) == 0.75f);
+            REQUIRE(tgui::AnimationScheduler::applyEasing(tgui::EasingType::EaseInOut, 0.25f) == 0.125f);
+            REQUIRE(tgui::AnimationScheduler::applyEasing(tgui::EasingType::EaseInOut, 0.75f) == 0.875f);
+
+            for (auto easing : {tgui::EasingType::Linear, tgui::EasingType::EaseIn, tgui::EasingType::EaseOut, tgui::EasingType::EaseInOut})
+            {
+                REQUIRE(tgui::AnimationScheduler::applyEasing(easing, 0) == 0);
+                REQUIRE(tgui::AnimationScheduler::applyEasing(easing, 1) == 1);
+            }
+        }
+
+        SECTION("Renderer color") {
+            scheduler.animateRendererColor(parent, "BackgroundColor", {0, 100, 200, 0}, {200, 100, 0, 255}, sf::milliseconds(400));
+            scheduler.update(sf::milliseconds(100));
+            REQUIRE(parent->getRenderer()->getProperty("BackgroundColor").getColor() == tgui::Color(50, 100, 150, 64));
+            scheduler.update(sf::milliseconds(300));
+            REQUIRE(parent->getRenderer()->getProperty("BackgroundColor").getColor() == tgui::Color(200, 100, 0, 255));
+            REQUIRE(scheduler.getAnimationCount() == 0);
+        }
+
+        SECTION("Finishing animations") {
+            unsigned int finishedCount = 0;
+            scheduler.animatePosition(widget, {0, 0}, {100, 50}, sf::milliseconds(300), tgui::EasingType::Linear, [&]{ ++finishedCount; });
+            scheduler.animateOpacity(widget, 0, 1, sf::milliseconds(300), tgui::EasingType::Linear, [&]{ ++finishedCount; });
+            REQUIRE(scheduler.getAnimationCount() == 2);
+            REQUIRE(scheduler.hasAnimations(widget.get()));
+            REQUIRE(!scheduler.hasAnimations(parent.get()));
+
+            scheduler.finishAnimations(widget.get(), tgui::AnimationScheduler::Property::Position);
+            REQUIRE(widget->getPosition() == sf::Vector2f(100, 50));
+            REQUIRE(finishedCount == 1);
+            REQUIRE(scheduler.getAnimationCount() == 1);
+
+            scheduler.finishAnimations(widget.get());
+            REQUIRE(widget->getInheritedOpacity() == 1);
+            REQUIRE(finishedCount == 2);
+            REQUIRE(scheduler.getAnimationCount() == 0);
+        }
+
+        SECTION("Destroyed widgets") {
+            bool finished = false;
+            auto otherWidget = tgui::ClickableWidget::create();
+            scheduler.animateSize(otherWidget, {0, 0}, {100, 50}, sf::milliseconds(300), tgui::EasingType::Linear, [&]{ finished = true; });
+            otherWidget = nullptr;
+            scheduler.update(sf::milliseconds(100));
+            REQUIRE(scheduler.getAnimationCount() == 0);
+            REQUIRE(!finished);
+        }
+    }
+
+    SECTION("Animations inside gui") {
+        tgui::Gui gui;
+        gui.add(parent);
+
+        widget->hideWithEffect(tgui::ShowAnimationType::SlideToLeft, sf::milliseconds(300));
+        REQUIRE(widget->isAnimationPlaying());
+        REQUIRE(gui.getAnimationScheduler().getAnimationCount() == 1);
+
+        // The gui plays the animation, updating the widget itself has no effect
+        widget->update(sf::milliseconds(100));
+        REQUIRE(widget->getPosition() == sf::Vector2f(30, 15));
+
+        gui.updateTime(sf::milliseconds(100));
+        REQUIRE(compareVector2f(widget->getPosition(), {30.f-((120.f+30.f)/3.f), 15}));
+
+        gui.updateTime(sf::milliseconds(200));
+        REQUIRE(widget->getPosition() == sf::Vector2f(30, 15));
+        REQUIRE(!widget->isVisible());
+        REQUIRE(!widget->isAnimationPlaying());
+        REQUIRE(gui.getAnimationScheduler().getAnimationCount() == 0);
+
+        SECTION("Removed widgets are no longer animated") {
+            widget->moveWithAnimation({100, 50}, sf::milliseconds(300));
+            parent->resizeWithAnimation({200, 100}, sf::milliseconds(300));
+            REQUIRE(gui.getAnimationScheduler().getAnimationCount() == 2);
+
+            parent->remove(widget);
+            REQUIRE(widget->getPosition() == sf::Vector2f(100, 50));
+            REQUIRE(gui.getAnimationScheduler().getAnimationCount() == 1);
+
+            // Animations of widgets inside a removed container are finished as well
+            parent->add(widget);
+            widget->moveWithAnimation({0, 0}, sf::milliseconds(300));
+            gui.removeAllWidgets();
+            REQUIRE(widget->getPosition() == sf::Vector2f(0, 0));
+            REQUIRE(parent->getSize() == sf::Vector2f(200, 100));
+            REQUIRE(gui.getAnimationScheduler().getAnimationCount() == 0);
+        }
+    }
 }
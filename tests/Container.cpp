@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/TGUI.hpp>
+#include <TGUI/SubwidgetContainer.hpp>
 
 TEST_CASE("[Container]")
 {
@@ -129,6 +130,44 @@ TEST_CASE("[Container]")
             child1->remove(child4);
             REQUIRE(container->get("name") == nullptr);
         }
+
+        SECTION("changes after search")
+        {
+            REQUIRE(container->get("w5") == widget5);
+
+            // Renaming a widget
+            widget5->setWidgetName("w6");
+            REQUIRE(container->get("w5") == nullptr);
+            REQUIRE(container->get("w6") == widget5);
+
+            // An earlier widget gets the same name
+            widget4->setWidgetName("w6");
+            REQUIRE(container->get("w6") == widget4);
+
+            // Moving a container with the name in front of the other one
+            auto panel = tgui::Panel::create();
+            panel->add(widget4, "w6");
+            container->add(panel);
+            REQUIRE(container->get("w6") == widget5);
+            panel->moveToBack();
+            REQUIRE(container->get("w6") == widget4);
+
+            // Removing the container that held the widget
+            container->remove(panel);
+            REQUIRE(container->get("w6") == widget5);
+
+            // Adding a container that already contains widgets
+            panel->add(tgui::Label::create(), "w7");
+            widget2->add(panel);
+            REQUIRE(container->get("w7") != nullptr);
+            REQUIRE(container->get("w7")->getParent() == panel.get());
+
+            widget2->removeAllWidgets();
+            REQUIRE(container->get("w4") == nullptr);
+            REQUIRE(container->get("w6") == nullptr);
+            REQUIRE(container->get("w7") == nullptr);
+            REQUIRE(container->get("w2") == widget2);
+        }
     }
 
     SECTION("remove")
@@ -243,6 +282,452 @@ TEST_CASE("[Container]")
         REQUIRE(widget5->getInheritedOpacity() == 0.7f);
     }
 
+    SECTION("Spatial index")
+    {
+        auto panel = tgui::Panel::create({400, 400});
+        REQUIRE(!panel->isSpatialIndexEnabled());
+        panel->setSpatialIndexEnabled(true);
+        REQUIRE(panel->isSpatialIndexEnabled());
+
+        unsigned int enteredTile = 0;
+        std::vector<tgui::ClickableWidget::Ptr> tiles;
+        for (unsigned int y = 0; y < 10; ++y)
+        {
+            for (unsigned int x = 0; x < 10; ++x)
+            {
+                auto tile = tgui::ClickableWidget::create({40, 40});
+                tile->setPosition({x * 40, y * 40});
+                tile->connect("MouseEntered", [&enteredTile, index=tiles.size()]{ enteredTile = index; });
+                panel->add(tile);
+                tiles.push_back(tile);
+            }
+        }
+
+        panel->mouseMoved({45, 85});
+        REQUIRE(enteredTile == 21);
+
+        // Widgets in front of others are found first
+        bool overlayEntered = false;
+        auto overlay = tgui::ClickableWidget::create({60, 60});
+        overlay->setPosition({170, 170});
+        overlay->connect("MouseEntered", [&]{ overlayEntered = true; });
+        panel->add(overlay);
+        panel->mouseMoved({175, 175});
+        REQUIRE(overlayEntered);
+
+        overlay->moveToBack();
+        panel->mouseMoved({176, 176});
+        REQUIRE(enteredTile == 44);
+
+        // Moved widgets are found at their new position
+        tiles[99]->setPosition({5, 5});
+        panel->mouseMoved({10, 10});
+        REQUIRE(enteredTile == 99);
+
+        // Hidden widgets are skipped
+        tiles[99]->setVisible(false);
+        panel->mouseMoved({12, 12});
+        REQUIRE(enteredTile == 0);
+
+        // Removed widgets are no longer found
+        overlayEntered = false;
+        panel->remove(tiles[55]);
+        panel->mouseMoved({215, 215});
+        REQUIRE(overlayEntered);
+        panel->mouseMoved({45, 85});
+        REQUIRE(enteredTile == 21);
+
+        // Widgets are found when something else than their position or size changes their bounds
+        bool radioButtonEntered = false;
+        auto radioButton = tgui::RadioButton::create();
+        radioButton->setPosition({10, 360});
+        radioButton->setSize({20, 20});
+        radioButton->connect("MouseEntered", [&]{ radioButtonEntered = true; });
+        panel->add(radioButton);
+        panel->mouseMoved({80, 365});
+        REQUIRE(!radioButtonEntered);
+        radioButton->setText("Some long text");
+        panel->mouseMoved({81, 365});
+        REQUIRE(radioButtonEntered);
+
+        bool childWindowEntered = false;
+        auto childWindow = tgui::ChildWindow::create();
+        childWindow->getRenderer()->setTitleBarHeight(0);
+        childWindow->getRenderer()->setBorders(0);
+        childWindow->setPosition({200, 300});
+        childWindow->setSize({50, 50});
+        childWindow->connect("MouseEntered", [&]{ childWindowEntered = true; });
+        panel->add(childWindow);
+        panel->mouseMoved({260, 310});
+        REQUIRE(!childWindowEntered);
+        childWindow->getRenderer()->setBorders(20);
+        panel->mouseMoved({261, 310});
+        REQUIRE(childWindowEntered);
+
+        // Widgets that can be hit outside their bounds are found there as well
+        std::vector<sf::String> clickedMenuItem;
+        auto menuBar = tgui::MenuBar::create();
+        menuBar->setSize({200, 20});
+        menuBar->addMenu("File");
+        menuBar->addMenuItem("Load");
+        menuBar->addMenuItem("Save");
+        menuBar->connect("MenuItemClicked", [&](std::vector<sf::String> item){ clickedMenuItem = item; });
+        panel->add(menuBar);
+        panel->mouseMoved({10, 10});
+        panel->leftMousePressed({10, 10});
+        panel->leftMouseReleased({10, 10});
+        panel->mouseMoved({10, 50});
+        panel->leftMousePressed({10, 50});
+        panel->leftMouseReleased({10, 50});
+        REQUIRE(clickedMenuItem == std::vector<sf::String>({"File", "Save"}));
+
+        panel->setSpatialIndexEnabled(false);
+        panel->mouseMoved({125, 85});
+        REQUIRE(enteredTile == 23);
+    }
+
+    SECTION("Mouse capture")
+    {
+        auto parent = std::make_shared<tgui::GuiContainer>();
+
+        auto panel = tgui::Panel::create({300, 300});
+        parent->add(panel);
+
+        auto slider = tgui::Slider::create(0, 10);
+        slider->setPosition({20, 100});
+        slider->setSize({200, 10});
+        panel->add(slider);
+
+        unsigned int menuItemClickedCount = 0;
+        auto menuBar = tgui::MenuBar::create();
+        menuBar->setSize({300, 20});
+        menuBar->addMenu("File");
+        menuBar->addMenuItem("Open");
+        menuBar->connect("MenuItemClicked", [&]{ menuItemClickedCount++; });
+        panel->add(menuBar);
+
+        auto otherPanel = tgui::Panel::create({300, 100});
+        otherPanel->setPosition({0, 300});
+        otherPanel->add(tgui::ClickableWidget::create({300, 100}));
+        parent->add(otherPanel);
+
+        const auto click = [&](sf::Vector2f pos){
+            parent->leftMousePressed(pos);
+            parent->leftMouseReleased(pos);
+            parent->leftMouseButtonNoLongerDown();
+        };
+
+        // The widget on which the mouse went down keeps receiving mouse moves until the mouse is released
+        parent->leftMousePressed({22, 105});
+        parent->mouseMoved({400, 350});
+        REQUIRE(slider->getValue() == 10);
+
+        parent->leftMouseReleased({400, 350});
+        parent->leftMouseButtonNoLongerDown();
+        parent->mouseMoved({22, 105});
+        REQUIRE(slider->getValue() == 10);
+
+        // The menu bar still closes its menu when the mouse goes down on a widget in another container
+        click({10, 10});
+        click({150, 350});
+        click({10, 30});
+        REQUIRE(menuItemClickedCount == 0);
+
+        click({10, 10});
+        click({10, 30});
+        REQUIRE(menuItemClickedCount == 1);
+
+        // A widget that is removed while the mouse is down on it no longer acts as if the mouse is down
+        parent->leftMousePressed({22, 105});
+        parent->remove(panel);
+        parent->add(panel);
+        parent->mouseMoved({120, 105});
+        REQUIRE(slider->getValue() == 10);
+
+        // The same goes for widgets in a container that gets hidden
+        parent->leftMousePressed({22, 105});
+        panel->setVisible(false);
+        panel->setVisible(true);
+        parent->mouseMoved({120, 105});
+        REQUIRE(slider->getValue() == 10);
+        parent->leftMouseReleased({120, 105});
+        parent->leftMouseButtonNoLongerDown();
+    }
+
+    SECTION("Mouse release listeners inside a SubwidgetContainer")
+    {
+        struct TestSubwidgetContainer : public tgui::SubwidgetContainer
+        {
+            void addToContainer(const tgui::Widget::Ptr& widget)
+            {
+                m_container->add(widget);
+            }
+
+            bool mouseOnWidget(tgui::Vector2f pos) const override
+            {
+                return tgui::FloatRect{getPosition().x, getPosition().y, getSize().x, getSize().y}.contains(pos);
+            }
+
+            tgui::Widget::Ptr clone() const override
+            {
+                return std::make_shared<TestSubwidgetContainer>(*this);
+            }
+        };
+
+        auto parent = std::make_shared<tgui::GuiContainer>();
+
+        auto subwidgetContainer = std::make_shared<TestSubwidgetContainer>();
+        subwidgetContainer->setSize({300, 100});
+        parent->add(subwidgetContainer);
+
+        auto clickable = tgui::ClickableWidget::create({300, 100});
+        clickable->setPosition({0, 300});
+        parent->add(clickable);
+
+        unsigned int menuItemClickedCount = 0;
+        auto menuBar = tgui::MenuBar::create();
+        menuBar->setSize({300, 20});
+        menuBar->addMenu("File");
+        menuBar->addMenuItem("Open");
+        menuBar->connect("MenuItemClicked", [&]{ menuItemClickedCount++; });
+        subwidgetContainer->addToContainer(menuBar);
+
+        const auto click = [&](sf::Vector2f pos){
+            parent->leftMousePressed(pos);
+            parent->leftMouseReleased(pos);
+            parent->leftMouseButtonNoLongerDown();
+        };
+
+        // The menu closes when the mouse goes down outside the subwidget container
+        click({10, 10});
+        click({150, 350});
+        click({10, 30});
+        REQUIRE(menuItemClickedCount == 0);
+
+        // The same happens when the subwidget container is added to the parent after the menu bar was added to it
+        parent->remove(subwidgetContainer);
+        parent->add(subwidgetContainer);
+        click({10, 10});
+        click({150, 350});
+        click({10, 30});
+        REQUIRE(menuItemClickedCount == 0);
+
+        click({10, 10});
+        click({10, 30});
+        REQUIRE(menuItemClickedCount == 1);
+    }
+
+    SECTION("Asynchronous loading")
+    {
+        container->saveWidgetsToFile("ContainerAsyncLoading.txt");
+
+        auto gui = std::make_shared<tgui::Gui>();
+        auto loading = gui->loadWidgetsFromFileAsync("ContainerAsyncLoading.txt");
+        auto failedLoading = gui->loadWidgetsFromFileAsync("NonExistentFile.txt", false);
+
+        while ((loading.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            || (failedLoading.wait_for(std::chrono::seconds(0)) != std::future_status::ready))
+        {
+            gui->updateTime(sf::Time::Zero);
+        }
+
+        REQUIRE_NOTHROW(loading.get());
+        REQUIRE_THROWS_AS(failedLoading.get(), tgui::Exception);
+        REQUIRE(gui->getWidgets().size() == 3);
+        REQUIRE(gui->get<tgui::Panel>("w2")->getWidgets().size() == 2);
+    }
+
+    SECTION("Lazy loading of hidden containers")
+    {
+        widget2->setVisible(false);
+
+        std::stringstream stream;
+        container->saveWidgetsToStream(stream);
+
+        tgui::setLazyLoadingOfHiddenContainers(true);
+        auto gui = std::make_shared<tgui::Gui>();
+        gui->loadWidgetsFromStream(stream);
+        tgui::setLazyLoadingOfHiddenContainers(false);
+
+        REQUIRE(gui->getWidgets().size() == 3);
+        auto panel = gui->get<tgui::Panel>("w2");
+        REQUIRE(!panel->isVisible());
+
+        SECTION("Made visible")
+        {
+            panel->setVisible(true);
+            REQUIRE(panel->getWidgets().size() == 2);
+            REQUIRE(panel->getWidgets()[0]->getWidgetName() == "w4");
+        }
+
+        SECTION("Searched by name")
+        {
+            REQUIRE(gui->get("w5") != nullptr);
+            REQUIRE(gui->get("w5")->getParent() == panel.get());
+            REQUIRE(!panel->isVisible());
+        }
+
+        SECTION("Widget added before loading")
+        {
+            panel->add(tgui::Button::create(), "w6");
+            REQUIRE(panel->getWidgets().size() == 3);
+            REQUIRE(panel->getWidgets()[2]->getWidgetName() == "w6");
+        }
+
+        SECTION("Saving")
+        {
+            std::stringstream stream2;
+            gui->saveWidgetsToStream(stream2);
+            REQUIRE(stream.str() == stream2.str());
+        }
+
+        SECTION("Const access doesn't create the widgets")
+        {
+            const tgui::Panel& constPanel = *panel;
+            REQUIRE(constPanel.getWidgets().empty());
+            REQUIRE(constPanel.get("w5") == nullptr);
+
+            REQUIRE(panel->getWidgets().size() == 2);
+            REQUIRE(constPanel.get("w5") != nullptr);
+        }
+
+        SECTION("Copied before loading")
+        {
+            auto panelCopy = tgui::Panel::copy(panel);
+            REQUIRE(static_cast<const tgui::Panel&>(*panel).getWidgets().empty());
+            REQUIRE(panelCopy->get("w5") != nullptr);
+            REQUIRE(panelCopy->get("w5")->getParent() == panelCopy.get());
+            REQUIRE(panelCopy->getWidgets().size() == 2);
+
+            REQUIRE(panel->getWidgets().size() == 2);
+            REQUIRE(panel->get("w5") != panelCopy->get("w5"));
+        }
+    }
+
+    SECTION("Lazy loading of a binary widget file")
+    {
+        std::stringstream textStream{"Panel.\"HiddenPanel\" { Visible = false; Button.\"Child\" { Position = (10, 20); Text = \"1\"; } }"};
+        std::stringstream binaryStream;
+        tgui::DataIO::emitBinary(tgui::DataIO::parse(textStream), binaryStream);
+
+        // The parsed nodes are destroyed after loading, so the pending nodes have to be copies including their decoded values
+        tgui::setLazyLoadingOfHiddenContainers(true);
+        auto gui = std::make_shared<tgui::Gui>();
+        gui->loadWidgetsFromStream(binaryStream);
+        tgui::setLazyLoadingOfHiddenContainers(false);
+
+        auto panel = gui->get<tgui::Panel>("HiddenPanel");
+        REQUIRE(static_cast<const tgui::Panel&>(*panel).getWidgets().empty());
+
+        panel->setVisible(true);
+        REQUIRE(panel->getWidgets().size() == 1);
+        REQUIRE(panel->get<tgui::Button>("Child")->getText() == "1");
+        REQUIRE(panel->get<tgui::Button>("Child")->getPosition() == sf::Vector2f(10, 20));
+    }
+
+    SECTION("Scheduled updates")
+    {
+        auto gui = std::make_shared<tgui::Gui>();
+        sf::Time timeUntilUpdate;
+        REQUIRE(!gui->getTimeUntilNextUpdate(timeUntilUpdate));
+
+        auto editBox = tgui::EditBox::create();
+        auto panel = tgui::Panel::create();
+        panel->add(editBox);
+        gui->add(panel);
+        REQUIRE(!gui->getTimeUntilNextUpdate(timeUntilUpdate));
+
+        // A focused edit box needs to be updated to blink its caret
+        editBox->setFocused(true);
+        REQUIRE(gui->getTimeUntilNextUpdate(timeUntilUpdate));
+        REQUIRE(timeUntilUpdate == sf::milliseconds(500));
+        gui->updateTime(sf::milliseconds(200));
+        REQUIRE(gui->getTimeUntilNextUpdate(timeUntilUpdate));
+        REQUIRE(timeUntilUpdate == sf::milliseconds(300));
+        gui->updateTime(sf::milliseconds(300));
+        REQUIRE(gui->getTimeUntilNextUpdate(timeUntilUpdate));
+        REQUIRE(timeUntilUpdate == sf::milliseconds(500));
+
+        // Nothing has to be updated anymore once the caret no longer blinks
+        editBox->setFocused(false);
+        gui->updateTime(sf::milliseconds(500));
+        REQUIRE(!gui->getTimeUntilNextUpdate(timeUntilUpdate));
+
+        // Animations are updated every frame
+        editBox->showWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(300));
+        REQUIRE(gui->getTimeUntilNextUpdate(timeUntilUpdate));
+        REQUIRE(timeUntilUpdate == sf::Time::Zero);
+        gui->updateTime(sf::milliseconds(300));
+        REQUIRE(!gui->getTimeUntilNextUpdate(timeUntilUpdate));
+
+        // Custom widgets that override update have to request their updates
+        struct UpdateCountingWidget : public tgui::ClickableWidget
+        {
+            void update(sf::Time elapsedTime) override
+            {
+                tgui::ClickableWidget::update(elapsedTime);
+                ++updateCount;
+                scheduleUpdate(sf::Time::Zero);
+            }
+
+            unsigned int updateCount = 0;
+        };
+
+        auto customWidget = std::make_shared<UpdateCountingWidget>();
+        gui->add(customWidget);
+        gui->updateTime(sf::milliseconds(10));
+        REQUIRE(customWidget->updateCount == 0);
+
+        customWidget->scheduleUpdate(sf::Time::Zero);
+        REQUIRE(gui->getTimeUntilNextUpdate(timeUntilUpdate));
+        REQUIRE(timeUntilUpdate == sf::Time::Zero);
+        gui->updateTime(sf::milliseconds(10));
+        REQUIRE(customWidget->updateCount == 1);
+        gui->updateTime(sf::milliseconds(10));
+        REQUIRE(customWidget->updateCount == 2);
+
+        gui->remove(customWidget);
+        gui->updateTime(sf::milliseconds(10));
+        REQUIRE(!gui->getTimeUntilNextUpdate(timeUntilUpdate));
+
+        // Widgets inside a SubwidgetContainer request their updates through the widget that owns their container
+        struct TestSubwidgetContainer : public tgui::SubwidgetContainer
+        {
+            void addToContainer(const tgui::Widget::Ptr& widget)
+            {
+                m_container->add(widget);
+            }
+
+            bool mouseOnWidget(tgui::Vector2f pos) const override
+            {
+                return tgui::FloatRect{getPosition().x, getPosition().y, getSize().x, getSize().y}.contains(pos);
+            }
+
+            tgui::Widget::Ptr clone() const override
+            {
+                return std::make_shared<TestSubwidgetContainer>(*this);
+            }
+        };
+
+        auto subwidgetContainer = std::make_shared<TestSubwidgetContainer>();
+        auto innerEditBox = tgui::EditBox::create();
+        subwidgetContainer->addToContainer(innerEditBox);
+        gui->add(subwidgetContainer);
+        gui->updateTime(sf::milliseconds(10));
+        REQUIRE(!gui->getTimeUntilNextUpdate(timeUntilUpdate));
+
+        innerEditBox->setFocused(true);
+        REQUIRE(gui->getTimeUntilNextUpdate(timeUntilUpdate));
+        REQUIRE(timeUntilUpdate == sf::milliseconds(500));
+        gui->updateTime(sf::milliseconds(500));
+        REQUIRE(gui->getTimeUntilNextUpdate(timeUntilUpdate));
+        REQUIRE(timeUntilUpdate == sf::milliseconds(500));
+
+        innerEditBox->setFocused(false);
+        gui->updateTime(sf::milliseconds(500));
+        REQUIRE(!gui->getTimeUntilNextUpdate(timeUntilUpdate));
+    }
+
     // TODO: Events
     //       Test parameter of Widget::disable
 }
@@ -0,0 +1,83 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include "CodeGenerator.hpp"
+#include "WidgetProperties/ButtonProperties.hpp"
+#include "WidgetProperties/LabelProperties.hpp"
+#include "WidgetProperties/ListBoxProperties.hpp"
+
+TEST_CASE("[CodeGenerator]")
+{
+    std::map<std::string, std::unique_ptr<WidgetProperties>> widgetProperties;
+    widgetProperties["Button"] = std::make_unique<ButtonProperties>();
+    widgetProperties["Label"] = std::make_unique<LabelProperties>();
+    widgetProperties["ListBox"] = std::make_unique<ListBoxProperties>();
+
+    auto group = tgui::Group::create();
+    group->add(tgui::Button::create("Say \"hi\"\t\\"), "my button");
+
+    const std::string buttonText = "Caf\xC3\xA9";
+    group->add(tgui::Button::create(sf::String::fromUtf8(buttonText.begin(), buttonText.end())), "my-button");
+
+    const std::string labelText = "Gr\xC3\xBC\xC3\x9F" "e\nline 2";
+    auto label = tgui::Label::create(sf::String::fromUtf8(labelText.begin(), labelText.end()));
+    group->add(label, "Label");
+
+    const std::string item = "\xE2\x82\xAC 5";
+    auto listBox = tgui::ListBox::create();
+    listBox->addItem("Item 1");
+    listBox->addItem(sf::String::fromUtf8(item.begin(), item.end()));
+    group->add(listBox, "create");
+
+    CodeGenerator codeGenerator{widgetProperties};
+    const std::string code = codeGenerator.generate("forms/my form.txt", group->getWidgets());
+
+    REQUIRE(code.find("struct My_form\n") != std::string::npos);
+    REQUIRE(code.find("#ifndef MY_FORM_HPP\n") != std::string::npos);
+
+    // Widgets with names that result in the same identifier get unique variable names
+    REQUIRE(code.find("    tgui::Button::Ptr my_button;\n") != std::string::npos);
+    REQUIRE(code.find("    tgui::Button::Ptr my_button_2;\n") != std::string::npos);
+    REQUIRE(code.find("    tgui::ListBox::Ptr create_2;\n") != std::string::npos);
+    REQUIRE(code.find(R"(parent.add(my_button, "my button");)") != std::string::npos);
+    REQUIRE(code.find(R"(parent.add(my_button_2, "my-button");)") != std::string::npos);
+
+    // Special characters are escaped
+    REQUIRE(code.find(R"(my_button->setText("Say \"hi\"\t\\");)") != std::string::npos);
+
+    // Text outside the ASCII range is written as UTF-8 and converted when the widgets are created
+    REQUIRE(code.find("static sf::String fromUtf8(const std::string& str)") != std::string::npos);
+    REQUIRE(code.find(R"(my_button_2->setText(fromUtf8("Caf\303\251"));)") != std::string::npos);
+    REQUIRE(code.find(R"(Label->setText(fromUtf8("Gr\303\274\303\237e\nline 2"));)") != std::string::npos);
+    REQUIRE(code.find(R"(create_2->addItem("Item 1");)") != std::string::npos);
+    REQUIRE(code.find(R"(create_2->addItem(fromUtf8("\342\202\254 5"));)") != std::string::npos);
+    REQUIRE(code.find('?') == std::string::npos);
+
+    // The helper is only added when it is needed
+    group->remove(group->get("my-button"));
+    group->remove(label);
+    listBox->removeItemByIndex(1);
+    REQUIRE(codeGenerator.generate("Form.txt", group->getWidgets()).find("fromUtf8") == std::string::npos);
+}
@@ -83,6 +83,23 @@ TEST_CASE("[Layouts]")
         REQUIRE(l3.toString() == "2");
         REQUIRE(l4.toString() == "0");
         REQUIRE(l5.toString() == "max(2, 3) + 1");
+
+        // Copies share the expression but keep their own bindings
+        auto button = std::make_shared<tgui::Button>();
+        button->setSize(100, 40);
+        button->setPosition(2, 0);
+        Layout l7 = bindWidth(button) + bindHeight(button) * bindLeft(button);
+        Layout l8 = l7;
+        REQUIRE(l7.getValue() == 180);
+        REQUIRE(l8.getValue() == 180);
+
+        button->setSize(50, 40);
+        REQUIRE(l7.getValue() == 130);
+        REQUIRE(l8.getValue() == 130);
+
+        button = nullptr;
+        REQUIRE(l7.getValue() == 0);
+        REQUIRE(l8.getValue() == 0);
     }
 
     SECTION("without strings")
@@ -405,6 +422,87 @@ TEST_CASE("[Layouts]")
             widget->setPosition({"0"},{"0"});
             widget->setPosition("0","0");
         }
+
+        SECTION("Widget names")
+        {
+            auto panel = std::make_shared<tgui::Panel>();
+            auto button1 = std::make_shared<tgui::Button>();
+            auto button2 = std::make_shared<tgui::Button>();
+            auto button3 = std::make_shared<tgui::Button>();
+            button1->setSize(100, 20);
+            button2->setSize(200, 40);
+            panel->add(button1, "Btn");
+            panel->add(button2, "btn");
+
+            // The same string is used for both widgets, but each of them has its own binding
+            button3->setSize({"BTN.size"});
+            auto button4 = tgui::Button::copy(button3);
+            panel->add(button3);
+            REQUIRE(button3->getSize() == sf::Vector2f(100, 20));
+
+            button1->setWidgetName("other");
+            panel->add(button4);
+            REQUIRE(button4->getSize() == sf::Vector2f(200, 40));
+
+            panel->remove(button2);
+            button4->setSize({"btn.size"});
+            REQUIRE(button4->getSize() == sf::Vector2f(0, 0));
+
+            panel->add(button2, "Btn");
+            button4->setSize({"btn.size"});
+            REQUIRE(button4->getSize() == sf::Vector2f(200, 40));
+        }
+    }
+
+    SECTION("Deferred layout updates")
+    {
+        sf::RenderTexture texture;
+        texture.create(400, 300);
+        tgui::Gui gui{texture};
+
+        auto panel = tgui::Panel::create({"100%", "100%"});
+        gui.add(panel);
+
+        auto button1 = tgui::Button::create();
+        auto button2 = tgui::Button::create();
+        auto button3 = tgui::Button::create();
+        panel->add(button1, "b1");
+        panel->add(button2, "b2");
+        panel->add(button3, "b3");
+        button1->setSize({"&.w / 2", 50});
+        button2->setSize({"&.w / 4", 50});
+        button3->setSize({"b1.width + b2.width", 50});
+        REQUIRE(button3->getSize() == sf::Vector2f(300, 50));
+
+        unsigned int sizeChangedCount = 0;
+        button3->connect("SizeChanged", [&]{ sizeChangedCount++; });
+
+        REQUIRE(!gui.isDeferredLayoutUpdatesEnabled());
+        gui.setDeferredLayoutUpdatesEnabled(true);
+        REQUIRE(gui.isDeferredLayoutUpdatesEnabled());
+
+        // The widgets only change when the layouts are updated and each widget only changes once
+        gui.setView(sf::View{{0, 0, 800, 600}});
+        REQUIRE(panel->getSize() == sf::Vector2f(400, 300));
+        REQUIRE(button3->getSize() == sf::Vector2f(300, 50));
+
+        gui.updateLayouts();
+        REQUIRE(panel->getSize() == sf::Vector2f(800, 600));
+        REQUIRE(button1->getSize() == sf::Vector2f(400, 50));
+        REQUIRE(button2->getSize() == sf::Vector2f(200, 50));
+        REQUIRE(button3->getSize() == sf::Vector2f(600, 50));
+        REQUIRE(sizeChangedCount == 1);
+
+        // Pending changes are applied when deferring is disabled again
+        gui.setView(sf::View{{0, 0, 400, 300}});
+        gui.setDeferredLayoutUpdatesEnabled(false);
+        REQUIRE(button3->getSize() == sf::Vector2f(300, 50));
+        REQUIRE(sizeChangedCount == 2);
+
+        // Without deferring, the widget is resized each time one of the widgets on which it depends changes
+        gui.setView(sf::View{{0, 0, 800, 600}});
+        REQUIRE(button3->getSize() == sf::Vector2f(600, 50));
+        REQUIRE(sizeChangedCount == 4);
     }
 
     SECTION("Bug Fixes")
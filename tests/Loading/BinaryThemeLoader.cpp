@@ -0,0 +1,112 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/Loading/BinaryThemeLoader.hpp>
+#include <TGUI/Loading/Theme.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <fstream>
+
+namespace
+{
+    // Restores the theme loader that was used before the test, even when a check inside the test fails
+    struct ThemeLoaderGuard
+    {
+        ~ThemeLoaderGuard()
+        {
+            tgui::Theme::setThemeLoader(oldThemeLoader);
+        }
+
+        std::shared_ptr<tgui::BaseThemeLoader> oldThemeLoader = tgui::Theme::getThemeLoader();
+    };
+}
+
+TEST_CASE("[BinaryThemeLoader]")
+{
+    // The binary theme is written to the build folder instead of the resources. The image that the theme refers to has to
+    // be placed next to it, as filenames in the theme are relative to the theme file.
+    {
+        std::ifstream in("resources/Black.png", std::ios::binary);
+        std::ofstream out("Black.png", std::ios::binary);
+        out << in.rdbuf();
+    }
+    REQUIRE_NOTHROW(tgui::BinaryThemeLoader::compile("resources/Black.txt", "BinaryThemeLoaderBlack.tgt"));
+
+    auto loader = std::make_shared<tgui::BinaryThemeLoader>();
+
+    SECTION("loadProperties")
+    {
+        auto properties = loader->loadProperties("BinaryThemeLoaderBlack.tgt", "ChatBox");
+        REQUIRE(properties.size() == 3);
+
+        REQUIRE(properties["padding"].getType() == tgui::ObjectConverter::Type::Outline);
+        REQUIRE(properties["padding"].getOutline() == tgui::Padding(3, 3, 3, 3));
+
+        REQUIRE(properties["texturebackground"].getType() == tgui::ObjectConverter::Type::Texture);
+        REQUIRE(properties["texturebackground"].getTexture().getId() == "Black.png");
+        REQUIRE(properties["texturebackground"].getTexture().getMiddleRect() == sf::IntRect(16, 16, 16, 16));
+
+        REQUIRE(properties["scrollbar"].getType() == tgui::ObjectConverter::Type::RendererData);
+        auto& scrollbarProperties = properties["scrollbar"].getRenderer()->propertyValuePairs;
+        REQUIRE(scrollbarProperties.size() == 8);
+        REQUIRE(scrollbarProperties["texturearrowdown"].getTexture().getMiddleRect() == sf::IntRect(0, 1, 20, 19));
+
+        properties = loader->loadProperties("BinaryThemeLoaderBlack.tgt", "Button");
+        REQUIRE(properties["textcolor"].getType() == tgui::ObjectConverter::Type::Color);
+        REQUIRE(properties["textcolor"].getColor() == sf::Color(190, 190, 190));
+
+        REQUIRE_THROWS_AS(loader->loadProperties("BinaryThemeLoaderBlack.tgt", "nonexistent_section"), tgui::Exception);
+    }
+
+    SECTION("load")
+    {
+        REQUIRE(loader->canLoad("BinaryThemeLoaderBlack.tgt", "Button"));
+        REQUIRE(!loader->canLoad("BinaryThemeLoaderBlack.tgt", "nonexistent_section"));
+
+        const auto& properties = loader->load("BinaryThemeLoaderBlack.tgt", "ChatBox");
+        REQUIRE(properties.size() == 3);
+        REQUIRE(tgui::Deserializer::deserialize(tgui::ObjectConverter::Type::Outline, properties.at("padding")).getOutline() == tgui::Padding(3, 3, 3, 3));
+        REQUIRE(tgui::Deserializer::deserialize(tgui::ObjectConverter::Type::Texture, properties.at("texturebackground")).getTexture().getId() == "Black.png");
+    }
+
+    SECTION("Theme")
+    {
+        ThemeLoaderGuard guard;
+        tgui::Theme::setThemeLoader(loader);
+
+        tgui::Theme theme{"BinaryThemeLoaderBlack.tgt"};
+        auto button = tgui::Button::create();
+        button->setRenderer(theme.getRenderer("Button"));
+        REQUIRE(button->getSharedRenderer()->getTextColor() == sf::Color(190, 190, 190));
+        REQUIRE(button->getSharedRenderer()->getTexture().getId() == "Black.png");
+    }
+
+    SECTION("Invalid file")
+    {
+        REQUIRE_THROWS_AS(loader->preload("nonexistent_file"), tgui::Exception);
+        REQUIRE_THROWS_AS(loader->preload("resources/Black.txt"), tgui::Exception);
+    }
+
+    tgui::BinaryThemeLoader::flushCache();
+}
@@ -25,6 +25,8 @@
 #include "Tests.hpp"
 #include <TGUI/Loading/DataIO.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
+#include <TGUI/Loading/WidgetFactory.hpp>
+#include <TGUI/Widgets/Button.hpp>
 
 TEST_CASE("[DataIO]")
 {
@@ -204,6 +206,129 @@ TEST_CASE("[DataIO]")
             std::stringstream input("{ Property = ; ");
             REQUIRE_THROWS_AS(tgui::DataIO::parse(input), tgui::Exception);
         }
+
+        SECTION("Buffer")
+        {
+            const std::string input = "Child { Property = Value; }";
+            auto node = tgui::DataIO::parse(input.data(), input.size());
+            REQUIRE(node->children.size() == 1);
+            REQUIRE(node->children[0]->name == "Child");
+            REQUIRE(node->children[0]->propertyValuePairs["property"]->value == "Value");
+
+            // Parsing stops at the given size even when the buffer continues
+            const std::string truncated = "Property = Value;Other";
+            node = tgui::DataIO::parse(truncated.data(), 17);
+            REQUIRE(node->propertyValuePairs.size() == 1);
+
+            REQUIRE_THROWS_AS(tgui::DataIO::parse(input.data(), input.size() - 1), tgui::Exception);
+        }
+
+        SECTION("Binary")
+        {
+            std::stringstream input("Property = Value;\n"
+                                    "List = [a, \"b,c\", d];\n"
+                                    "Number = 2.5;\n"
+                                    "Color = #FF000080;\n"
+                                    "Size = (\"&.width - 10\", 20%);\n"
+                                    "Padding = (1, 2, 3, 4);\n"
+                                    "Texture = \"image.png\" Part(0, 0, 10, 20) Smooth;\n"
+                                    "Child.\"Name\" { Property = Value; Nested { X = Y; } }\n"
+                                    "Child2 { Property = Value; }");
+            auto node = tgui::DataIO::parse(input);
+
+            std::stringstream text;
+            tgui::DataIO::emit(node, text);
+
+            std::stringstream binary;
+            tgui::DataIO::emitBinary(node, binary);
+            const std::string binaryStr = binary.str();
+            REQUIRE(tgui::DataIO::isBinary(binaryStr.data(), binaryStr.size()));
+            REQUIRE(!tgui::DataIO::isBinary(text.str().data(), text.str().size()));
+
+            auto binaryNode = tgui::DataIO::parse(binaryStr.data(), binaryStr.size());
+            REQUIRE(binaryNode->children.size() == 2);
+            REQUIRE(binaryNode->children[0]->parent == binaryNode.get());
+            REQUIRE(binaryNode->propertyValuePairs["list"]->listNode);
+            REQUIRE(binaryNode->propertyValuePairs["list"]->valueList.size() == 3);
+            REQUIRE(binaryNode->propertyValuePairs["list"]->valueList[1] == "\"b,c\"");
+
+            // Values of which the type is recognized are also available without parsing them
+            REQUIRE(!binaryNode->propertyValuePairs["property"]->decoded);
+            REQUIRE(tgui::Deserializer::deserialize(tgui::ObjectConverter::Type::Number, *binaryNode->propertyValuePairs["number"]).getNumber() == 2.5f);
+            REQUIRE(binaryNode->propertyValuePairs["color"]->decoded->type == tgui::DataIO::DecodedValue::Type::Color);
+            REQUIRE(tgui::Deserializer::deserialize(tgui::ObjectConverter::Type::Color, *binaryNode->propertyValuePairs["color"]).getColor() == tgui::Color(255, 0, 0, 128));
+            REQUIRE(binaryNode->propertyValuePairs["size"]->decoded->type == tgui::DataIO::DecodedValue::Type::Layout);
+            REQUIRE(binaryNode->propertyValuePairs["size"]->decoded->strings[0] == "&.width - 10");
+            REQUIRE(binaryNode->propertyValuePairs["size"]->decoded->strings[1] == "20%");
+            REQUIRE(tgui::Deserializer::deserialize(tgui::ObjectConverter::Type::Outline, *binaryNode->propertyValuePairs["padding"]).getOutline() == tgui::Outline(1, 2, 3, 4));
+            REQUIRE(binaryNode->propertyValuePairs["texture"]->decoded->type == tgui::DataIO::DecodedValue::Type::Texture);
+            REQUIRE(binaryNode->propertyValuePairs["texture"]->decoded->strings[0] == "image.png");
+            REQUIRE(binaryNode->propertyValuePairs["texture"]->decoded->rects[3] == 20);
+            REQUIRE(binaryNode->propertyValuePairs["texture"]->decoded->smooth);
+
+            std::stringstream text2;
+            tgui::DataIO::emit(binaryNode, text2);
+            REQUIRE(text.str() == text2.str());
+
+            // The stream overload also detects the binary format
+            REQUIRE(tgui::DataIO::parse(binary)->children.size() == 2);
+
+            // Truncated files are rejected
+            REQUIRE_THROWS_AS(tgui::DataIO::parse(binaryStr.data(), binaryStr.size() - 1), tgui::Exception);
+            REQUIRE_THROWS_AS(tgui::DataIO::parse(binaryStr.data(), 12), tgui::Exception);
+        }
+
+        SECTION("Binary round trip of all widgets")
+        {
+            tgui::Theme theme{"resources/Black.txt"};
+            auto parent = std::make_shared<tgui::GuiContainer>();
+            for (const std::string type : {"BitmapButton", "Button", "Canvas", "ChatBox", "CheckBox", "ChildWindow", "ClickableWidget",
+                                           "ComboBox", "EditBox", "Grid", "Group", "HorizontalLayout", "HorizontalWrap", "Knob", "Label",
+                                           "ListBox", "ListView", "MenuBar", "MessageBox", "Panel", "Picture", "ProgressBar", "RadioButton",
+                                           "RadioButtonGroup", "RangeSlider", "ScrollablePanel", "Scrollbar", "Slider", "SpinButton", "Tabs",
+                                           "TextBox", "TiledPicture", "TreeView", "VerticalLayout", "VirtualListPanel"})
+            {
+                auto widget = tgui::WidgetFactory::getConstructFunction(tgui::toLower(type))();
+                widget->setPosition({"5%", "&.height - 50"});
+                widget->setSize(120, 40);
+
+                // Widgets without a section in the theme keep their default renderer
+                try
+                {
+                    widget->setRenderer(theme.getRenderer(type));
+                }
+                catch (const tgui::Exception&)
+                {
+                }
+
+                parent->add(widget, type);
+            }
+
+            // A second button shares the renderer of the first one, so that the file contains a renderer reference
+            auto button = tgui::Button::create("Shared");
+            button->setRenderer(theme.getRenderer("Button"));
+            parent->add(button, "SharedButton");
+
+            std::stringstream text;
+            parent->saveWidgetsToStream(text);
+
+            std::stringstream binary;
+            parent->saveWidgetsToStream(binary, true);
+            const std::string binaryStr = binary.str();
+            REQUIRE(tgui::DataIO::isBinary(binaryStr.data(), binaryStr.size()));
+
+            // Emitting the tree that was read from the binary file gives the exact same text
+            std::stringstream text2;
+            tgui::DataIO::emit(tgui::DataIO::parse(binaryStr.data(), binaryStr.size()), text2);
+            REQUIRE(text2.str() == text.str());
+
+            // Loading the widgets from the binary file with the decoded values gives the same widgets
+            parent = std::make_shared<tgui::GuiContainer>();
+            REQUIRE_NOTHROW(parent->loadWidgetsFromStream(binary));
+            std::stringstream text3;
+            parent->saveWidgetsToStream(text3);
+            REQUIRE(text3.str() == text.str());
+        }
     }
 
     SECTION("correct input")
@@ -218,7 +218,19 @@ TEST_CASE("[Deserializer]")
         REQUIRE(tgui::Deserializer::deserialize(Type::Color, "rgb(10, 20, 30)").getColor() == sf::Color::Green);
         REQUIRE(tgui::Deserializer::deserialize(Type::Outline, "(50, 60, 70, 80)").getOutline() == tgui::Outline(50, 60, 70, 80));
         
+        // The custom function is also used for values that were already decoded in a binary file
+        auto decoded = std::make_shared<tgui::DataIO::DecodedValue>();
+        decoded->type = tgui::DataIO::DecodedValue::Type::Color;
+        decoded->numbers[0] = 10;
+        decoded->numbers[1] = 20;
+        decoded->numbers[2] = 30;
+        decoded->numbers[3] = 255;
+        tgui::DataIO::ValueNode node{"rgb(10, 20, 30)"};
+        node.decoded = decoded;
+        REQUIRE(tgui::Deserializer::deserialize(Type::Color, node).getColor() == sf::Color::Green);
+
         tgui::Deserializer::setFunction(tgui::ObjectConverter::Type::Color, oldFunc);
         REQUIRE(tgui::Deserializer::deserialize(Type::Color, "rgb(10, 20, 30)").getColor() == sf::Color(10, 20, 30));
+        REQUIRE(tgui::Deserializer::deserialize(Type::Color, node).getColor() == sf::Color(10, 20, 30));
     }
 }
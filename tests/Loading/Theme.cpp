@@ -25,9 +25,27 @@
 #include "Tests.hpp"
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Widgets/Label.hpp>
+#include <set>
 
 // TODO: Reloading theme
 
+namespace
+{
+    // Label that remembers which properties it was told about
+    class CountingLabel : public tgui::Label
+    {
+    public:
+        std::multiset<std::string> changedProperties;
+
+    protected:
+        void rendererChanged(const std::string& property) override
+        {
+            changedProperties.insert(property);
+            tgui::Label::rendererChanged(property);
+        }
+    };
+}
+
 TEST_CASE("[Theme]")
 {
     SECTION("Loading")
@@ -43,6 +61,42 @@ TEST_CASE("[Theme]")
             REQUIRE_NOTHROW(theme.getRenderer("EditBox"));
         }
 
+        SECTION("Values are decoded while loading")
+        {
+            tgui::Theme theme("resources/Black.txt");
+            auto data = theme.getRenderer("ChatBox");
+            REQUIRE(data->propertyValuePairs["padding"].getType() == tgui::ObjectConverter::Type::Outline);
+            REQUIRE(data->propertyValuePairs["texturebackground"].getType() == tgui::ObjectConverter::Type::Texture);
+            REQUIRE(data->propertyValuePairs["scrollbar"].getType() == tgui::ObjectConverter::Type::RendererData);
+            REQUIRE(data->propertyValuePairs["padding"].getOutline() == tgui::Padding(3, 3, 3, 3));
+
+            data = theme.getRenderer("Button");
+            REQUIRE(data->propertyValuePairs["textcolor"].getType() == tgui::ObjectConverter::Type::Color);
+            REQUIRE(data->propertyValuePairs["textcolor"].getColor() == sf::Color(190, 190, 190));
+        }
+
+        SECTION("Values that fail to decode are kept")
+        {
+            tgui::ObjectConverter value{sf::String{"\"nonexistent.png\""}};
+            REQUIRE_THROWS_AS(value.getTexture(), tgui::Exception);
+            REQUIRE(value.getType() == tgui::ObjectConverter::Type::String);
+            REQUIRE(value.getString() == "\"nonexistent.png\"");
+            REQUIRE_THROWS_AS(value.getTexture(), tgui::Exception);
+        }
+
+        SECTION("Only values with a recognizable type are decoded")
+        {
+            REQUIRE(tgui::BaseThemeLoader::decodeValue("resources/image.png").getType() == tgui::ObjectConverter::Type::Texture);
+            REQUIRE(tgui::BaseThemeLoader::decodeValue("\"resources/image.png\"").getType() == tgui::ObjectConverter::Type::Texture);
+            REQUIRE(tgui::BaseThemeLoader::decodeValue("\"resources/image.png\" Smooth").getType() == tgui::ObjectConverter::Type::Texture);
+            REQUIRE(tgui::BaseThemeLoader::decodeValue("resources/DejaVuSans.ttf").getType() == tgui::ObjectConverter::Type::String);
+
+            // A number could be used as borders, so it is left to the widget to decode it
+            tgui::ObjectConverter borders = tgui::BaseThemeLoader::decodeValue("2");
+            REQUIRE(borders.getType() == tgui::ObjectConverter::Type::String);
+            REQUIRE(borders.getOutline() == tgui::Borders(2));
+        }
+
         SECTION("nonexistent file")
         {
             REQUIRE_THROWS_AS(tgui::Theme("nonexistent_file"), tgui::Exception);
@@ -83,6 +137,38 @@ TEST_CASE("[Theme]")
         REQUIRE(!theme.removeRenderer("nonexistent"));
     }
 
+    SECTION("Only changed properties are passed to the widget")
+    {
+        auto data1 = std::make_shared<tgui::RendererData>();
+        data1->propertyValuePairs["textcolor"] = {tgui::Color(255, 0, 0)};
+        data1->propertyValuePairs["bordercolor"] = {tgui::Color(0, 0, 255)};
+        data1->propertyValuePairs["borders"] = {tgui::Outline(1)};
+
+        auto data2 = std::make_shared<tgui::RendererData>();
+        data2->propertyValuePairs["textcolor"] = {tgui::Color(255, 0, 0)};
+        data2->propertyValuePairs["bordercolor"] = {tgui::Color(0, 255, 0)};
+        data2->propertyValuePairs["backgroundcolor"] = {tgui::Color(255, 255, 255)};
+
+        tgui::Theme theme;
+        theme.addRenderer("First", data1);
+        theme.addRenderer("Second", data2);
+
+        auto label = std::make_shared<CountingLabel>();
+        label->setRenderer(theme.getRenderer("First"));
+        REQUIRE(label->changedProperties.count("textcolor") == 1);
+        REQUIRE(label->changedProperties.count("bordercolor") == 1);
+        REQUIRE(label->changedProperties.count("borders") == 1);
+
+        // The text color is the same in both renderers, the borders are reset to their default value
+        label->changedProperties.clear();
+        label->setRenderer(theme.getRenderer("Second"));
+        REQUIRE(label->changedProperties == std::multiset<std::string>({"bordercolor", "borders", "backgroundcolor"}));
+
+        label->changedProperties.clear();
+        label->setRenderer(theme.getRenderer("Second"));
+        REQUIRE(label->changedProperties.empty());
+    }
+
     SECTION("Renderers are shared")
     {
         tgui::Theme theme{"resources/Black.txt"};
@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/Loading/ThemeLoader.hpp>
+#include <TGUI/Loading/BinaryThemeLoader.hpp>
 
 // Ignore warning "C4503: decorated name length exceeded, name was truncated" in Visual Studio
 #if defined _MSC_VER
@@ -188,5 +189,18 @@ TEST_CASE("[ThemeLoader]")
             tgui::DefaultThemeLoader::flushCache();
             REQUIRE(tgui::DefaultThemeLoaderTest::getPropertiesCache(loader).size() == 0);
         }
+
+        SECTION("compiling a binary theme")
+        {
+            REQUIRE_NOTHROW(tgui::BinaryThemeLoader::compile("resources/Black.txt", "ThemeLoaderBlack.tgt"));
+            REQUIRE(tgui::DefaultThemeLoaderTest::getPropertiesCache(loader).size() == 0);
+
+            // A theme that was already loaded stays in the cache
+            loader->preload("resources/Black.txt");
+            REQUIRE_NOTHROW(tgui::BinaryThemeLoader::compile("resources/Black.txt", "ThemeLoaderBlack.tgt"));
+            REQUIRE(tgui::DefaultThemeLoaderTest::getPropertiesCache(loader).size() == 1);
+
+            tgui::DefaultThemeLoader::flushCache();
+        }
     }
 }
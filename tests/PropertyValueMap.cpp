@@ -0,0 +1,100 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/PropertyValueMap.hpp>
+
+TEST_CASE("[PropertyValueMap]")
+{
+    SECTION("PropertyId")
+    {
+        TGUI_PROPERTY_ID(id, BorderColorHover);
+        const tgui::PropertyId propertyId = id;
+        REQUIRE(std::string(propertyId.getName(), propertyId.getLength()) == "bordercolorhover");
+        REQUIRE(propertyId.getHash() == tgui::PropertyId{std::string("BorderColorHover")}.getHash());
+        REQUIRE(propertyId.getHash() != tgui::PropertyId{std::string("BorderColor")}.getHash());
+        REQUIRE(propertyId.matches("BORDERCOLORHOVER"));
+        REQUIRE(!propertyId.matches("BorderColor"));
+    }
+
+    SECTION("isPropertyName")
+    {
+        REQUIRE(tgui::isPropertyName("TextColor", {"bordercolor", "textcolor"}));
+        REQUIRE(!tgui::isPropertyName("TextColorHover", {"textcolor"}));
+        REQUIRE(!tgui::isPropertyName("Text", {"textcolor"}));
+        REQUIRE(!tgui::isPropertyName("", {"textcolor"}));
+    }
+
+    SECTION("Insert and find")
+    {
+        tgui::PropertyValueMap map;
+        REQUIRE(map.empty());
+        REQUIRE(map.find("textcolor") == map.end());
+
+        map["TextColor"] = {tgui::Color::Red};
+        map["backgroundcolor"] = {tgui::Color::Green};
+        REQUIRE(map.size() == 2);
+
+        TGUI_PROPERTY_ID(textColor, TextColor);
+        REQUIRE(map.find(textColor) != map.end());
+        REQUIRE(map.find(textColor)->first == "TextColor");
+        REQUIRE(map.find(textColor)->second.getColor() == tgui::Color::Red);
+        REQUIRE(map.count("textcolor") == 1);
+        REQUIRE(map.count("bordercolor") == 0);
+
+        map[textColor] = {tgui::Color::Blue};
+        REQUIRE(map.size() == 2);
+        REQUIRE(map["textcolor"].getColor() == tgui::Color::Blue);
+    }
+
+    SECTION("Many properties")
+    {
+        tgui::PropertyValueMap map;
+        for (unsigned int i = 0; i < 100; ++i)
+            map["Property" + tgui::to_string(i)] = {i};
+
+        REQUIRE(map.size() == 100);
+        for (unsigned int i = 0; i < 100; ++i)
+            REQUIRE(map.find("property" + tgui::to_string(i))->second.getNumber() == i);
+
+        // Entries keep their insertion order
+        unsigned int index = 0;
+        for (const auto& pair : map)
+            REQUIRE(pair.first == "Property" + tgui::to_string(index++));
+    }
+
+    SECTION("Erase")
+    {
+        tgui::PropertyValueMap map{{"a", 1}, {"b", 2}, {"c", 3}};
+        REQUIRE(map.erase("B") == 1);
+        REQUIRE(map.erase("b") == 0);
+        REQUIRE(map.size() == 2);
+        REQUIRE(map.find("a")->second.getNumber() == 1);
+        REQUIRE(map.find("c")->second.getNumber() == 3);
+
+        map.clear();
+        REQUIRE(map.empty());
+        REQUIRE(map.find("a") == map.end());
+    }
+}
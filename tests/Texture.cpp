@@ -63,7 +63,7 @@ TEST_CASE("[Texture]")
                 tgui::Texture texture{"resources/image.png"};
                 REQUIRE(texture.getId() == "resources/image.png");
                 REQUIRE(texture.getData() != nullptr);
-                REQUIRE(texture.getData()->image != nullptr);
+                REQUIRE(texture.getData()->alphaMask != nullptr);
                 REQUIRE(texture.getData()->texture.getSize() == sf::Vector2u(50, 50));
                 REQUIRE(texture.getData()->rect == sf::IntRect());
                 REQUIRE(texture.getImageSize() == sf::Vector2f(50, 50));
@@ -77,7 +77,7 @@ TEST_CASE("[Texture]")
                 texture.load("resources/image.png", {10, 5, 40, 30}, {6, 5, 28, 20});
                 REQUIRE(texture.getId() == "resources/image.png");
                 REQUIRE(texture.getData() != nullptr);
-                REQUIRE(texture.getData()->image != nullptr);
+                REQUIRE(texture.getData()->alphaMask != nullptr);
                 REQUIRE(texture.getData()->texture.getSize() == sf::Vector2u(40, 30));
                 REQUIRE(texture.getData()->rect == sf::IntRect(10, 5, 40, 30));
                 REQUIRE(texture.getImageSize() == sf::Vector2f(40, 30));
@@ -109,7 +109,7 @@ TEST_CASE("[Texture]")
 
             REQUIRE(texture.getId() == "resources/image.png");
             REQUIRE(texture.getData() != nullptr);
-            REQUIRE(texture.getData()->image != nullptr);
+            REQUIRE(texture.getData()->alphaMask != nullptr);
             REQUIRE(texture.getData()->texture.getSize() == sf::Vector2u(50, 50));
             REQUIRE(texture.getData()->rect == sf::IntRect());
             REQUIRE(texture.getImageSize() == sf::Vector2f(50, 50));
@@ -122,7 +122,7 @@ TEST_CASE("[Texture]")
                 tgui::Texture textureCopy{texture};
                 REQUIRE(textureCopy.getId() == "resources/image.png");
                 REQUIRE(textureCopy.getData() != nullptr);
-                REQUIRE(textureCopy.getData()->image != nullptr);
+                REQUIRE(textureCopy.getData()->alphaMask != nullptr);
                 REQUIRE(textureCopy.getData()->texture.getSize() == sf::Vector2u(50, 50));
                 REQUIRE(textureCopy.getData()->rect == sf::IntRect());
                 REQUIRE(textureCopy.getImageSize() == sf::Vector2f(50, 50));
@@ -141,7 +141,7 @@ TEST_CASE("[Texture]")
                 textureCopy = texture;
                 REQUIRE(textureCopy.getId() == "resources/image.png");
                 REQUIRE(textureCopy.getData() != nullptr);
-                REQUIRE(textureCopy.getData()->image != nullptr);
+                REQUIRE(textureCopy.getData()->alphaMask != nullptr);
                 REQUIRE(textureCopy.getData()->texture.getSize() == sf::Vector2u(50, 50));
                 REQUIRE(textureCopy.getData()->rect == sf::IntRect());
                 REQUIRE(textureCopy.getImageSize() == sf::Vector2f(50, 50));
@@ -214,6 +214,42 @@ TEST_CASE("[Texture]")
         tgui::Texture::setImageLoader(oldImageLoader);
     }
 
+    SECTION("Transparent pixels")
+    {
+        unsigned int count = 0;
+        auto oldImageLoader = tgui::Texture::getImageLoader();
+
+        // The mask has to work for images that are wider than the 64 pixels that are stored per word
+        auto func = [&](const sf::String&){
+                auto image = std::make_unique<sf::Image>();
+                image->create(70, 3, sf::Color::Red);
+                image->setPixel(2, 0, sf::Color::Transparent);
+                image->setPixel(65, 1, sf::Color::Transparent);
+                image->setPixel(69, 2, sf::Color{0, 0, 0, 1});
+                count++;
+                return image;
+            };
+        tgui::Texture::setImageLoader(func);
+
+        tgui::Texture texture{"AlphaMaskTest.png"};
+        REQUIRE(texture.getData()->alphaMask != nullptr);
+        REQUIRE(texture.getData()->alphaMask->getSize() == sf::Vector2u(70, 3));
+        REQUIRE(texture.isTransparentPixel({2, 0}));
+        REQUIRE(texture.isTransparentPixel({65, 1}));
+        REQUIRE(!texture.isTransparentPixel({0, 0}));
+        REQUIRE(!texture.isTransparentPixel({65, 0}));
+        REQUIRE(!texture.isTransparentPixel({69, 2}));
+
+        // Parts of the same image share the mask and only decode the image once
+        tgui::Texture part{"AlphaMaskTest.png", {60, 1, 10, 2}};
+        REQUIRE(count == 1);
+        REQUIRE(part.getData()->alphaMask == texture.getData()->alphaMask);
+        REQUIRE(part.isTransparentPixel({5, 0}));
+        REQUIRE(!part.isTransparentPixel({5, 1}));
+
+        tgui::Texture::setImageLoader(oldImageLoader);
+    }
+
     SECTION("TextureLoader")
     {
         unsigned int count = 0;
@@ -26,8 +26,22 @@
 #include <TGUI/TextureManager.hpp>
 #include <TGUI/Exception.hpp>
 #include <TGUI/Texture.hpp>
+#include <TGUI/Loading/Theme.hpp>
+#include <TGUI/Widgets/Button.hpp>
 #include <SFML/System/Err.hpp>
 
+namespace
+{
+    // Gives access to the image that the texture manager keeps decoded
+    struct TextureManagerTest : public tgui::TextureManager
+    {
+        static bool hasDecodedImage()
+        {
+            return m_decodedImage != nullptr;
+        }
+    };
+}
+
 TEST_CASE("[TextureManager]")
 {
     std::streambuf *oldbuf = sf::err().rdbuf(0);
@@ -52,4 +66,22 @@ TEST_CASE("[TextureManager]")
     REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData1));
     REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData1));
     REQUIRE_THROWS_AS(tgui::TextureManager::removeTexture(textureData1), tgui::Exception);
+
+    SECTION("Decoded image is released")
+    {
+        tgui::Texture texture3{"resources/image.png"};
+        REQUIRE(!TextureManagerTest::hasDecodedImage());
+
+        {
+            const tgui::TextureManager::LoadBatch batch;
+            tgui::Texture texture4{"resources/image.png", {0, 0, 10, 10}};
+            REQUIRE(TextureManagerTest::hasDecodedImage());
+        }
+        REQUIRE(!TextureManagerTest::hasDecodedImage());
+
+        tgui::Theme theme{"resources/Black.txt"};
+        auto button = tgui::Button::create();
+        button->setRenderer(theme.getRenderer("Button"));
+        REQUIRE(!TextureManagerTest::hasDecodedImage());
+    }
 }
@@ -84,6 +84,58 @@ TEST_CASE("[Canvas]")
         REQUIRE(internalRenderTexture == &canvas->getRenderTexture());
     }
 
+    SECTION("pixel buffer")
+    {
+        canvas = tgui::Canvas::create({40, 30});
+        REQUIRE(canvas->getPixelBufferMode() == tgui::Canvas::PixelBufferMode::None);
+        REQUIRE(canvas->getBackPixelBuffer() == nullptr);
+
+        std::vector<sf::Uint8> pixels(20 * 10 * 4, 255);
+
+        SECTION("Single")
+        {
+            canvas->setPixelBufferMode(tgui::Canvas::PixelBufferMode::Single);
+            REQUIRE(canvas->getPixelBufferMode() == tgui::Canvas::PixelBufferMode::Single);
+            REQUIRE(canvas->getBackPixelBuffer() == nullptr);
+
+            // Regions can be partially or entirely outside the canvas and tiles can be taken from a larger image
+            REQUIRE_NOTHROW(canvas->updatePixels(pixels.data(), {5, 5, 20, 10}));
+            REQUIRE_NOTHROW(canvas->updatePixels(pixels.data(), {30, 25, 20, 10}));
+            REQUIRE_NOTHROW(canvas->updatePixels(pixels.data(), {-10, -5, 20, 10}));
+            REQUIRE_NOTHROW(canvas->updatePixels(pixels.data(), {100, 100, 20, 10}));
+            REQUIRE_NOTHROW(canvas->updatePixels(pixels.data(), {0, 0, 5, 5}, 20));
+        }
+
+        SECTION("Double")
+        {
+            canvas->setPixelBufferMode(tgui::Canvas::PixelBufferMode::Double);
+            REQUIRE(canvas->getPixelBufferMode() == tgui::Canvas::PixelBufferMode::Double);
+
+            sf::Uint8* backBuffer = canvas->getBackPixelBuffer();
+            REQUIRE(backBuffer != nullptr);
+            REQUIRE(backBuffer[0] == 0);
+            REQUIRE(backBuffer[3] == 255);
+
+            backBuffer[0] = 200;
+            canvas->swapPixelBuffers({0, 0, 1, 1});
+            REQUIRE(canvas->getBackPixelBuffer() != backBuffer);
+            REQUIRE(canvas->getBackPixelBuffer()[0] == 0);
+
+            // Pixels that are uploaded directly are also stored in the buffer that is shown
+            canvas->updatePixels(pixels.data(), {0, 0, 20, 10});
+            canvas->swapPixelBuffers();
+            REQUIRE(canvas->getBackPixelBuffer() == backBuffer);
+            REQUIRE(canvas->getBackPixelBuffer()[0] == 255);
+
+            // The buffers are resized with the canvas
+            canvas->setSize({10, 10});
+            REQUIRE(canvas->getBackPixelBuffer() != nullptr);
+
+            canvas->setPixelBufferMode(tgui::Canvas::PixelBufferMode::None);
+            REQUIRE(canvas->getBackPixelBuffer() == nullptr);
+        }
+    }
+
     testWidgetRenderer(canvas->getRenderer());
 
     SECTION("Saving and loading from file")
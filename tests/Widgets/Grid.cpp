@@ -74,6 +74,31 @@ TEST_CASE("[Grid]")
         REQUIRE(grid->getWidget(1, 5) == widget);
         grid->removeAllWidgets();
         REQUIRE(grid->getWidget(1, 5) == nullptr);
+
+        // The widgets behind a removed widget move to the left and an empty row is removed
+        auto widget1 = tgui::ClickableWidget::create({10, 10});
+        auto widget2 = tgui::ClickableWidget::create({20, 20});
+        auto widget3 = tgui::ClickableWidget::create({30, 30});
+        auto widget4 = tgui::ClickableWidget::create({40, 40});
+        grid->addWidget(widget1, 0, 0);
+        grid->addWidget(widget2, 0, 1);
+        grid->addWidget(widget3, 0, 3);
+        grid->addWidget(widget4, 1, 0);
+
+        grid->remove(widget1);
+        REQUIRE(grid->getWidget(0, 0) == widget2);
+        REQUIRE(grid->getWidget(0, 1) == nullptr);
+        REQUIRE(grid->getWidget(0, 2) == widget3);
+        REQUIRE(grid->getWidget(1, 0) == widget4);
+        REQUIRE(grid->getGridWidgets()[0].size() == 3);
+        REQUIRE(widget3->getPosition() == sf::Vector2f(40, 0));
+
+        grid->remove(widget2);
+        grid->remove(widget3);
+        REQUIRE(grid->getWidget(0, 0) == widget4);
+        REQUIRE(grid->getGridWidgets().size() == 1);
+        REQUIRE(grid->getSize() == sf::Vector2f(40, 40));
+        REQUIRE(widget4->getPosition() == sf::Vector2f(0, 0));
     }
 
     SECTION("Borders")
@@ -108,6 +133,45 @@ TEST_CASE("[Grid]")
         REQUIRE(grid->getWidgetAlignment(0, 0) == tgui::Grid::Alignment::Center);
     }
 
+    SECTION("Positions")
+    {
+        auto widget1 = tgui::ClickableWidget::create({100, 50});
+        auto widget2 = tgui::ClickableWidget::create({20, 10});
+        auto widget3 = tgui::ClickableWidget::create({40, 30});
+        grid->addWidget(widget1, 0, 0);
+        grid->addWidget(widget2, 0, 1);
+        grid->addWidget(widget3, 1, 0);
+
+        REQUIRE(grid->getSize() == sf::Vector2f(120, 80));
+        REQUIRE(widget1->getPosition() == sf::Vector2f(0, 0));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(100, 20));
+        REQUIRE(widget3->getPosition() == sf::Vector2f(30, 50));
+
+        // Shrinking a widget also shrinks its row and column
+        widget1->setSize({60, 20});
+        REQUIRE(grid->getSize() == sf::Vector2f(80, 50));
+        REQUIRE(widget1->getPosition() == sf::Vector2f(0, 0));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(60, 5));
+        REQUIRE(widget3->getPosition() == sf::Vector2f(10, 20));
+
+        // Removing the only widget in the last column removes the column
+        grid->remove(widget2);
+        REQUIRE(grid->getSize() == sf::Vector2f(60, 50));
+        REQUIRE(grid->getWidgetLocations().size() == 2);
+        REQUIRE(widget3->getPosition() == sf::Vector2f(10, 20));
+
+        // Widgets that are removed from the grid no longer affect it
+        widget2->setSize({200, 200});
+        REQUIRE(grid->getSize() == sf::Vector2f(60, 50));
+
+        // Placing a widget in an occupied cell takes the previous widget out of the grid
+        grid->addWidget(widget3, 0, 0);
+        REQUIRE(grid->getWidget(0, 0) == widget3);
+        REQUIRE(grid->getWidgets().size() == 2);
+        REQUIRE(grid->getWidgetLocations().size() == 1);
+        REQUIRE(grid->getSize() == sf::Vector2f(40, 30));
+    }
+
     SECTION("Saving and loading from file")
     {
         grid->setSize({800, 600});
@@ -138,6 +138,32 @@ TEST_CASE("[HorizontalLayout]")
 
         layout->removeAllWidgets();
         REQUIRE(layout->get(0) == nullptr);
+
+        auto button1 = tgui::Button::create();
+        auto button2 = tgui::Button::create();
+        auto button3 = tgui::Button::create();
+        layout->addWidgets({button1, button2});
+        layout->insertWidgets(1, {button3});
+        REQUIRE(layout->get(0) == button1);
+        REQUIRE(layout->get(1) == button3);
+        REQUIRE(layout->get(2) == button2);
+        REQUIRE(layout->getRatio(button3) == 1);
+        REQUIRE(button3->getPosition().x == button1->getFullSize().x);
+        REQUIRE(button2->getFullSize() == button1->getFullSize());
+
+        // Inserting widgets that are already in the layout moves them
+        auto button4 = tgui::Button::create();
+        layout->setRatio(button1, 2);
+        layout->insertWidgets(3, {button1, button4});
+        REQUIRE(layout->getWidgets().size() == 4);
+        REQUIRE(layout->get(0) == button3);
+        REQUIRE(layout->get(1) == button2);
+        REQUIRE(layout->get(2) == button1);
+        REQUIRE(layout->get(3) == button4);
+        REQUIRE(layout->getRatio(button1) == 1);
+        REQUIRE(layout->getRatio(button2) == 1);
+        REQUIRE(button2->getPosition().x == button3->getFullSize().x);
+        REQUIRE(button4->getPosition().x == 3 * button3->getFullSize().x);
     }
 
     SECTION("Saving and loading from file")
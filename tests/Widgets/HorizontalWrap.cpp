@@ -94,6 +94,85 @@ TEST_CASE("[HorizontalWrap]")
         REQUIRE(pic8->getPosition() == sf::Vector2f(0, 160));
     }
 
+    SECTION("Inserting and removing widgets")
+    {
+        std::vector<tgui::Widget::Ptr> pics;
+        for (unsigned int i = 0; i < 5; ++i)
+            pics.push_back(tgui::Picture::create("resources/image.png"));
+        for (auto& pic : pics)
+            pic->setSize({50, 40});
+
+        wrap->addWidgets(pics);
+        REQUIRE(wrap->getWidgets().size() == 5);
+        REQUIRE(pics[0]->getPosition() == sf::Vector2f(0, 0));
+        REQUIRE(pics[1]->getPosition() == sf::Vector2f(50, 0));
+        REQUIRE(pics[2]->getPosition() == sf::Vector2f(0, 40));
+        REQUIRE(pics[3]->getPosition() == sf::Vector2f(50, 40));
+        REQUIRE(pics[4]->getPosition() == sf::Vector2f(0, 80));
+
+        auto pic = tgui::Picture::create("resources/image.png");
+        pic->setSize({50, 40});
+        wrap->insert(1, pic);
+        REQUIRE(wrap->get(1) == pic);
+        REQUIRE(pic->getPosition() == sf::Vector2f(50, 0));
+        REQUIRE(pics[1]->getPosition() == sf::Vector2f(0, 40));
+        REQUIRE(pics[4]->getPosition() == sf::Vector2f(50, 80));
+
+        wrap->remove(pic);
+        REQUIRE(pics[1]->getPosition() == sf::Vector2f(50, 0));
+        REQUIRE(pics[2]->getPosition() == sf::Vector2f(0, 40));
+        REQUIRE(pics[4]->getPosition() == sf::Vector2f(0, 80));
+
+        auto widePic = tgui::Picture::create("resources/image.png");
+        widePic->setSize({100, 40});
+        wrap->insertWidgets(0, {widePic});
+        REQUIRE(wrap->get(0) == widePic);
+        REQUIRE(widePic->getPosition() == sf::Vector2f(0, 0));
+        REQUIRE(pics[0]->getPosition() == sf::Vector2f(0, 40));
+        REQUIRE(pics[1]->getPosition() == sf::Vector2f(50, 40));
+        REQUIRE(pics[4]->getPosition() == sf::Vector2f(0, 120));
+
+        // Removing a widget that doesn't change where the next line starts
+        pics[0]->setSize({20, 40});
+        wrap->setSize({140, "100%"});
+        REQUIRE(pics[0]->getPosition() == sf::Vector2f(100, 0));
+        REQUIRE(pics[1]->getPosition() == sf::Vector2f(0, 40));
+        wrap->remove(pics[0]);
+        REQUIRE(pics[1]->getPosition() == sf::Vector2f(0, 40));
+        REQUIRE(pics[2]->getPosition() == sf::Vector2f(50, 40));
+        REQUIRE(pics[3]->getPosition() == sf::Vector2f(0, 80));
+        REQUIRE(pics[4]->getPosition() == sf::Vector2f(50, 80));
+
+        wrap->removeAllWidgets();
+        wrap->addWidgets(pics);
+        REQUIRE(pics[1]->getPosition() == sf::Vector2f(20, 0));
+
+        // The reflow doesn't stop early when a widget behind the stopping point changed size
+        wrap->removeAllWidgets();
+        wrap->setSize({100, "100%"});
+        for (auto& pic : pics)
+            pic->setSize({50, 40});
+        wrap->addWidgets(pics);
+        REQUIRE(pics[2]->getPosition() == sf::Vector2f(0, 40));
+        REQUIRE(pics[3]->getPosition() == sf::Vector2f(50, 40));
+        REQUIRE(pics[4]->getPosition() == sf::Vector2f(0, 80));
+
+        pics[3]->setSize({100, 40});
+        wrap->insert(2, tgui::ClickableWidget::create({0, 40}));
+        REQUIRE(pics[2]->getPosition() == sf::Vector2f(0, 40));
+        REQUIRE(pics[3]->getPosition() == sf::Vector2f(0, 80));
+        REQUIRE(pics[4]->getPosition() == sf::Vector2f(0, 120));
+
+        // Inserting widgets that are already in the layout moves them
+        wrap->insertWidgets(0, {pics[3], pics[4]});
+        REQUIRE(wrap->getWidgets().size() == 6);
+        REQUIRE(wrap->get(0) == pics[3]);
+        REQUIRE(wrap->get(1) == pics[4]);
+        REQUIRE(wrap->get(2) == pics[0]);
+        REQUIRE(pics[4]->getPosition() == sf::Vector2f(0, 40));
+        REQUIRE(pics[2]->getPosition() == sf::Vector2f(50, 80));
+    }
+
     testWidgetRenderer(wrap->getRenderer());
     SECTION("Renderer")
     {
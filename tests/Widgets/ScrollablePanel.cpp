@@ -78,6 +78,44 @@ TEST_CASE("[ScrollablePanel]")
         }
     }
 
+    SECTION("ContentSize")
+    {
+        panel->setSize(150, 100);
+        REQUIRE(panel->getContentSize() == panel->getInnerSize());
+
+        auto widget1 = tgui::ClickableWidget::create({100, 50});
+        widget1->setPosition(200, 20);
+        panel->add(widget1);
+        REQUIRE(panel->getContentSize() == sf::Vector2f(300, 70));
+
+        auto widget2 = tgui::ClickableWidget::create({30, 150});
+        widget2->setPosition(10, 40);
+        panel->add(widget2);
+        REQUIRE(panel->getContentSize() == sf::Vector2f(300, 190));
+
+        // Moving a widget that isn't at the edge doesn't change the bounds
+        widget2->setPosition(20, 40);
+        REQUIRE(panel->getContentSize() == sf::Vector2f(300, 190));
+
+        // Shrinking the widget at the edge of the content makes the content smaller
+        widget1->setSize({20, 50});
+        REQUIRE(panel->getContentSize() == sf::Vector2f(220, 190));
+
+        widget2->setSize({300, 10});
+        REQUIRE(panel->getContentSize() == sf::Vector2f(320, 70));
+
+        panel->remove(widget2);
+        REQUIRE(panel->getContentSize() == sf::Vector2f(220, 70));
+
+        // The bounds are no longer tracked when the content size is set manually
+        panel->setContentSize({500, 400});
+        widget1->setPosition(600, 600);
+        REQUIRE(panel->getContentSize() == sf::Vector2f(500, 400));
+
+        panel->setContentSize({0, 0});
+        REQUIRE(panel->getContentSize() == sf::Vector2f(620, 650));
+    }
+
     SECTION("VerticalScrollbarPolicy")
     {
         REQUIRE(panel->getVerticalScrollbarPolicy() == tgui::Scrollbar::Policy::Automatic);
@@ -0,0 +1,123 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/Widgets/TiledPicture.hpp>
+
+TEST_CASE("[TiledPicture]")
+{
+    tgui::TiledPicture::Ptr picture = tgui::TiledPicture::create();
+    picture->setSize(100, 100);
+
+    std::vector<std::tuple<unsigned int, unsigned int, unsigned int>> loadedTiles;
+    auto loader = [&](unsigned int level, unsigned int column, unsigned int row, sf::Image& tile) {
+        loadedTiles.emplace_back(level, column, row);
+        tile.create(64, 64, sf::Color::Red);
+        return true;
+    };
+
+    SECTION("WidgetType")
+    {
+        REQUIRE(picture->getWidgetType() == "TiledPicture");
+    }
+
+    SECTION("Source")
+    {
+        picture->setSource({1000, 600}, 64, 3, loader);
+        REQUIRE(picture->getImageSize() == sf::Vector2u(1000, 600));
+        REQUIRE(picture->getTileSize() == 64);
+        REQUIRE(picture->getLevelCount() == 3);
+        REQUIRE(picture->getVisibleRect() == tgui::FloatRect(0, 0, 1000, 600));
+    }
+
+    SECTION("Only visible tiles are loaded")
+    {
+        picture->setSource({1000, 600}, 64, 4, loader);
+
+        // The entire image is shown at 10 image pixels per screen pixel, so the lowest resolution level is used
+        REQUIRE(picture->getVisibleLevel() == 3);
+        REQUIRE(loadedTiles.size() == 2 * 2);
+
+        // At full resolution, the 100x100 visible part overlaps 3x3 tiles
+        loadedTiles.clear();
+        picture->setVisibleRect({100, 50, 100, 100});
+        REQUIRE(picture->getVisibleLevel() == 0);
+        REQUIRE(loadedTiles.size() == 3 * 3);
+        REQUIRE(std::find(loadedTiles.begin(), loadedTiles.end(), std::make_tuple(0u, 1u, 0u)) != loadedTiles.end());
+        REQUIRE(std::find(loadedTiles.begin(), loadedTiles.end(), std::make_tuple(0u, 3u, 2u)) != loadedTiles.end());
+
+        // Cached tiles aren't loaded again
+        loadedTiles.clear();
+        picture->setVisibleRect({110, 60, 100, 100});
+        REQUIRE(loadedTiles.empty());
+
+        // Half the resolution is used when the widget shows twice as many pixels as it has
+        picture->setVisibleRect({0, 0, 200, 200});
+        REQUIRE(picture->getVisibleLevel() == 1);
+    }
+
+    SECTION("Cache budget")
+    {
+        picture->setCacheBudget(64 * 64 * 4 * 6);
+        REQUIRE(picture->getCacheBudget() == 64 * 64 * 4 * 6);
+
+        // Visible tiles are kept even when they don't fit in the budget
+        picture->setSize(64, 64);
+        picture->setSource({640, 64}, 64, 1, loader);
+        REQUIRE(picture->getCachedTileCount() == 10);
+        REQUIRE(picture->getCacheMemoryUsage() == 64 * 64 * 4 * 10);
+
+        // The least recently used tiles are removed once the budget is exceeded
+        picture->setVisibleRect({0, 0, 64, 64});
+        REQUIRE(picture->getCachedTileCount() == 6);
+        REQUIRE(picture->getCacheMemoryUsage() == 64 * 64 * 4 * 6);
+
+        loadedTiles.clear();
+        picture->setVisibleRect({5 * 64, 0, 64, 64});
+        REQUIRE(loadedTiles.empty());
+        picture->setVisibleRect({64, 0, 64, 64});
+        REQUIRE(loadedTiles.size() == 1);
+        REQUIRE(picture->getCachedTileCount() == 6);
+    }
+
+    SECTION("Tiles that fail to load")
+    {
+        picture->setSource("resources/NonExistentTile_{level}_{column}_{row}.png", {100, 100}, 64, 1);
+        REQUIRE(picture->getCachedTileCount() == 4);
+        REQUIRE(picture->getCacheMemoryUsage() == 0);
+    }
+
+    SECTION("Copy")
+    {
+        picture->setSource({1000, 600}, 64, 1, loader);
+        picture->setVisibleRect({0, 0, 100, 100});
+
+        loadedTiles.clear();
+        auto copy = tgui::TiledPicture::copy(picture);
+        REQUIRE(copy->getVisibleRect() == tgui::FloatRect(0, 0, 100, 100));
+        REQUIRE(copy->getCachedTileCount() == 4);
+        REQUIRE(loadedTiles.size() == 4);
+    }
+}
@@ -0,0 +1,185 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/Widgets/VirtualListPanel.hpp>
+#include <TGUI/Widgets/ClickableWidget.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/Group.hpp>
+
+TEST_CASE("[VirtualListPanel]")
+{
+    tgui::VirtualListPanel::Ptr panel = tgui::VirtualListPanel::create({200, 100});
+    panel->getRenderer()->setBorders(0);
+    panel->getRenderer()->setPadding(0);
+
+    unsigned int createCount = 0;
+    std::map<tgui::Widget*, std::size_t> boundItems;
+    panel->setItemCreator([&]{ ++createCount; return tgui::ClickableWidget::create(); });
+    panel->setItemBinder([&](const tgui::Widget::Ptr& widget, std::size_t index){ boundItems[widget.get()] = index; });
+
+    SECTION("WidgetType")
+    {
+        REQUIRE(panel->getWidgetType() == "VirtualListPanel");
+    }
+
+    SECTION("Properties")
+    {
+        REQUIRE(panel->getItemCount() == 0);
+        REQUIRE(panel->getItemHeight() == 20);
+        REQUIRE(panel->getBufferItemCount() == 2);
+
+        panel->setItemHeight(30);
+        panel->setBufferItemCount(5);
+        REQUIRE(panel->getItemHeight() == 30);
+        REQUIRE(panel->getBufferItemCount() == 5);
+    }
+
+    SECTION("Items")
+    {
+        panel->setItemHeight(20);
+        panel->setItemCount(1000);
+        REQUIRE(panel->getItemCount() == 1000);
+        REQUIRE(panel->getContentSize().y == 20000);
+
+        // Only the visible items and the buffer below them have a widget
+        REQUIRE(panel->getWidgets().size() == 8);
+        REQUIRE(createCount == 8);
+        REQUIRE(panel->getItemWidget(0) != nullptr);
+        REQUIRE(panel->getItemWidget(7) != nullptr);
+        REQUIRE(panel->getItemWidget(8) == nullptr);
+        REQUIRE(boundItems[panel->getItemWidget(3).get()] == 3);
+        REQUIRE(panel->getItemWidget(3)->getPosition() == sf::Vector2f(0, 60));
+        REQUIRE(panel->getItemWidget(3)->getSize().y == 20);
+
+        // Widgets are reused when scrolling
+        panel->scrollToItem(500);
+        REQUIRE(panel->getWidgets().size() == 10);
+        REQUIRE(createCount == 10);
+        REQUIRE(panel->getItemWidget(0) == nullptr);
+        REQUIRE(panel->getItemWidget(498) != nullptr);
+        REQUIRE(panel->getItemWidget(508) == nullptr);
+        REQUIRE(boundItems[panel->getItemWidget(500).get()] == 500);
+        REQUIRE(panel->getItemWidget(500)->getPosition() == sf::Vector2f(0, 10000));
+
+        panel->setVerticalScrollbarValue(12000);
+        panel->update(sf::milliseconds(10));
+        REQUIRE(panel->getWidgets().size() == 10);
+        REQUIRE(createCount == 10);
+        REQUIRE(panel->getItemWidget(600) != nullptr);
+        REQUIRE(boundItems[panel->getItemWidget(600).get()] == 600);
+
+        panel->setItemCount(3);
+        REQUIRE(panel->getWidgets().size() == 3);
+        REQUIRE(panel->getItemWidget(2) != nullptr);
+        REQUIRE(panel->getItemWidget(3) == nullptr);
+
+        panel->setItemCount(0);
+        REQUIRE(panel->getWidgets().empty());
+    }
+
+    SECTION("Variable item heights")
+    {
+        panel->setItemHeightFunction([](std::size_t index){ return (index % 2 == 0) ? 10.f : 30.f; });
+        panel->setItemCount(100);
+        REQUIRE(panel->getContentSize().y == 2000);
+
+        // Items 0 to 5 fill the visible area
+        REQUIRE(panel->getWidgets().size() == 8);
+        REQUIRE(panel->getItemWidget(3)->getPosition() == sf::Vector2f(0, 50));
+        REQUIRE(panel->getItemWidget(3)->getSize().y == 30);
+
+        panel->scrollToItem(50);
+        REQUIRE(panel->getItemWidget(50)->getPosition() == sf::Vector2f(0, 1000));
+        REQUIRE(panel->getItemWidget(47) == nullptr);
+        REQUIRE(panel->getItemWidget(48) != nullptr);
+    }
+
+    SECTION("Refreshing items")
+    {
+        panel->setItemCount(10);
+        boundItems.clear();
+
+        panel->refreshItem(1);
+        REQUIRE(boundItems.size() == 1);
+
+        panel->refreshItem(9);
+        REQUIRE(boundItems.size() == 1);
+
+        panel->refreshItems();
+        REQUIRE(boundItems.size() == 8);
+        REQUIRE(createCount == 8);
+    }
+
+    SECTION("Copying")
+    {
+        panel->setItemCount(10);
+
+        auto panelCopy = tgui::VirtualListPanel::copy(panel);
+        REQUIRE(panelCopy->getItemCount() == 10);
+        REQUIRE(panelCopy->getWidgets().size() == 8);
+        REQUIRE(panelCopy->getItemWidget(0) != panel->getItemWidget(0));
+        REQUIRE(createCount == 16);
+
+        SECTION("Widgets that aren't items are copied")
+        {
+            panel->add(tgui::Button::create(), "OtherWidget");
+
+            panelCopy = tgui::VirtualListPanel::copy(panel);
+            REQUIRE(panelCopy->getWidgets().size() == 9);
+            REQUIRE(panelCopy->get("OtherWidget") != nullptr);
+            REQUIRE(panelCopy->get("OtherWidget") != panel->get("OtherWidget"));
+        }
+    }
+
+    SECTION("Saving and loading from file")
+    {
+        panel->setItemHeight(25);
+        panel->setBufferItemCount(3);
+        panel->setItemCount(10);
+
+        testSavingWidget("VirtualListPanel", panel, false);
+    }
+
+    SECTION("Saving widgets that aren't items")
+    {
+        panel->setItemCount(10);
+        panel->add(tgui::Button::create("Other"), "OtherWidget");
+
+        auto parent = tgui::Group::create();
+        parent->add(panel, "Panel");
+
+        std::stringstream stream;
+        parent->saveWidgetsToStream(stream);
+
+        parent->removeAllWidgets();
+        parent->loadWidgetsFromStream(stream);
+
+        auto loadedPanel = parent->get<tgui::VirtualListPanel>("Panel");
+        REQUIRE(loadedPanel->getItemCount() == 0);
+        REQUIRE(loadedPanel->getWidgets().size() == 1);
+        REQUIRE(loadedPanel->get<tgui::Button>("OtherWidget")->getText() == "Other");
+    }
+}